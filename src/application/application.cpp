@@ -21,7 +21,11 @@
 #include <OGRE/Overlay/OgreOverlaySystem.h>
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_mouse.h>
+#include <boost/exception/all.hpp>
 #include <boost/log/trivial.hpp>
+#include <cassert>
+#include <charconv>
+#include <filesystem>
 #include <fstream>
 #include <map>
 #include <ranges>
@@ -32,19 +36,45 @@ namespace application
 namespace pres = presentation;
 using misc::get;
 
-application::application(int argc, const char* argv[]) : base("ARCHV")
+namespace
 {
-    if (argc != 3)
+    [[noreturn]] inline auto exit_with_usage() -> void
     {
-        std::cout
-            << "usage: `./<exec> <path/to/graph.json> <path/to/config.json>`\n";
+        std::cout << "usage: `./<exec> <path/to/graph.json> "
+                     "<path/to/config.json> [--seed <unsigned int>]`\n";
         std::exit(EXIT_FAILURE);
     }
 
+    inline auto parse_seed(std::string_view arg) -> unsigned int
+    {
+        auto seed = 0u;
+        const auto [ptr, ec]
+            = std::from_chars(arg.data(), arg.data() + arg.size(), seed);
+
+        if (ec != std::errc() or ptr != arg.data() + arg.size())
+            exit_with_usage();
+
+        return seed;
+    }
+
+} // namespace
+
+application::application(int argc, const char* argv[]) : base("ARCHV")
+{
+    if (argc != 3 and !(argc == 5 and std::string_view(argv[3]) == "--seed"))
+        exit_with_usage();
+
     m_graph_path = argv[1];
     m_config_path = argv[2];
 
-    import(m_jsons, m_graph_path);
+    if (argc == 5)
+        m_seed = parse_seed(argv[4]);
+
+    // NOTE: The graph document is streamed at setup, never archived.
+    if (!std::filesystem::exists(m_graph_path))
+        BOOST_THROW_EXCEPTION(
+            invalid_file_path() << file_path_info(m_graph_path.data()));
+
     import(m_jsons, m_config_path);
 }
 
@@ -53,6 +83,11 @@ application::~application() = default;
 auto application::frameStarted(const Ogre::FrameEvent& e) -> bool
 {
     base::frameStarted(e);
+
+    // Commits any finished layout computations, on the main thread.
+    if (m_graph_iface)
+        m_graph_iface->get_layout_backend().poll();
+
     Ogre::ImGuiOverlay::NewFrame();
     //  ImGui::ShowDemoWindow();
     gui::render(*m_gui);
@@ -154,7 +189,11 @@ auto application::setup() -> void
 
 auto application::setup_graph_interface() -> void
 {
-    auto&& [st, g, m] = architecture::deserialize(m_jsons.get(m_graph_path));
+    auto snapshot_path = std::filesystem::path(m_graph_path);
+    snapshot_path += ".snapshot";
+
+    auto&& [st, g, m] = architecture::deserialize_cached(
+        m_graph_path, snapshot_path, misc::hardware_concurrency());
 
     const auto& weights_root = get(m_jsons.get(m_config_path), "weights");
     const auto& layout_root = get(m_jsons.get(m_config_path), "layout");
@@ -163,14 +202,26 @@ auto application::setup_graph_interface() -> void
     const auto& colors_root = get(m_jsons.get(m_config_path), "color-coding");
     const auto& degrees_root = get(m_jsons.get(m_config_path), "degrees");
 
+    auto layout_cfg = layout::deserialize(layout_root);
+    auto clustering_cfg = clustering::deserialize(clustering_root);
+
+    // The command line seed overrides the configured ones.
+    if (m_seed)
+    {
+        layout_cfg.seed = *m_seed;
+        clustering_cfg.seed = *m_seed;
+
+        BOOST_LOG_TRIVIAL(info) << "seeded with: " << *m_seed;
+    }
+
     m_graph_iface = std::make_unique< graph_interface_type >(
         std::move(st),
         std::move(g),
         std::move(m),
         weights::deserialize(weights_root),
-        layout::deserialize(layout_root),
+        std::move(layout_cfg),
         scaling::deserialize(scaling_root),
-        clustering::deserialize(clustering_root),
+        std::move(clustering_cfg),
         color_coding::deserialize(colors_root),
         degrees::deserialize(degrees_root));
 
@@ -200,7 +251,8 @@ auto application::setup_rendering() -> void
         m_background_renderer->scene(),
         config.graph,
         degrees::evaluator(m_graph_iface->get_degrees_backend()),
-        clustering::color_pool());
+        clustering::color_pool(),
+        m_graph_iface->get_layout_backend().config_data().seed);
 
     m_graph_renderer->render_scaling(pres::vertex_scale(*m_graph_iface));
     m_graph_renderer->render_weights(pres::edge_weight(*m_graph_iface));
@@ -605,18 +657,21 @@ auto application::prepare_layout_editor() -> void
 
     auto& editor = m_gui->get_menu_bar().get_layout_editor();
 
+    // NOTE: Shows the latest requests, not the (pending) committed ones.
     editor.set_layout(
         [this]()
-        { return layout::get_layout_id(m_graph_iface->get_layout_backend()); });
+        { return m_graph_iface->get_layout_backend().requested_layout(); });
 
     editor.set_topology(
-        [this]() {
-            return layout::get_topology_id(m_graph_iface->get_layout_backend());
-        });
+        [this]()
+        { return m_graph_iface->get_layout_backend().requested_topology(); });
 
     editor.set_scale(
         [this]()
-        { return layout::get_scale(m_graph_iface->get_layout_backend()); });
+        { return m_graph_iface->get_layout_backend().requested_scale(); });
+
+    editor.set_auto_refine(
+        [this]() { return m_graph_iface->get_layout_backend().auto_refine(); });
 
     BOOST_LOG_TRIVIAL(debug) << "prepared layout editor";
 }
@@ -760,6 +815,25 @@ auto application::prepare_clustering_editor() -> void
     frontend.set_llp_steps([this, &backend]()
                            { return clustering::get_llp_steps(backend); });
 
+    frontend.set_leiden_resolution(
+        [this, &backend]()
+        { return clustering::get_leiden_resolution(backend); });
+
+    frontend.set_leiden_iterations(
+        [this, &backend]()
+        { return clustering::get_leiden_iterations(backend); });
+
+    frontend.set_mce_min_clique_size(
+        [this, &backend]()
+        { return clustering::get_mce_min_clique_size(backend); });
+
+    frontend.set_mce_max_cliques(
+        [this, &backend]()
+        { return clustering::get_mce_max_cliques(backend); });
+
+    frontend.set_mce_time_limit(
+        [this, &backend]() { return clustering::get_mce_time_limit(backend); });
+
     BOOST_LOG_TRIVIAL(debug) << "prepared clustering editor";
 }
 
@@ -945,6 +1019,8 @@ auto application::connect_weights_presentation() -> void
         {
             m_graph_renderer->render_weights(pres::edge_weight(*m_graph_iface));
             BOOST_LOG_TRIVIAL(info) << "rendered edge weights";
+
+            m_graph_iface->get_layout_backend().notify_weights_changed();
         });
 
     BOOST_LOG_TRIVIAL(debug) << "connected weights presentation";
@@ -985,6 +1061,13 @@ auto application::connect_layout_presentation() -> void
             pres::restore_layout(*m_cmds, backend);
         });
 
+    editor.connect_to_auto_refine(
+        [&backend](auto enabled)
+        {
+            BOOST_LOG_TRIVIAL(info) << "selected auto refine: " << enabled;
+            backend.set_auto_refine(enabled);
+        });
+
     backend.connect_to_layout(
         [this](const auto&)
         {
@@ -993,6 +1076,9 @@ auto application::connect_layout_presentation() -> void
             BOOST_LOG_TRIVIAL(info) << "rendered layout";
         });
 
+    backend.connect_to_progress([&editor](auto progress)
+                                { editor.set_progress(progress); });
+
     BOOST_LOG_TRIVIAL(debug) << "connected layout presentation";
 }
 
@@ -1275,6 +1361,43 @@ auto application::connect_clustering_presentation() -> void
             pres::update_clustering_llp_steps(*m_cmds, backend, s);
         });
 
+    editor.connect_to_leiden_resolution(
+        [this, &backend](auto r)
+        {
+            BOOST_LOG_TRIVIAL(info) << "selected clustering leiden res " << r;
+            pres::update_clustering_leiden_resolution(*m_cmds, backend, r);
+        });
+
+    editor.connect_to_leiden_iterations(
+        [this, &backend](auto i)
+        {
+            BOOST_LOG_TRIVIAL(info) << "selected clustering leiden its " << i;
+            pres::update_clustering_leiden_iterations(*m_cmds, backend, i);
+        });
+
+    editor.connect_to_mce_min_clique_size(
+        [this, &backend](auto n)
+        {
+            BOOST_LOG_TRIVIAL(info) << "selected clustering mce min size " << n;
+            pres::update_clustering_mce_min_clique_size(*m_cmds, backend, n);
+        });
+
+    editor.connect_to_mce_max_cliques(
+        [this, &backend](auto n)
+        {
+            BOOST_LOG_TRIVIAL(info) << "selected clustering mce max cliques "
+                                    << n;
+            pres::update_clustering_mce_max_cliques(*m_cmds, backend, n);
+        });
+
+    editor.connect_to_mce_time_limit(
+        [this, &backend](auto secs)
+        {
+            BOOST_LOG_TRIVIAL(info) << "selected clustering mce time limit "
+                                    << secs;
+            pres::update_clustering_mce_time_limit(*m_cmds, backend, secs);
+        });
+
     editor.connect_to_restore(
         [this, &backend]()
         {
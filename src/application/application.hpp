@@ -11,6 +11,7 @@
 
 #include <OGRE/Bites/OgreApplicationContext.h> // for ApplicationContext
 #include <memory>                              // for unique_ptr
+#include <optional>                            // for optional
 #include <string_view>                         // for string_view
 
 namespace application
@@ -93,6 +94,7 @@ private:
 
     std::string_view m_graph_path;
     std::string_view m_config_path;
+    std::optional< unsigned int > m_seed; // overrides the configured ones
 
     std::unique_ptr< graph_interface_type > m_graph_iface;
     std::unique_ptr< command_history_type > m_cmds;
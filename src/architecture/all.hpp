@@ -6,8 +6,10 @@
 
 #include "concepts.hpp"
 #include "config.hpp"
+#include "csr_graph.hpp"
 #include "graph.hpp"
 #include "metadata.hpp"
+#include "snapshot.hpp"
 #include "symbol_table.hpp"
 #include "symbols.hpp"
 #include "vertex_marker.hpp"
@@ -4,6 +4,7 @@
 #ifndef ARCHITECTURE_ALLFWD_HPP
 #define ARCHITECTURE_ALLFWD_HPP
 
+#include "misc/allfwd.hpp"         // for interned_string, interned_dependency
 #include "misc/boost_graphfwd.hpp" // for adjacency_list
 
 #include <string> // for string
@@ -12,17 +13,19 @@
 namespace architecture
 {
 
+struct edge_index_t;
+
 using graph = boost::adjacency_list<
     boost::vecS,
     boost::vecS,
     boost::bidirectionalS,
-    std::string,
-    std::string,
+    misc::interned_string,
+    boost::property< edge_index_t, std::size_t, misc::interned_dependency >,
     boost::no_property,
     boost::listS >;
 
-using symbol_type = std::string;
-using dependency_type = std::string;
+using symbol_type = misc::interned_string;
+using dependency_type = misc::interned_dependency;
 
 struct source_location;
 struct symbol;
@@ -32,6 +35,7 @@ struct structure;
 
 class symbol_table;
 
+class metadata_table;
 struct metadata_counter;
 
 class vertex_marker;
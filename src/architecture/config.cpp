@@ -2,13 +2,20 @@
 
 #include "graph.hpp"
 #include "misc/deserialization.hpp"
+#include "misc/json_stream.hpp"
+#include "misc/parallel.hpp"
 #include "symbol_table.hpp"
 #include "vertex_marker.hpp"
 
+#include <algorithm>
 #include <boost/log/trivial.hpp>
 #include <cassert>
 #include <concepts>
+#include <istream>
 #include <jsoncpp/json/json.h>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace architecture
 {
@@ -225,6 +232,27 @@ namespace
         return s;
     }
 
+    auto mark_vertex(
+        structure s,
+        symbol_table& st,
+        graph& g,
+        vertex_marker& m) -> void
+    {
+        const auto id = symbol_type(s.sym.id);
+        st.insert(std::move(s));
+        m.mark(id, boost::add_vertex(id, g));
+    }
+
+    auto read_vertex(
+        const symbol::id_type& id,
+        const json_val& val,
+        symbol_table& st,
+        graph& g,
+        vertex_marker& m) -> void
+    {
+        mark_vertex(read_structure(id, val), st, g, m);
+    }
+
     auto read_vertices(
         const json_val& val,
         symbol_table& st,
@@ -234,32 +262,152 @@ namespace
         for_each_object(
             val,
             [&st, &g, &m](const auto& id, const auto& val)
-            {
-                st.insert(read_structure(id, val));
-                m.mark(id, boost::add_vertex(id, g));
-            });
+            { read_vertex(id, val, st, g, m); });
     }
 
-    auto read_edges(const json_val& val, graph& g, vertex_marker& m) -> void
+    struct dependency
     {
         using vertex_property = graph::vertex_bundled;
+        using edge_property = graph::edge_bundled;
+        using types_type = std::vector< edge_property >;
+
+        vertex_property from;
+        vertex_property to;
+        types_type types;
+    };
+
+    auto read_dependency(const json_val& val) -> dependency
+    {
+        auto dep = dependency();
+        dep.from = dependency::vertex_property(as< std::string >(get(val, "from")));
+        dep.to = dependency::vertex_property(as< std::string >(get(val, "to")));
+
+        for_each_object(
+            get(val, "types"),
+            [&dep](const auto& type, const auto&)
+            { dep.types.emplace_back(type); });
+
+        return dep;
+    }
+
+    auto read_edge(const dependency& dep, graph& g, vertex_marker& m) -> void
+    {
+        assert(m.marks(dep.from)); // TODO throw here
+        assert(m.marks(dep.to));
+
+        for (const auto& type : dep.types)
+            add_dependency(m.vertex(dep.from), m.vertex(dep.to), type, g);
 
+        BOOST_LOG_TRIVIAL(debug)
+            << "read dependency from: " << dep.from << " to: " << dep.to;
+    }
+
+    auto read_edges(const json_val& val, graph& g, vertex_marker& m) -> void
+    {
         for (const auto& v : val)
-        {
-            const auto& from = as< vertex_property >(get(v, "from"));
-            const auto& to = as< vertex_property >(get(v, "to"));
+            read_edge(read_dependency(v), g, m);
+    }
+
+} // namespace
+
+/***********************************************************
+ * Parallel Reading                                        *
+ ***********************************************************/
+
+namespace
+{
+    // Entries are read concurrently, but always merged in document order, in
+    // order to yield identical symbol tables, vertices and edges.
+
+    // Structures/Dependencies handed to each thread, at once, when streaming.
+    constexpr auto batch_size_per_thread = std::size_t(256);
+
+    inline auto as_json(const json_val* val) -> const json_val&
+    {
+        assert(val);
+        return *val;
+    }
+
+    inline auto as_json(const std::string& raw) -> json_val
+    {
+        return parse_json(raw);
+    }
+
+    template < typename Entry >
+    auto read_vertices_batch(
+        const std::vector< std::pair< symbol::id_type, Entry > >& batch,
+        symbol_table& st,
+        graph& g,
+        vertex_marker& m,
+        unsigned num_threads) -> void
+    {
+        auto structures = std::vector< structure >(batch.size());
+
+        parallel_for(
+            std::size_t(0),
+            batch.size(),
+            [&batch, &structures](auto i)
+            {
+                const auto& [id, entry] = batch[i];
+                structures[i] = read_structure(id, as_json(entry));
+            },
+            num_threads);
+
+        for (auto& s : structures)
+            mark_vertex(std::move(s), st, g, m);
+    }
+
+    template < typename Entry >
+    auto read_dependencies_batch(
+        const std::vector< Entry >& batch,
+        unsigned num_threads) -> std::vector< dependency >
+    {
+        auto deps = std::vector< dependency >(batch.size());
+
+        parallel_for(
+            std::size_t(0),
+            batch.size(),
+            [&batch, &deps](auto i)
+            { deps[i] = read_dependency(as_json(batch[i])); },
+            num_threads);
+
+        return deps;
+    }
 
-            assert(m.marks(from)); // TODO throw here
-            assert(m.marks(to));
+    auto read_vertices(
+        const json_val& val,
+        symbol_table& st,
+        graph& g,
+        vertex_marker& m,
+        unsigned num_threads) -> void
+    {
+        using entry = std::pair< symbol::id_type, const json_val* >;
 
-            for_each_object(
-                get(v, "types"),
-                [&from, &to, &g, &m](const auto& type, const auto&)
-                { boost::add_edge(m.vertex(from), m.vertex(to), type, g); });
+        auto batch = std::vector< entry >();
+        batch.reserve(val.size());
 
-            BOOST_LOG_TRIVIAL(debug)
-                << "read dependency from: " << from << " to: " << to;
-        }
+        for_each_object(
+            val,
+            [&batch](const auto& id, const auto& v)
+            { batch.emplace_back(id, &v); });
+
+        read_vertices_batch(batch, st, g, m, num_threads);
+    }
+
+    auto read_edges(
+        const json_val& val,
+        graph& g,
+        vertex_marker& m,
+        unsigned num_threads) -> void
+    {
+        auto batch = std::vector< const json_val* >();
+        batch.reserve(val.size());
+
+        for (const auto& v : val)
+            batch.push_back(&v);
+
+        for (const auto& dep : read_dependencies_batch(batch, num_threads))
+            read_edge(dep, g, m);
     }
 
 } // namespace
@@ -276,4 +424,112 @@ auto deserialize(const json_val& root) -> config_data
     return { std::move(st), std::move(g), std::move(m) };
 }
 
+auto deserialize(const json_val& root, unsigned num_threads) -> config_data
+{
+    auto st = symbol_table();
+    auto g = graph();
+    auto m = vertex_marker();
+
+    read_vertices(get(root, "structures"), st, g, m, num_threads);
+    read_edges(get(root, "dependencies"), g, m, num_threads);
+
+    return { std::move(st), std::move(g), std::move(m) };
+}
+
+auto deserialize(std::istream& is) -> config_data
+{
+    return deserialize(is, 1);
+}
+
+// NOTE: Dependencies that precede the structures in the stream are held, as
+// plain records, until all of the vertices are marked.
+auto deserialize(std::istream& is, unsigned num_threads) -> config_data
+{
+    using raw_structure = std::pair< symbol::id_type, std::string >;
+    using raw_dependency = std::string;
+
+    auto st = symbol_table();
+    auto g = graph();
+    auto m = vertex_marker();
+
+    auto stream = json_stream(is);
+    auto read_structures = false;
+    auto read_dependencies = false;
+    auto pending = std::vector< dependency >();
+
+    const auto batch_size = batch_size_per_thread * std::max(1u, num_threads);
+
+    auto structures = std::vector< raw_structure >();
+    auto flush_structures = [&]()
+    {
+        read_vertices_batch(structures, st, g, m, num_threads);
+        structures.clear();
+    };
+
+    auto deps = std::vector< raw_dependency >();
+    auto flush_dependencies = [&]()
+    {
+        for (auto& dep : read_dependencies_batch(deps, num_threads))
+            if (read_structures)
+                read_edge(dep, g, m);
+            else
+                pending.push_back(std::move(dep));
+
+        deps.clear();
+    };
+
+    stream.for_each_member(
+        [&](const auto& key)
+        {
+            if (key == "structures")
+            {
+                stream.for_each_member(
+                    [&](auto id)
+                    {
+                        structures.emplace_back(
+                            std::move(id), stream.read_raw());
+
+                        if (structures.size() == batch_size)
+                            flush_structures();
+                    });
+
+                flush_structures();
+
+                for (const auto& dep : pending)
+                    read_edge(dep, g, m);
+
+                pending = std::vector< dependency >();
+                read_structures = true;
+            }
+            else if (key == "dependencies")
+            {
+                stream.for_each_element(
+                    [&]()
+                    {
+                        deps.push_back(stream.read_raw());
+
+                        if (deps.size() == batch_size)
+                            flush_dependencies();
+                    });
+
+                flush_dependencies();
+                read_dependencies = true;
+            }
+            else
+            {
+                stream.skip_value();
+            }
+        });
+
+    stream.consume_end();
+
+    if (!read_structures)
+        BOOST_THROW_EXCEPTION(key_not_found() << key_info("structures"));
+
+    if (!read_dependencies)
+        BOOST_THROW_EXCEPTION(key_not_found() << key_info("dependencies"));
+
+    return { std::move(st), std::move(g), std::move(m) };
+}
+
 } // namespace architecture
\ No newline at end of file
@@ -5,9 +5,11 @@
 #ifndef ARCHITECTURE_CONFIG_HPP
 #define ARCHITECTURE_CONFIG_HPP
 
+#include "misc/allfwd.hpp"         // for interned_string, interned_dependency
 #include "misc/boost_graphfwd.hpp" // for adjacency_list
 #include "misc/jsoncppfwd.hpp"     // for Value
 
+#include <iosfwd> // for istream
 #include <string> // for string
 #include <tuple>  // for tuple
 
@@ -17,12 +19,14 @@ namespace architecture
 class symbol_table;
 class vertex_marker;
 
+struct edge_index_t;
+
 using graph = boost::adjacency_list<
     boost::vecS,
     boost::vecS,
     boost::bidirectionalS,
-    std::string,
-    std::string,
+    misc::interned_string,
+    boost::property< edge_index_t, std::size_t, misc::interned_dependency >,
     boost::no_property,
     boost::listS >;
 
@@ -33,6 +37,17 @@ using config_data = std::tuple< symbol_table, graph, vertex_marker >;
 // query vertices by their properties.
 auto deserialize(const json_val& root) -> config_data;
 
+// Same as above, but reads the structures and dependencies concurrently, on
+// (at most) num_threads threads.
+// Yields identical results.
+auto deserialize(const json_val& root, unsigned num_threads) -> config_data;
+
+// Same as above, but streams the document, keeping only a bounded batch of
+// structures or dependencies in memory at a time.
+// Throws misc::syntax_error on malformed input.
+auto deserialize(std::istream& is) -> config_data;
+auto deserialize(std::istream& is, unsigned num_threads) -> config_data;
+
 } // namespace architecture
 
 #endif // ARCHITECTURE_CONFIG_HPP
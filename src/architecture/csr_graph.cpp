@@ -0,0 +1,53 @@
+#include "csr_graph.hpp"
+
+#include <boost/log/trivial.hpp>
+#include <cassert>
+#include <utility>
+#include <vector>
+
+namespace architecture
+{
+
+auto make_csr_graph(const graph& g) -> csr_graph
+{
+    using vertex_pair
+        = std::pair< graph::vertex_descriptor, graph::vertex_descriptor >;
+
+    std::vector< vertex_pair > vertex_pairs;
+    std::vector< csr_edge_properties > properties;
+    vertex_pairs.reserve(boost::num_edges(g));
+    properties.reserve(boost::num_edges(g));
+
+    // NOTE: Listed by source, so that the (stable) counting sort preserves the
+    // out edges order.
+    for (auto u : boost::make_iterator_range(boost::vertices(g)))
+    {
+        for (auto e : boost::make_iterator_range(boost::out_edges(u, g)))
+        {
+            vertex_pairs.emplace_back(u, boost::target(e, g));
+            properties.push_back(
+                csr_edge_properties(boost::get(edge_index_t(), g, e), g[e]));
+        }
+    }
+
+    auto res = csr_graph(
+        boost::edges_are_unsorted_multi_pass,
+        std::cbegin(vertex_pairs),
+        std::cend(vertex_pairs),
+        std::cbegin(properties),
+        boost::num_vertices(g));
+
+    for (auto v : boost::make_iterator_range(boost::vertices(g)))
+        res[v] = g[v];
+
+    assert(boost::num_vertices(res) == boost::num_vertices(g));
+    assert(boost::num_edges(res) == boost::num_edges(g));
+
+    BOOST_LOG_TRIVIAL(debug) << "built csr view of: " << boost::num_vertices(g)
+                             << " vertices, " << boost::num_edges(g)
+                             << " edges";
+
+    return res;
+}
+
+} // namespace architecture
@@ -0,0 +1,82 @@
+// Contains an immutable, compressed sparse row, view of the dependencies graph.
+// Soultatos Stefanos 2022
+
+#ifndef ARCHITECTURE_CSR_GRAPH_HPP
+#define ARCHITECTURE_CSR_GRAPH_HPP
+
+#include "graph.hpp" // for graph, symbol_type, dependency_type
+
+#include <boost/graph/compressed_sparse_row_graph.hpp> // for compressed_sparse_row_graph
+
+namespace architecture
+{
+
+/***********************************************************
+ * Properties                                              *
+ ***********************************************************/
+
+// The dependency of a view edge, along with the index of the graph edge that it
+// was built from.
+struct csr_edge_properties
+{
+    edge_index_type index;
+    dependency_type dependency;
+
+    auto operator==(const csr_edge_properties&) const -> bool = default;
+    auto operator!=(const csr_edge_properties&) const -> bool = default;
+};
+
+/***********************************************************
+ * CSR Graph                                               *
+ ***********************************************************/
+
+// Contiguous in & out adjacency arrays, for cache friendly traversals.
+// Models the BGL Vertex List, Edge List, Incidence, Bidirectional and
+// Adjacency Graph concepts.
+// NOTE: Shares the vertex descriptors of the graph that it was built from, its
+// out edges follow the same order, its edge descriptors are not shared.
+using csr_graph = boost::compressed_sparse_row_graph<
+    boost::bidirectionalS,
+    symbol_type,
+    csr_edge_properties >;
+
+static_assert(std::is_same_v<
+              csr_graph::vertex_descriptor,
+              graph::vertex_descriptor >);
+
+// NOTE: Missing from the boost bidirectional CSR graph, found through ADL.
+inline auto degree(csr_graph::vertex_descriptor v, const csr_graph& g)
+    -> csr_graph::degree_size_type
+{
+    return boost::out_degree(v, g) + boost::in_degree(v, g);
+}
+
+/***********************************************************
+ * Property Maps                                           *
+ ***********************************************************/
+
+using csr_id_map = decltype(boost::get(
+    boost::vertex_bundle,
+    std::declval< const csr_graph& >()));
+
+using csr_dependency_map = decltype(boost::get(
+    &csr_edge_properties::dependency,
+    std::declval< const csr_graph& >()));
+
+// Maps each view edge to its (dense) graph edge index, so that the edge
+// property arrays of the graph can be shared.
+using csr_edge_index_map = decltype(boost::get(
+    &csr_edge_properties::index,
+    std::declval< const csr_graph& >()));
+
+/***********************************************************
+ * Construction                                            *
+ ***********************************************************/
+
+// Builds a read-only view of the graph.
+// O(V + E)
+auto make_csr_graph(const graph& g) -> csr_graph;
+
+} // namespace architecture
+
+#endif // ARCHITECTURE_CSR_GRAPH_HPP
@@ -4,6 +4,8 @@
 #ifndef ARCHITECTURE_GRAPH_HPP
 #define ARCHITECTURE_GRAPH_HPP
 
+#include "misc/interning.hpp" // for interned_string, interned_dependency
+
 #include <boost/graph/adjacency_list.hpp> // for adjacency_list
 #include <string>                         // for string
 
@@ -14,8 +16,21 @@ namespace architecture
  * Properties                                              *
  ***********************************************************/
 
-using symbol_type = std::string;
-using dependency_type = std::string;
+// NOTE: Symbol ids and dependency types are interned, in order to be hashed and
+// compared in O(1), dependency types also map to dense indices.
+using symbol_type = misc::interned_string;
+using dependency_type = misc::interned_dependency;
+
+// Dense, stable, edge index, assigned in insertion order.
+struct edge_index_t
+{
+    using kind = boost::edge_property_tag;
+};
+
+using edge_index_type = std::size_t;
+
+using edge_properties
+    = boost::property< edge_index_t, edge_index_type, dependency_type >;
 
 /***********************************************************
  * Graph                                                   *
@@ -26,7 +41,7 @@ using graph = boost::adjacency_list<
     boost::vecS,
     boost::bidirectionalS,
     symbol_type,
-    dependency_type >;
+    edge_properties >;
 
 /***********************************************************
  * Property Maps                                           *
@@ -38,11 +53,32 @@ using id_map
 using dependency_map
     = decltype(boost::get(boost::edge_bundle, std::declval< graph >()));
 
+using edge_index_map
+    = decltype(boost::get(edge_index_t(), std::declval< graph >()));
+
 // Parallel edges are allowed.
 static_assert(std::is_same_v<
               typename boost::parallel_edge_traits< boost::vecS >::type,
               boost::allow_parallel_edge_tag >);
 
+static_assert(std::is_same_v< graph::edge_bundled, dependency_type >);
+
+/***********************************************************
+ * Construction                                            *
+ ***********************************************************/
+
+// Adds a dependency, indexed right after the existing ones.
+// NOTE: Dependencies are never removed, so the edge indices stay dense.
+inline auto add_dependency(
+    graph::vertex_descriptor u,
+    graph::vertex_descriptor v,
+    dependency_type dependency,
+    graph& g)
+{
+    const auto index = static_cast< edge_index_type >(boost::num_edges(g));
+    return boost::add_edge(u, v, edge_properties(index, dependency), g);
+}
+
 } // namespace architecture
 
 #endif // ARCHITECTURE_GRAPH_HPP
@@ -10,33 +10,88 @@ namespace architecture
 {
 
 static_assert(
-    std::is_same_v< metadata_counter::vertex_type, graph::vertex_descriptor >);
+    std::is_same_v< metadata_table::vertex_type, graph::vertex_descriptor >);
 
-auto metadata_counter::operator()(vertex_type v, tag_type tag) const
-    -> count_type
+/***********************************************************
+ * Metadata Table                                          *
+ ***********************************************************/
+
+metadata_table::metadata_table(const symbol_table& st, const graph& g)
 {
-    const auto& id = boost::get(boost::get(boost::vertex_bundle, g), v);
-    const auto* sym = st.lookup(id);
+    for (auto& col : m_columns)
+        col.resize(boost::num_vertices(g));
 
-    assert(sym);
+    auto& fields = m_columns[index_of(metric::fields)];
+    auto& methods = m_columns[index_of(metric::methods)];
+    auto& nested = m_columns[index_of(metric::nested)];
 
-    if (tag == fields_tag)
+    for (auto v : boost::make_iterator_range(boost::vertices(g)))
     {
-        return sym->fields.size();
+        const auto* sym = st.lookup(g[v]);
+        assert(sym);
+
+        fields[v] = sym->fields.size();
+        methods[v] = sym->methods.size();
+        nested[v] = sym->nested.size();
     }
+
+    BOOST_LOG_TRIVIAL(debug) << "computed metadata of: " << num_vertices()
+                             << " vertices";
+}
+
+auto metadata_table::num_vertices() const -> size_type
+{
+    return m_columns.front().size();
+}
+
+auto metadata_table::column(metric m) const -> column_view
+{
+    assert(index_of(m) < num_metrics);
+    return m_columns[index_of(m)];
+}
+
+auto metadata_table::count(vertex_type v, metric m) const -> count_type
+{
+    assert(v < num_vertices());
+    return column(m)[v];
+}
+
+/***********************************************************
+ * Metadata Counter                                        *
+ ***********************************************************/
+
+auto metadata_counter::metric(tag_type tag) -> std::optional< metric_type >
+{
+    if (tag == fields_tag)
+        return metric_type::fields;
     else if (tag == methods_tag)
-    {
-        return sym->methods.size();
-    }
+        return metric_type::methods;
     else if (tag == nested_tag)
-    {
-        return sym->nested.size();
-    }
+        return metric_type::nested;
     else
-    {
+        return std::nullopt;
+}
+
+auto metadata_counter::resolve(tag_type tag) const -> key_type
+{
+    const auto m = metric(tag);
+
+    if (!m)
         BOOST_LOG_TRIVIAL(warning) << "unknown attribute: " << tag;
-        return 0;
-    }
+
+    return m;
+}
+
+auto metadata_counter::operator()(vertex_type v, key_type key) const
+    -> count_type
+{
+    return key ? table.count(v, *key) : 0;
+}
+
+auto metadata_counter::operator()(vertex_type v, tag_type tag) const
+    -> count_type
+{
+    return (*this)(v, resolve(tag));
 }
 
-} // namespace architecture
\ No newline at end of file
+} // namespace architecture
@@ -4,41 +4,109 @@
 #ifndef ARCHITECTURE_METADATA_HPP
 #define ARCHITECTURE_METADATA_HPP
 
+#include "misc/allfwd.hpp"         // for interned_string, interned_dependency
 #include "misc/boost_graphfwd.hpp" // for adjacency_list
 
+#include <array>       // for array
+#include <optional>    // for optional
+#include <span>        // for span
 #include <string_view> // for string_view
+#include <vector>      // for vector
 
 namespace architecture
 {
 
 class symbol_table;
 
+struct edge_index_t;
+
 using graph = boost::adjacency_list<
     boost::vecS,
     boost::vecS,
     boost::bidirectionalS,
-    std::string,
-    std::string,
+    misc::interned_string,
+    boost::property< edge_index_t, std::size_t, misc::interned_dependency >,
     boost::no_property,
     boost::listS >;
 
+/***********************************************************
+ * Metadata Table                                          *
+ ***********************************************************/
+
+// Columnar graph symbols attributes counts, one contiguous column per metric,
+// indexed by vertex.
+// Computed once, so that counts are read in O(1) time, and whole columns can
+// be scanned without any symbol lookups.
+class metadata_table
+{
+public:
+    using vertex_type = std::size_t;
+    using count_type = unsigned;
+    using size_type = std::size_t;
+    using column_view = std::span< const count_type >;
+
+    enum class metric : std::size_t
+    {
+        fields,
+        methods,
+        nested
+    };
+
+    static constexpr auto num_metrics = size_type(3);
+
+    metadata_table() = default;
+
+    // O(V)
+    metadata_table(const symbol_table& st, const graph& g);
+
+    auto num_vertices() const -> size_type;
+
+    auto column(metric m) const -> column_view;
+    auto count(vertex_type v, metric m) const -> count_type;
+
+    auto operator==(const metadata_table&) const -> bool = default;
+    auto operator!=(const metadata_table&) const -> bool = default;
+
+private:
+    using column_storage = std::vector< count_type >;
+    using columns = std::array< column_storage, num_metrics >;
+
+    static constexpr auto index_of(metric m) -> size_type
+    {
+        return static_cast< size_type >(m);
+    }
+
+    columns m_columns;
+};
+
 /***********************************************************
  * Metadata Counter                                        *
  ***********************************************************/
 
 // Count graph symbols attributes by tags, e.g: "fields", "methods", etc.
+// Tags can be resolved once, to their metric columns, so that each count is a
+// single array read.
 struct metadata_counter
 {
-    using vertex_type = std::size_t;
+    using vertex_type = metadata_table::vertex_type;
     using tag_type = std::string_view;
-    using count_type = unsigned;
+    using count_type = metadata_table::count_type;
+    using metric_type = metadata_table::metric;
+    using key_type = std::optional< metric_type >;
 
     static constexpr auto fields_tag { "Fields" };
     static constexpr auto methods_tag { "Methods" };
     static constexpr auto nested_tag { "Nested" };
 
-    const symbol_table& st;
-    const graph& g;
+    const metadata_table& table;
+
+    static auto metric(tag_type tag) -> std::optional< metric_type >;
+
+    // NOTE: Yields nothing if tag is unknown.
+    auto resolve(tag_type tag) const -> key_type;
+
+    // NOTE: Returns zero if key is unresolved.
+    auto operator()(vertex_type v, key_type key) const -> count_type;
 
     // NOTE: Returns zero if tag is unknown.
     auto operator()(vertex_type v, tag_type tag) const -> count_type;
@@ -0,0 +1,502 @@
+#include "snapshot.hpp"
+
+#include <array>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/log/trivial.hpp>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <span>
+#include <type_traits>
+
+namespace architecture
+{
+
+namespace
+{
+    // NOTE: Snapshots are written in native byte order, they are meant to be
+    // read back from the same machine.
+
+    constexpr auto magic
+        = std::array { 'A', 'R', 'C', 'H', 'V', 'S', 'N', 'P' };
+    constexpr auto version = std::uint32_t(1);
+    constexpr auto byte_order = std::uint32_t(0x01020304);
+
+    using size_type = std::uint64_t;
+    using bytes = std::span< const char >;
+
+    // Maps a whole file in read-only memory.
+    class mapped_file
+    {
+    public:
+        explicit mapped_file(const snapshot_path& path)
+        {
+            using namespace boost::interprocess;
+
+            if (std::filesystem::file_size(path) == 0)
+                return;
+
+            m_file = file_mapping(path.c_str(), read_only);
+            m_region = mapped_region(m_file, read_only);
+        }
+
+        auto data() const -> bytes
+        {
+            return { static_cast< const char* >(m_region.get_address()),
+                     m_region.get_size() };
+        }
+
+    private:
+        boost::interprocess::file_mapping m_file;
+        boost::interprocess::mapped_region m_region;
+    };
+
+} // namespace
+
+/***********************************************************
+ * Hashing                                                 *
+ ***********************************************************/
+
+namespace
+{
+    // FNV-1a, over 8 byte words.
+    auto hash_bytes(bytes data) -> snapshot_key
+    {
+        constexpr auto basis = snapshot_key(14695981039346656037ULL);
+        constexpr auto prime = snapshot_key(1099511628211ULL);
+
+        constexpr auto word_size = sizeof(snapshot_key);
+
+        auto h = basis ^ data.size();
+        auto i = std::size_t(0);
+
+        for (; i + word_size <= data.size(); i += word_size)
+        {
+            snapshot_key word;
+            std::memcpy(&word, data.data() + i, sizeof(word));
+            h = (h ^ word) * prime;
+        }
+
+        for (; i < data.size(); ++i)
+            h = (h ^ static_cast< unsigned char >(data[i])) * prime;
+
+        return h;
+    }
+
+} // namespace
+
+auto content_hash(const snapshot_path& file) -> snapshot_key
+{
+    try
+    {
+        return hash_bytes(mapped_file(file).data());
+    }
+    catch (const std::exception&)
+    {
+        BOOST_THROW_EXCEPTION(
+            invalid_snapshot_path() << snapshot_path_info(file.string()));
+    }
+}
+
+/***********************************************************
+ * Writing                                                 *
+ ***********************************************************/
+
+namespace
+{
+    template < typename T >
+    requires std::is_trivially_copyable_v< T >
+    inline auto write(std::ostream& os, const T& val) -> void
+    {
+        os.write(reinterpret_cast< const char* >(&val), sizeof(T));
+    }
+
+    inline auto write(std::ostream& os, bool b) -> void
+    {
+        write(os, static_cast< std::uint8_t >(b));
+    }
+
+    inline auto write(std::ostream& os, const std::string& str) -> void
+    {
+        write(os, static_cast< size_type >(str.size()));
+        os.write(str.data(), static_cast< std::streamsize >(str.size()));
+    }
+
+    auto write(std::ostream& os, const definition& def) -> void;
+    auto write(std::ostream& os, const method& m) -> void;
+
+    template < typename T >
+    inline auto write(std::ostream& os, const std::vector< T >& vec) -> void
+    {
+        write(os, static_cast< size_type >(vec.size()));
+        for (const auto& val : vec)
+            write(os, val);
+    }
+
+    auto write(std::ostream& os, const symbol& sym) -> void
+    {
+        write(os, sym.id);
+        write(os, sym.name);
+        write(os, sym.name_space);
+        write(os, sym.source.file);
+        write(os, sym.source.line);
+        write(os, sym.source.col);
+        write(os, sym.access);
+    }
+
+    auto write(std::ostream& os, const definition& def) -> void
+    {
+        write(os, def.sym);
+        write(os, def.full_t);
+        write(os, def.t);
+    }
+
+    auto write(std::ostream& os, const method& m) -> void
+    {
+        write(os, m.sym);
+        write(os, m.t);
+        write(os, m.ret_type);
+        write(os, m.arguments);
+        write(os, m.definitions);
+        write(os, m.template_args);
+        write(os, m.literals);
+        write(os, m.statements);
+        write(os, m.branches);
+        write(os, m.loops);
+        write(os, m.lines);
+        write(os, m.max_scope);
+        write(os, m.is_virtual);
+    }
+
+    auto write(std::ostream& os, const structure& s) -> void
+    {
+        write(os, s.sym);
+        write(os, s.t);
+        write(os, s.methods);
+        write(os, s.fields);
+        write(os, s.bases);
+        write(os, s.nested);
+        write(os, s.friends);
+        write(os, s.template_args);
+    }
+
+    auto write(std::ostream& os, const symbol_table& st) -> void
+    {
+        const auto n = std::distance(st.begin(), st.end());
+        write(os, static_cast< size_type >(n));
+        for (const auto& [id, s] : st)
+            write(os, s);
+    }
+
+    // NOTE: The vertex marker is implied by the vertex properties.
+    auto write(std::ostream& os, const graph& g) -> void
+    {
+        write(os, static_cast< size_type >(boost::num_vertices(g)));
+        for (auto v : boost::make_iterator_range(boost::vertices(g)))
+            write(os, g[v].str());
+
+        write(os, static_cast< size_type >(boost::num_edges(g)));
+        for (auto e : boost::make_iterator_range(boost::edges(g)))
+        {
+            write(os, static_cast< size_type >(boost::source(e, g)));
+            write(os, static_cast< size_type >(boost::target(e, g)));
+            write(os, g[e].str());
+        }
+    }
+
+} // namespace
+
+auto dump_snapshot(
+    const config_data& data,
+    snapshot_key key,
+    const snapshot_path& to) -> void
+{
+    const auto& [st, g, m] = data;
+    assert(m.num_marked() == boost::num_vertices(g));
+
+    // Write aside, then rename, so that readers never see partial snapshots.
+    auto tmp = to;
+    tmp += ".tmp";
+
+    {
+        auto os = std::ofstream(tmp, std::ios::binary | std::ios::trunc);
+        if (!os.good())
+            BOOST_THROW_EXCEPTION(
+                invalid_snapshot_path() << snapshot_path_info(to.string()));
+
+        os.write(magic.data(), magic.size());
+        write(os, version);
+        write(os, byte_order);
+        write(os, key);
+        write(os, st);
+        write(os, g);
+
+        if (!os.good())
+            BOOST_THROW_EXCEPTION(
+                invalid_snapshot_path() << snapshot_path_info(to.string()));
+    }
+
+    auto err = std::error_code();
+    std::filesystem::rename(tmp, to, err);
+    if (err)
+        BOOST_THROW_EXCEPTION(
+            invalid_snapshot_path() << snapshot_path_info(to.string()));
+
+    BOOST_LOG_TRIVIAL(debug) << "dumped snapshot: " << to.string();
+}
+
+/***********************************************************
+ * Reading                                                 *
+ ***********************************************************/
+
+namespace
+{
+    struct corrupt_snapshot
+    {
+    };
+
+    // Bounds checked cursor over the mapped snapshot.
+    class reader
+    {
+    public:
+        explicit reader(bytes data) : m_data { data } { }
+
+        auto take(std::size_t n) -> bytes
+        {
+            if (n > m_data.size() - m_pos)
+                throw corrupt_snapshot();
+
+            const auto res = m_data.subspan(m_pos, n);
+            m_pos += n;
+            return res;
+        }
+
+        template < typename T >
+        requires std::is_trivially_copyable_v< T >
+        auto read(T& val) -> void
+        {
+            std::memcpy(&val, take(sizeof(T)).data(), sizeof(T));
+        }
+
+        auto read(bool& b) -> void
+        {
+            std::uint8_t byte;
+            read(byte);
+            if (byte > 1)
+                throw corrupt_snapshot();
+
+            b = byte;
+        }
+
+        auto read(std::string& str) -> void
+        {
+            size_type n;
+            read(n);
+            const auto chars = take(n);
+            str.assign(chars.data(), chars.size());
+        }
+
+        template < typename T >
+        auto read(std::vector< T >& vec) -> void
+        {
+            size_type n;
+            read(n);
+            if (n > m_data.size() - m_pos) // at least a byte per element
+                throw corrupt_snapshot();
+
+            vec.resize(n);
+            for (auto& val : vec)
+                read(val);
+        }
+
+        auto read(symbol& sym) -> void
+        {
+            read(sym.id);
+            read(sym.name);
+            read(sym.name_space);
+            read(sym.source.file);
+            read(sym.source.line);
+            read(sym.source.col);
+            read(sym.access);
+        }
+
+        auto read(definition& def) -> void
+        {
+            read(def.sym);
+            read(def.full_t);
+            read(def.t);
+        }
+
+        auto read(method& m) -> void
+        {
+            read(m.sym);
+            read(m.t);
+            read(m.ret_type);
+            read(m.arguments);
+            read(m.definitions);
+            read(m.template_args);
+            read(m.literals);
+            read(m.statements);
+            read(m.branches);
+            read(m.loops);
+            read(m.lines);
+            read(m.max_scope);
+            read(m.is_virtual);
+        }
+
+        auto read(structure& s) -> void
+        {
+            read(s.sym);
+            read(s.t);
+            read(s.methods);
+            read(s.fields);
+            read(s.bases);
+            read(s.nested);
+            read(s.friends);
+            read(s.template_args);
+        }
+
+        auto read(symbol_table& st) -> void
+        {
+            size_type n;
+            read(n);
+            for (size_type i = 0; i < n; ++i)
+            {
+                structure s;
+                read(s);
+                st.insert(std::move(s));
+            }
+        }
+
+        auto read(graph& g, vertex_marker& m) -> void
+        {
+            size_type num_vertices;
+            read(num_vertices);
+            for (size_type i = 0; i < num_vertices; ++i)
+            {
+                std::string str;
+                read(str);
+                const auto id = graph::vertex_bundled(str);
+                if (m.marks(id))
+                    throw corrupt_snapshot();
+
+                m.mark(id, boost::add_vertex(id, g));
+            }
+
+            size_type num_edges;
+            read(num_edges);
+            for (size_type i = 0; i < num_edges; ++i)
+            {
+                size_type u, v;
+                std::string dependency;
+                read(u);
+                read(v);
+                read(dependency);
+                if (u >= num_vertices || v >= num_vertices)
+                    throw corrupt_snapshot();
+
+                add_dependency(u, v, graph::edge_bundled(dependency), g);
+            }
+        }
+
+        auto exhausted() const -> bool { return m_pos == m_data.size(); }
+
+    private:
+        bytes m_data;
+        std::size_t m_pos { 0 };
+    };
+
+} // namespace
+
+auto load_snapshot(const snapshot_path& from, snapshot_key key)
+    -> std::optional< config_data >
+{
+    if (!std::filesystem::exists(from))
+        return std::nullopt;
+
+    try
+    {
+        const auto file = mapped_file(from);
+        auto in = reader(file.data());
+
+        const auto header = in.take(magic.size());
+        if (!std::equal(std::begin(header), std::end(header), magic.begin()))
+            throw corrupt_snapshot();
+
+        std::uint32_t file_version, file_byte_order;
+        snapshot_key file_key;
+        in.read(file_version);
+        in.read(file_byte_order);
+        in.read(file_key);
+
+        if (file_version != version || file_byte_order != byte_order)
+            throw corrupt_snapshot();
+
+        if (file_key != key)
+        {
+            BOOST_LOG_TRIVIAL(debug) << "stale snapshot: " << from.string();
+            return std::nullopt;
+        }
+
+        auto st = symbol_table();
+        auto g = graph();
+        auto m = vertex_marker();
+
+        in.read(st);
+        in.read(g, m);
+
+        if (!in.exhausted())
+            throw corrupt_snapshot();
+
+        BOOST_LOG_TRIVIAL(debug) << "loaded snapshot: " << from.string();
+
+        return config_data(std::move(st), std::move(g), std::move(m));
+    }
+    catch (const corrupt_snapshot&)
+    {
+        BOOST_LOG_TRIVIAL(warning) << "corrupt snapshot: " << from.string();
+    }
+    catch (const std::exception&)
+    {
+        BOOST_LOG_TRIVIAL(warning) << "unreadable snapshot: " << from.string();
+    }
+
+    return std::nullopt;
+}
+
+/***********************************************************
+ * Caching                                                 *
+ ***********************************************************/
+
+auto deserialize_cached(
+    const snapshot_path& json,
+    const snapshot_path& snapshot,
+    unsigned num_threads) -> config_data
+{
+    const auto key = content_hash(json);
+
+    if (auto cached = load_snapshot(snapshot, key); cached)
+        return std::move(*cached);
+
+    auto is = std::ifstream(json);
+    if (!is.good())
+        BOOST_THROW_EXCEPTION(
+            invalid_snapshot_path() << snapshot_path_info(json.string()));
+
+    auto data = deserialize(is, num_threads);
+
+    try
+    {
+        dump_snapshot(data, key, snapshot);
+    }
+    catch (const invalid_snapshot_path&)
+    {
+        BOOST_LOG_TRIVIAL(warning)
+            << "could not write snapshot: " << snapshot.string();
+    }
+
+    return data;
+}
+
+} // namespace architecture
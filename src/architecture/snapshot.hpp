@@ -0,0 +1,71 @@
+// Contains a module for caching the generated symbol table, dependencies graph
+// and vertex marker in a compact binary snapshot.
+// Soultatos Stefanos 2022
+
+#ifndef ARCHITECTURE_SNAPSHOT_HPP
+#define ARCHITECTURE_SNAPSHOT_HPP
+
+#include "config.hpp"        // for config_data
+#include "graph.hpp"         // for graph
+#include "symbol_table.hpp"  // for symbol_table
+#include "vertex_marker.hpp" // for vertex_marker
+
+#include <boost/exception/all.hpp> // for error_info, exception
+#include <cstdint>                 // for uint64_t
+#include <filesystem>              // for path
+#include <optional>                // for optional
+#include <stdexcept>               // for exception
+#include <string>                  // for string
+
+namespace architecture
+{
+
+/***********************************************************
+ * Errors                                                  *
+ ***********************************************************/
+
+struct invalid_snapshot_path : virtual std::exception, virtual boost::exception
+{
+};
+
+/***********************************************************
+ * Error Info                                              *
+ ***********************************************************/
+
+using snapshot_path_info
+    = boost::error_info< struct tag_snapshot_path, std::string >;
+
+/***********************************************************
+ * Snapshots                                               *
+ ***********************************************************/
+
+using snapshot_key = std::uint64_t;
+using snapshot_path = std::filesystem::path;
+
+// Hashes the contents of a (source json) file, in order to key its snapshot.
+// Throws invalid_snapshot_path if the file cannot be read.
+auto content_hash(const snapshot_path& file) -> snapshot_key;
+
+// Writes a binary snapshot, tagged with the given key.
+// Throws invalid_snapshot_path if the snapshot cannot be written.
+auto dump_snapshot(
+    const config_data& data,
+    snapshot_key key,
+    const snapshot_path& to) -> void;
+
+// Memory maps a binary snapshot.
+// Yields nothing if the snapshot is missing, corrupt, or keyed differently.
+auto load_snapshot(const snapshot_path& from, snapshot_key key)
+    -> std::optional< config_data >;
+
+// Loads the snapshot of the json file, if up to date, otherwise deserializes
+// the json file and (re)writes its snapshot.
+// Throws invalid_snapshot_path if the json file cannot be read.
+auto deserialize_cached(
+    const snapshot_path& json,
+    const snapshot_path& snapshot,
+    unsigned num_threads) -> config_data;
+
+} // namespace architecture
+
+#endif // ARCHITECTURE_SNAPSHOT_HPP
@@ -8,9 +8,16 @@ auto symbol_table::lookup(const key_type& id) const -> const value_type*
     return m_table.contains(id) ? std::addressof(m_table.at(id)) : nullptr;
 }
 
+auto symbol_table::lookup(std::string_view id) const -> const value_type*
+{
+    const auto interned = key_type::find(id);
+    return interned ? lookup(*interned) : nullptr;
+}
+
 auto symbol_table::insert(value_type s) -> void
 {
-    m_table.insert(std::make_pair(s.sym.id, std::move(s)));
+    auto id = key_type(s.sym.id);
+    m_table.insert(std::make_pair(id, std::move(s)));
 }
 
 auto symbol_table::clear() -> void
@@ -4,8 +4,10 @@
 #ifndef ARCHITECTURE_SYMBOL_TABLE_HPP
 #define ARCHITECTURE_SYMBOL_TABLE_HPP
 
-#include "symbols.hpp" // for structure
+#include "misc/interning.hpp" // for interned_string
+#include "symbols.hpp"         // for structure
 
+#include <string_view>   // for string_view
 #include <unordered_map> // for unordered_map
 
 namespace architecture
@@ -14,10 +16,13 @@ namespace architecture
 class symbol_table
 {
 public:
-    using key_type = structure::id_type;
+    using key_type = misc::interned_string;
     using value_type = structure;
 
     auto lookup(const key_type& id) const -> const value_type*;
+
+    // NOTE: Never interns the id.
+    auto lookup(std::string_view id) const -> const value_type*;
     auto insert(value_type s) -> void;
 
     auto clear() -> void;
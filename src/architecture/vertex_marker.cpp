@@ -1,14 +1,13 @@
 #include "vertex_marker.hpp"
 
 #include "graph.hpp"
-#include "symbols.hpp"
 
 #include <cassert>
 
 namespace architecture
 {
 
-static_assert(std::is_same_v< vertex_marker::id_type, structure::id_type >);
+static_assert(std::is_same_v< vertex_marker::id_type, graph::vertex_bundled >);
 static_assert(
     std::is_same_v< vertex_marker::vertex_type, graph::vertex_descriptor >);
 
@@ -18,6 +17,12 @@ auto vertex_marker::vertex(const id_type& id) const -> vertex_type
     return m_map.at(id);
 }
 
+auto vertex_marker::vertex(std::string_view id) const -> vertex_type
+{
+    assert(marks(id));
+    return vertex(*id_type::find(id));
+}
+
 auto vertex_marker::num_marked() const -> size_type
 {
     return m_map.size();
@@ -28,10 +33,16 @@ auto vertex_marker::marks(const id_type& id) const -> bool
     return m_map.contains(id);
 }
 
+auto vertex_marker::marks(std::string_view id) const -> bool
+{
+    const auto interned = id_type::find(id);
+    return interned and marks(*interned);
+}
+
 auto vertex_marker::mark(id_type id, vertex_type v) -> void
 {
     assert(!marks(id));
-    m_map[std::move(id)] = std::move(v);
+    m_map[id] = v;
     assert(num_marked() > 0);
 }
 
@@ -5,7 +5,9 @@
 #ifndef ARCHITECTURE_VERTEX_MARKER_HPP
 #define ARCHITECTURE_VERTEX_MARKER_HPP
 
-#include <string>        // for string
+#include "misc/interning.hpp" // for interned_string
+
+#include <string_view>   // for string_view
 #include <unordered_map> // for unordered_map
 
 namespace architecture
@@ -18,15 +20,19 @@ namespace architecture
 class vertex_marker
 {
 public:
-    using id_type = std::string;
+    using id_type = misc::interned_string;
     using vertex_type = std::size_t;
     using size_type = std::size_t;
 
     auto vertex(const id_type& id) const -> vertex_type;
+    auto vertex(std::string_view id) const -> vertex_type;
 
     auto num_marked() const -> size_type;
     auto marks(const id_type& id) const -> bool;
 
+    // NOTE: Never interns the id.
+    auto marks(std::string_view id) const -> bool;
+
     auto mark(id_type id, vertex_type v) -> void;
 
 private:
@@ -5,6 +5,7 @@
 #define CLUSTERING_ALL_HPP
 
 #include "backend.hpp"
+#include "boruvka_min_spanning_tree.hpp"
 #include "cluster_map.hpp"
 #include "clusterer.hpp"
 #include "clusterer_builder.hpp"
@@ -17,6 +18,8 @@
 #include "kruskal_min_spanning_tree.hpp"
 #include "layered_label_propagation_clusterer.hpp"
 #include "layered_label_propagation_clustering.hpp"
+#include "leiden_clusterer.hpp"
+#include "leiden_clustering.hpp"
 #include "louvain_method_clusterer.hpp"
 #include "louvain_method_clustering.hpp"
 #include "maximal_clique_enumeration_clusterer.hpp"
@@ -38,9 +38,15 @@ class layered_label_propagation_clusterer;
 template < typename Graph, typename WeightMap >
 class infomap_clusterer;
 
+template < typename Graph, typename WeightMap >
+class leiden_clusterer;
+
 template < typename Graph, typename WeightMap >
 class kruskal_min_spanning_tree;
 
+template < typename Graph, typename WeightMap >
+class boruvka_min_spanning_tree;
+
 template < typename Graph, typename WeightMap >
 class prim_min_spanning_tree;
 
@@ -9,6 +9,7 @@
 #include "clusterer_builder.hpp"                // for clusterer_builder
 #include "min_spanning_tree_finder.hpp"         // for min_spanning_tree_finder
 #include "min_spanning_tree_finder_factory.hpp" // for min_spanning_tree_finder_factory
+#include "misc/random.hpp"                      // for stream_seed
 #include "plugin.hpp"                           // for id_t
 
 #include <boost/exception/all.hpp>   // for exception
@@ -43,6 +44,18 @@ struct invalid_snn_threshold : virtual backend_error
 {
 };
 
+struct invalid_mce_min_clique_size : virtual backend_error
+{
+};
+
+struct invalid_mce_max_cliques : virtual backend_error
+{
+};
+
+struct invalid_mce_time_limit : virtual backend_error
+{
+};
+
 /***********************************************************
  * Error Info                                              *
  ***********************************************************/
@@ -54,6 +67,14 @@ using mst_finder_info
 using k_info = boost::error_info< struct tag_k, backend_config::k_type >;
 using snn_threshold_info = boost::
     error_info< struct tag_snn_threshold, backend_config::snn_threshold_type >;
+using mce_min_clique_size_info = boost::error_info<
+    struct tag_mce_min_clique_size,
+    backend_config::clique_size_type >;
+using mce_max_cliques_info = boost::error_info<
+    struct tag_mce_max_cliques,
+    backend_config::clique_count_type >;
+using mce_time_limit_info = boost::
+    error_info< struct tag_mce_time_limit, backend_config::seconds_type >;
 
 /***********************************************************
  * Backend                                                 *
@@ -83,6 +104,11 @@ public:
     using modularity_type = float;
     using gamma_type = float;
     using steps_type = int;
+    using resolution_type = float;
+    using iterations_type = int;
+    using clique_size_type = int;
+    using clique_count_type = int;
+    using seconds_type = float;
 
 private:
     using clusters_signal
@@ -98,6 +124,13 @@ private:
     using modularity_signal = boost::signals2::signal< void(modularity_type) >;
     using gamma_signal = boost::signals2::signal< void(gamma_type) >;
     using steps_signal = boost::signals2::signal< void(steps_type) >;
+    using resolution_signal = boost::signals2::signal< void(resolution_type) >;
+    using iterations_signal = boost::signals2::signal< void(iterations_type) >;
+    using clique_size_signal
+        = boost::signals2::signal< void(clique_size_type) >;
+    using clique_count_signal
+        = boost::signals2::signal< void(clique_count_type) >;
+    using seconds_signal = boost::signals2::signal< void(seconds_type) >;
 
 public:
     using clusters_slot = typename clusters_signal::slot_type;
@@ -109,6 +142,11 @@ public:
     using modularity_slot = typename modularity_signal::slot_type;
     using gamma_slot = typename gamma_signal::slot_type;
     using steps_slot = typename steps_signal::slot_type;
+    using resolution_slot = typename resolution_signal::slot_type;
+    using iterations_slot = typename iterations_signal::slot_type;
+    using clique_size_slot = typename clique_size_signal::slot_type;
+    using clique_count_slot = typename clique_count_signal::slot_type;
+    using seconds_slot = typename seconds_signal::slot_type;
     using connection = boost::signals2::connection;
 
     backend(
@@ -129,6 +167,11 @@ public:
     auto get_min_modularity() const -> modularity_type;
     auto get_llp_gamma() const -> gamma_type;
     auto get_llp_steps() const -> steps_type;
+    auto get_leiden_resolution() const -> resolution_type;
+    auto get_leiden_iterations() const -> iterations_type;
+    auto get_mce_min_clique_size() const -> clique_size_type;
+    auto get_mce_max_cliques() const -> clique_count_type;
+    auto get_mce_time_limit() const -> seconds_type;
 
     auto update_clusters() -> void;
     auto update_clusters(cluster_map_type clusters) -> void;
@@ -140,6 +183,11 @@ public:
     auto update_min_modularity(modularity_type q) -> void;
     auto update_llp_gamma(gamma_type gamma) -> void;
     auto update_llp_steps(steps_type steps) -> void;
+    auto update_leiden_resolution(resolution_type resolution) -> void;
+    auto update_leiden_iterations(iterations_type iterations) -> void;
+    auto update_mce_min_clique_size(clique_size_type n) -> void;
+    auto update_mce_max_cliques(clique_count_type n) -> void;
+    auto update_mce_time_limit(seconds_type secs) -> void;
 
     auto connect_to_clusters(const clusters_slot& f) -> connection;
     auto connect_to_clusterer(const clusterer_slot& f) -> connection;
@@ -150,6 +198,12 @@ public:
     auto connect_to_min_modularity(const modularity_slot& f) -> connection;
     auto connect_to_llp_gamma(const gamma_slot& f) -> connection;
     auto connect_to_llp_steps(const steps_slot& f) -> connection;
+    auto connect_to_leiden_resolution(const resolution_slot& f) -> connection;
+    auto connect_to_leiden_iterations(const iterations_slot& f) -> connection;
+    auto connect_to_mce_min_clique_size(const clique_size_slot& f)
+        -> connection;
+    auto connect_to_mce_max_cliques(const clique_count_slot& f) -> connection;
+    auto connect_to_mce_time_limit(const seconds_slot& f) -> connection;
 
 protected:
     auto set_clusters(cluster_map_type clusters) -> void;
@@ -161,6 +215,11 @@ protected:
     auto set_min_modularity(modularity_type q) -> void;
     auto set_llp_gamma(gamma_type gamma) -> void;
     auto set_llp_steps(steps_type steps) -> void;
+    auto set_leiden_resolution(resolution_type resolution) -> void;
+    auto set_leiden_iterations(iterations_type iterations) -> void;
+    auto set_mce_min_clique_size(clique_size_type n) -> void;
+    auto set_mce_max_cliques(clique_count_type n) -> void;
+    auto set_mce_time_limit(seconds_type secs) -> void;
 
     auto emit_clusters() const -> void;
     auto emit_clusterer() const -> void;
@@ -171,6 +230,11 @@ protected:
     auto emit_min_modularity() const -> void;
     auto emit_llp_gamma() const -> void;
     auto emit_llp_steps() const -> void;
+    auto emit_leiden_resolution() const -> void;
+    auto emit_leiden_iterations() const -> void;
+    auto emit_mce_min_clique_size() const -> void;
+    auto emit_mce_max_cliques() const -> void;
+    auto emit_mce_time_limit() const -> void;
 
 private:
     using clusterer_builder_type = clusterer_builder< Graph, WeightMap >;
@@ -199,6 +263,11 @@ private:
     modularity_signal m_min_mod_sig;
     gamma_signal m_llp_gamma_sig;
     steps_signal m_llp_steps_sig;
+    resolution_signal m_leiden_resolution_sig;
+    iterations_signal m_leiden_iterations_sig;
+    clique_size_signal m_mce_min_size_sig;
+    clique_count_signal m_mce_max_cliques_sig;
+    seconds_signal m_mce_time_limit_sig;
 
     intensity_type m_intensity;
 };
@@ -227,6 +296,12 @@ inline backend< Graph, WeightMap >::backend(
     set_min_modularity(config_data().min_modularity);
     set_llp_gamma(config_data().llp_gamma);
     set_llp_steps(config_data().llp_steps);
+    set_leiden_resolution(config_data().leiden_resolution);
+    set_leiden_iterations(config_data().leiden_iterations);
+    set_mce_min_clique_size(config_data().mce_min_clique_size);
+    set_mce_max_cliques(config_data().mce_max_cliques);
+    set_mce_time_limit(config_data().mce_time_limit);
+    m_builder.set_seed(misc::stream_seed(config_data().seed, "clustering"));
 
     assert(m_clusters.empty());
 }
@@ -258,6 +333,21 @@ inline auto backend< Graph, WeightMap >::verify_config_data() const -> void
             invalid_snn_threshold()
             << snn_threshold_info(config_data().snn_threshold));
 
+    if (config_data().mce_min_clique_size < 1)
+        BOOST_THROW_EXCEPTION(
+            invalid_mce_min_clique_size()
+            << mce_min_clique_size_info(config_data().mce_min_clique_size));
+
+    if (config_data().mce_max_cliques < 1)
+        BOOST_THROW_EXCEPTION(
+            invalid_mce_max_cliques()
+            << mce_max_cliques_info(config_data().mce_max_cliques));
+
+    if (!(config_data().mce_time_limit > 0))
+        BOOST_THROW_EXCEPTION(
+            invalid_mce_time_limit()
+            << mce_time_limit_info(config_data().mce_time_limit));
+
     assert(are_clusterers_plugged_in(config_data()));
     assert(are_mst_finders_plugged_in(config_data()));
 }
@@ -301,6 +391,41 @@ inline auto backend< Graph, WeightMap >::get_llp_steps() const -> steps_type
     return m_builder.llp_steps();
 }
 
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::get_leiden_resolution() const
+    -> resolution_type
+{
+    return m_builder.leiden_resolution();
+}
+
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::get_leiden_iterations() const
+    -> iterations_type
+{
+    return m_builder.leiden_iterations();
+}
+
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::get_mce_min_clique_size() const
+    -> clique_size_type
+{
+    return m_builder.mce_min_clique_size();
+}
+
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::get_mce_max_cliques() const
+    -> clique_count_type
+{
+    return m_builder.mce_max_cliques();
+}
+
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::get_mce_time_limit() const
+    -> seconds_type
+{
+    return m_builder.mce_time_limit();
+}
+
 template < typename Graph, typename WeightMap >
 auto cluster(const backend< Graph, WeightMap >& b) ->
     typename backend< Graph, WeightMap >::cluster_map_type;
@@ -406,6 +531,66 @@ inline auto backend< Graph, WeightMap >::update_llp_steps(steps_type steps)
     emit_llp_steps();
 }
 
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::update_leiden_resolution(
+    resolution_type resolution) -> void
+{
+    set_leiden_resolution(resolution);
+    emit_leiden_resolution();
+}
+
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::update_leiden_iterations(
+    iterations_type iterations) -> void
+{
+    set_leiden_iterations(iterations);
+    emit_leiden_iterations();
+}
+
+template < typename Graph, typename WeightMap >
+inline auto
+backend< Graph, WeightMap >::update_mce_min_clique_size(clique_size_type n)
+    -> void
+{
+    if (n < 1)
+    {
+        BOOST_LOG_TRIVIAL(warning) << "ignoring invalid min clique size: " << n;
+        return;
+    }
+
+    set_mce_min_clique_size(n);
+    emit_mce_min_clique_size();
+}
+
+template < typename Graph, typename WeightMap >
+inline auto
+backend< Graph, WeightMap >::update_mce_max_cliques(clique_count_type n)
+    -> void
+{
+    if (n < 1)
+    {
+        BOOST_LOG_TRIVIAL(warning) << "ignoring invalid max cliques: " << n;
+        return;
+    }
+
+    set_mce_max_cliques(n);
+    emit_mce_max_cliques();
+}
+
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::update_mce_time_limit(
+    seconds_type secs) -> void
+{
+    if (!(secs > 0))
+    {
+        BOOST_LOG_TRIVIAL(warning) << "ignoring invalid time limit: " << secs;
+        return;
+    }
+
+    set_mce_time_limit(secs);
+    emit_mce_time_limit();
+}
+
 template < typename Graph, typename WeightMap >
 inline auto
 backend< Graph, WeightMap >::connect_to_clusters(const clusters_slot& f)
@@ -477,6 +662,42 @@ backend< Graph, WeightMap >::connect_to_llp_steps(const steps_slot& f)
     return m_llp_steps_sig.connect(f);
 }
 
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::connect_to_leiden_resolution(
+    const resolution_slot& f) -> connection
+{
+    return m_leiden_resolution_sig.connect(f);
+}
+
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::connect_to_leiden_iterations(
+    const iterations_slot& f) -> connection
+{
+    return m_leiden_iterations_sig.connect(f);
+}
+
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::connect_to_mce_min_clique_size(
+    const clique_size_slot& f) -> connection
+{
+    return m_mce_min_size_sig.connect(f);
+}
+
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::connect_to_mce_max_cliques(
+    const clique_count_slot& f) -> connection
+{
+    return m_mce_max_cliques_sig.connect(f);
+}
+
+template < typename Graph, typename WeightMap >
+inline auto
+backend< Graph, WeightMap >::connect_to_mce_time_limit(const seconds_slot& f)
+    -> connection
+{
+    return m_mce_time_limit_sig.connect(f);
+}
+
 template < typename Graph, typename WeightMap >
 inline auto backend< Graph, WeightMap >::set_clusters(cluster_map_type clusters)
     -> void
@@ -535,6 +756,44 @@ inline auto backend< Graph, WeightMap >::set_llp_steps(steps_type steps) -> void
     m_builder.set_llp_steps(steps);
 }
 
+template < typename Graph, typename WeightMap >
+inline auto
+backend< Graph, WeightMap >::set_leiden_resolution(resolution_type resolution)
+    -> void
+{
+    m_builder.set_leiden_resolution(resolution);
+}
+
+template < typename Graph, typename WeightMap >
+inline auto
+backend< Graph, WeightMap >::set_leiden_iterations(iterations_type iterations)
+    -> void
+{
+    m_builder.set_leiden_iterations(iterations);
+}
+
+template < typename Graph, typename WeightMap >
+inline auto
+backend< Graph, WeightMap >::set_mce_min_clique_size(clique_size_type n)
+    -> void
+{
+    m_builder.set_mce_min_clique_size(n);
+}
+
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::set_mce_max_cliques(
+    clique_count_type n) -> void
+{
+    m_builder.set_mce_max_cliques(n);
+}
+
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::set_mce_time_limit(seconds_type secs)
+    -> void
+{
+    m_builder.set_mce_time_limit(secs);
+}
+
 template < typename Graph, typename WeightMap >
 inline auto backend< Graph, WeightMap >::emit_clusters() const -> void
 {
@@ -589,6 +848,37 @@ inline auto backend< Graph, WeightMap >::emit_llp_steps() const -> void
     m_llp_steps_sig(get_llp_steps());
 }
 
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::emit_leiden_resolution() const -> void
+{
+    m_leiden_resolution_sig(get_leiden_resolution());
+}
+
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::emit_leiden_iterations() const -> void
+{
+    m_leiden_iterations_sig(get_leiden_iterations());
+}
+
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::emit_mce_min_clique_size() const
+    -> void
+{
+    m_mce_min_size_sig(get_mce_min_clique_size());
+}
+
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::emit_mce_max_cliques() const -> void
+{
+    m_mce_max_cliques_sig(get_mce_max_cliques());
+}
+
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::emit_mce_time_limit() const -> void
+{
+    m_mce_time_limit_sig(get_mce_time_limit());
+}
+
 /***********************************************************
  * Utilites                                                *
  ***********************************************************/
@@ -669,6 +959,36 @@ inline auto get_llp_steps(const backend< Graph, WeightMap >& b)
     return b.get_llp_steps();
 }
 
+template < typename Graph, typename WeightMap >
+inline auto get_leiden_resolution(const backend< Graph, WeightMap >& b)
+{
+    return b.get_leiden_resolution();
+}
+
+template < typename Graph, typename WeightMap >
+inline auto get_leiden_iterations(const backend< Graph, WeightMap >& b)
+{
+    return b.get_leiden_iterations();
+}
+
+template < typename Graph, typename WeightMap >
+inline auto get_mce_min_clique_size(const backend< Graph, WeightMap >& b)
+{
+    return b.get_mce_min_clique_size();
+}
+
+template < typename Graph, typename WeightMap >
+inline auto get_mce_max_cliques(const backend< Graph, WeightMap >& b)
+{
+    return b.get_mce_max_cliques();
+}
+
+template < typename Graph, typename WeightMap >
+inline auto get_mce_time_limit(const backend< Graph, WeightMap >& b)
+{
+    return b.get_mce_time_limit();
+}
+
 template < typename Graph, typename WeightMap >
 inline auto update_clusters(backend< Graph, WeightMap >& b)
 {
@@ -747,6 +1067,46 @@ inline auto update_llp_steps(
     b.update_llp_steps(steps);
 }
 
+template < typename Graph, typename WeightMap >
+inline auto update_leiden_resolution(
+    backend< Graph, WeightMap >& b,
+    typename backend< Graph, WeightMap >::resolution_type resolution)
+{
+    b.update_leiden_resolution(resolution);
+}
+
+template < typename Graph, typename WeightMap >
+inline auto update_leiden_iterations(
+    backend< Graph, WeightMap >& b,
+    typename backend< Graph, WeightMap >::iterations_type iterations)
+{
+    b.update_leiden_iterations(iterations);
+}
+
+template < typename Graph, typename WeightMap >
+inline auto update_mce_min_clique_size(
+    backend< Graph, WeightMap >& b,
+    typename backend< Graph, WeightMap >::clique_size_type n)
+{
+    b.update_mce_min_clique_size(n);
+}
+
+template < typename Graph, typename WeightMap >
+inline auto update_mce_max_cliques(
+    backend< Graph, WeightMap >& b,
+    typename backend< Graph, WeightMap >::clique_count_type n)
+{
+    b.update_mce_max_cliques(n);
+}
+
+template < typename Graph, typename WeightMap >
+inline auto update_mce_time_limit(
+    backend< Graph, WeightMap >& b,
+    typename backend< Graph, WeightMap >::seconds_type secs)
+{
+    b.update_mce_time_limit(secs);
+}
+
 template < typename Graph, typename WeightMap >
 inline auto restore_defaults(backend< Graph, WeightMap >& b)
 {
@@ -756,6 +1116,11 @@ inline auto restore_defaults(backend< Graph, WeightMap >& b)
     update_min_modularity(b, b.config_data().min_modularity);
     update_llp_gamma(b, b.config_data().llp_gamma);
     update_llp_steps(b, b.config_data().llp_steps);
+    update_leiden_resolution(b, b.config_data().leiden_resolution);
+    update_leiden_iterations(b, b.config_data().leiden_iterations);
+    update_mce_min_clique_size(b, b.config_data().mce_min_clique_size);
+    update_mce_max_cliques(b, b.config_data().mce_max_cliques);
+    update_mce_time_limit(b, b.config_data().mce_time_limit);
     update_intensity(b, b.config_data().intensity);
     update_clusterer(b, b.config_data().clusterer);
 }
@@ -777,6 +1142,12 @@ inline auto export_configs(const backend< Graph, WeightMap >& b)
     cfg.min_modularity = get_min_modularity(b);
     cfg.llp_gamma = get_llp_gamma(b);
     cfg.llp_steps = get_llp_steps(b);
+    cfg.leiden_resolution = get_leiden_resolution(b);
+    cfg.leiden_iterations = get_leiden_iterations(b);
+    cfg.mce_min_clique_size = get_mce_min_clique_size(b);
+    cfg.mce_max_cliques = get_mce_max_cliques(b);
+    cfg.mce_time_limit = get_mce_time_limit(b);
+    cfg.seed = b.config_data().seed; // cannot update with gui
 
     return cfg;
 }
@@ -25,7 +25,12 @@ auto default_backend_config() -> backend_config
                             .snn_threshold = 3,
                             .min_modularity = 0.5,
                             .llp_gamma = 0,
-                            .llp_steps = 1 };
+                            .llp_steps = 1,
+                            .leiden_resolution = 1,
+                            .leiden_iterations = 2,
+                            .mce_min_clique_size = 2,
+                            .mce_max_cliques = 100000,
+                            .mce_time_limit = 10 };
 }
 
 auto are_clusterers_plugged_in(const backend_config& cfg) -> bool
@@ -26,6 +26,12 @@ struct backend_config
     using modularity_type = float;
     using gamma_type = float;
     using steps_type = int;
+    using resolution_type = float;
+    using iterations_type = int;
+    using clique_size_type = int;
+    using clique_count_type = int;
+    using seconds_type = float;
+    using seed_type = unsigned int;
 
     ids_type clusterers;
     ids_type mst_finders;
@@ -38,6 +44,12 @@ struct backend_config
     modularity_type min_modularity;
     gamma_type llp_gamma;
     steps_type llp_steps;
+    resolution_type leiden_resolution { 1 };
+    iterations_type leiden_iterations { 2 };
+    clique_size_type mce_min_clique_size { 2 };
+    clique_count_type mce_max_cliques { 100000 };
+    seconds_type mce_time_limit { 10 };
+    seed_type seed { 0 };
 
     auto operator==(const backend_config&) const -> bool = default;
     auto operator!=(const backend_config&) const -> bool = default;
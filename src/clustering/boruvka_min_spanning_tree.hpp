@@ -0,0 +1,77 @@
+// Contains the Boruvka's algorithm min_spanning_tree_finder implementation.
+// Soultatos Stefanos 2022
+
+#ifndef CLUSTERING_BORUVKA_MIN_SPANNING_TREE_HPP
+#define CLUSTERING_BORUVKA_MIN_SPANNING_TREE_HPP
+
+#include "detail/boruvka_min_spanning_tree.hpp" // for minimum_spanning_tree
+#include "min_spanning_tree_finder.hpp"        // for min_spanning_tree_finder
+#include "plugin.hpp"                          // for id_t
+
+#include <memory> // for unique_ptr
+
+namespace clustering
+{
+
+/***********************************************************
+ * Boruvka Minimum Spanning Tree                           *
+ ***********************************************************/
+
+// Boruvka mst algorithm.
+// Contracts the components of the graph along their cheapest edges, in
+// parallel rounds, over a flat edge array, so that large graphs are spanned on
+// multiple threads.
+// See: https://en.wikipedia.org/wiki/Bor%C5%AFvka%27s_algorithm
+template < typename Graph, typename WeightMap >
+class boruvka_min_spanning_tree
+: public min_spanning_tree_finder< Graph, WeightMap >
+{
+    using base = min_spanning_tree_finder< Graph, WeightMap >;
+    using self = boruvka_min_spanning_tree< Graph, WeightMap >;
+    using graph_traits = boost::graph_traits< Graph >;
+
+public:
+    using id_type = typename base::id_type;
+    using graph_type = Graph;
+    using weight_map_type = WeightMap;
+    using edge_type = typename graph_traits::edge_descriptor;
+
+    using spanning_tree = typename base::spanning_tree;
+    using output_iterator = typename base::output_iterator;
+
+    boruvka_min_spanning_tree() = default;
+    ~boruvka_min_spanning_tree() override = default;
+
+    auto id() const -> id_type override { return boruvka_mst_id; }
+
+    void operator()(
+        const graph_type& g,
+        output_iterator out,
+        weight_map_type edge_weight) const override;
+
+    auto clone() const -> std::unique_ptr< base > override;
+};
+
+/***********************************************************
+ * Definitions                                             *
+ ***********************************************************/
+
+template < typename Graph, typename WeightMap >
+inline auto boruvka_min_spanning_tree< Graph, WeightMap >::operator()(
+    const graph_type& g,
+    output_iterator out,
+    weight_map_type edge_weight) const -> void
+{
+    boruvka_detail::minimum_spanning_tree(g, out, edge_weight);
+}
+
+template < typename Graph, typename WeightMap >
+inline auto boruvka_min_spanning_tree< Graph, WeightMap >::clone() const
+    -> std::unique_ptr< base >
+{
+    return std::make_unique< self >(*this);
+}
+
+} // namespace clustering
+
+#endif // CLUSTERING_BORUVKA_MIN_SPANNING_TREE_HPP
@@ -7,14 +7,17 @@
 #include "infomap_clusterer.hpp"         // for infomap_clusterer
 #include "k_spanning_tree_clusterer.hpp" // for k_spanning_tree_clusterer
 #include "layered_label_propagation_clusterer.hpp" // for layered_label_propagation_clusterer
+#include "leiden_clusterer.hpp"         // for leiden_clusterer
 #include "louvain_method_clusterer.hpp" // for louvain_method_clusterer
 #include "maximal_clique_enumeration_clusterer.hpp" // for maximal_clique_enumeration_clusterer
+#include "misc/random.hpp"                          // for seed_type
 #include "plugin.hpp"                               // for id_t
 #include "shared_nearest_neighbour_clusterer.hpp" // for shared_nearest_neighbour_clusterer
 #include "strong_components_clusterer.hpp" // for strong_components_clusterer
 
 #include <boost/graph/graph_concepts.hpp> // for GraphConcept
 #include <boost/log/trivial.hpp>          // BOOST_LOG_TRIVIAL
+#include <cassert>                        // for assert
 #include <memory>                         // for unique_ptr
 
 namespace clustering
@@ -49,6 +52,12 @@ public:
     using modularity_type = float;
     using gamma_type = float;
     using steps_type = int;
+    using resolution_type = float;
+    using iterations_type = int;
+    using clique_size_type = int;
+    using clique_count_type = int;
+    using seconds_type = float;
+    using seed_type = misc::seed_type;
 
     clusterer_builder(const graph_type& g, weight_map_type edge_weight);
 
@@ -60,6 +69,12 @@ public:
     auto min_modularity() const -> modularity_type;
     auto llp_gamma() const -> gamma_type;
     auto llp_steps() const -> steps_type;
+    auto leiden_resolution() const -> resolution_type;
+    auto leiden_iterations() const -> iterations_type;
+    auto mce_min_clique_size() const -> clique_size_type;
+    auto mce_max_cliques() const -> clique_count_type;
+    auto mce_time_limit() const -> seconds_type;
+    auto seed() const -> seed_type;
 
     auto set_mst_finder(std::unique_ptr< mst_finder_type > finder) -> self&;
     auto set_k(k_type k) -> self&;
@@ -67,6 +82,12 @@ public:
     auto set_min_modularity(modularity_type min) -> self&;
     auto set_llp_gamma(gamma_type gamma) -> self&;
     auto set_llp_steps(steps_type steps) -> self&;
+    auto set_leiden_resolution(resolution_type resolution) -> self&;
+    auto set_leiden_iterations(iterations_type iterations) -> self&;
+    auto set_mce_min_clique_size(clique_size_type n) -> self&;
+    auto set_mce_max_cliques(clique_count_type n) -> self&;
+    auto set_mce_time_limit(seconds_type secs) -> self&;
+    auto set_seed(seed_type seed) -> self&;
 
     auto result(id_type id) const -> pointer;
 
@@ -78,6 +99,7 @@ private:
     using louvain_method_type = louvain_method_clusterer< Graph, WeightMap >;
     using llp_type = layered_label_propagation_clusterer< Graph, WeightMap >;
     using infomap_type = infomap_clusterer< Graph, WeightMap >;
+    using leiden_type = leiden_clusterer< Graph, WeightMap >;
 
     const graph_type& m_g;
     weight_map_type m_edge_weight;
@@ -89,6 +111,7 @@ private:
     louvain_method_type m_louvain_method;
     llp_type m_llp;
     infomap_type m_infomap;
+    leiden_type m_leiden;
 };
 
 /***********************************************************
@@ -105,6 +128,7 @@ inline clusterer_builder< Graph, WeightMap >::clusterer_builder(
 , m_louvain_method { edge_weight }
 , m_llp { edge_weight }
 , m_infomap { edge_weight }
+, m_leiden { edge_weight }
 {
 }
 
@@ -149,6 +173,49 @@ inline auto clusterer_builder< Graph, WeightMap >::llp_steps() const
     return m_llp.steps();
 }
 
+template < typename Graph, typename WeightMap >
+inline auto clusterer_builder< Graph, WeightMap >::leiden_resolution() const
+    -> resolution_type
+{
+    return m_leiden.resolution();
+}
+
+template < typename Graph, typename WeightMap >
+inline auto clusterer_builder< Graph, WeightMap >::leiden_iterations() const
+    -> iterations_type
+{
+    return m_leiden.iterations();
+}
+
+template < typename Graph, typename WeightMap >
+inline auto clusterer_builder< Graph, WeightMap >::mce_min_clique_size() const
+    -> clique_size_type
+{
+    return m_max_clique_enum.min_clique_size();
+}
+
+template < typename Graph, typename WeightMap >
+inline auto clusterer_builder< Graph, WeightMap >::mce_max_cliques() const
+    -> clique_count_type
+{
+    return m_max_clique_enum.max_cliques();
+}
+
+template < typename Graph, typename WeightMap >
+inline auto clusterer_builder< Graph, WeightMap >::mce_time_limit() const
+    -> seconds_type
+{
+    return m_max_clique_enum.time_limit();
+}
+
+template < typename Graph, typename WeightMap >
+inline auto clusterer_builder< Graph, WeightMap >::seed() const -> seed_type
+{
+    assert(m_louvain_method.seed() == m_llp.seed());
+    assert(m_louvain_method.seed() == m_leiden.seed());
+    return m_llp.seed();
+}
+
 template < typename Graph, typename WeightMap >
 inline auto clusterer_builder< Graph, WeightMap >::set_k(k_type k) -> self&
 {
@@ -197,6 +264,58 @@ clusterer_builder< Graph, WeightMap >::set_llp_steps(steps_type steps) -> self&
     return *this;
 }
 
+template < typename Graph, typename WeightMap >
+inline auto clusterer_builder< Graph, WeightMap >::set_leiden_resolution(
+    resolution_type resolution) -> self&
+{
+    m_leiden.set_resolution(resolution);
+    return *this;
+}
+
+template < typename Graph, typename WeightMap >
+inline auto clusterer_builder< Graph, WeightMap >::set_leiden_iterations(
+    iterations_type iterations) -> self&
+{
+    m_leiden.set_iterations(iterations);
+    return *this;
+}
+
+template < typename Graph, typename WeightMap >
+inline auto clusterer_builder< Graph, WeightMap >::set_mce_min_clique_size(
+    clique_size_type n) -> self&
+{
+    m_max_clique_enum.set_min_clique_size(n);
+    return *this;
+}
+
+template < typename Graph, typename WeightMap >
+inline auto
+clusterer_builder< Graph, WeightMap >::set_mce_max_cliques(clique_count_type n)
+    -> self&
+{
+    m_max_clique_enum.set_max_cliques(n);
+    return *this;
+}
+
+template < typename Graph, typename WeightMap >
+inline auto
+clusterer_builder< Graph, WeightMap >::set_mce_time_limit(seconds_type secs)
+    -> self&
+{
+    m_max_clique_enum.set_time_limit(secs);
+    return *this;
+}
+
+template < typename Graph, typename WeightMap >
+inline auto clusterer_builder< Graph, WeightMap >::set_seed(seed_type seed)
+    -> self&
+{
+    m_louvain_method.set_seed(seed);
+    m_llp.set_seed(seed);
+    m_leiden.set_seed(seed);
+    return *this;
+}
+
 template < typename Graph, typename WeightMap >
 inline auto clusterer_builder< Graph, WeightMap >::result(id_type id) const
     -> pointer
@@ -229,6 +348,10 @@ inline auto clusterer_builder< Graph, WeightMap >::result(id_type id) const
     {
         return &m_infomap;
     }
+    else if (id == leiden_clusterer_id)
+    {
+        return &m_leiden;
+    }
     else
     {
         assert(!is_clusterer_plugged_in(id));
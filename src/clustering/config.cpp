@@ -40,6 +40,12 @@ auto deserialize(const json_val& root) -> config_data
     using modularity_type = config_data::modularity_type;
     using gamma_type = config_data::gamma_type;
     using steps_type = config_data::steps_type;
+    using resolution_type = config_data::resolution_type;
+    using iterations_type = config_data::iterations_type;
+    using clique_size_type = config_data::clique_size_type;
+    using clique_count_type = config_data::clique_count_type;
+    using seconds_type = config_data::seconds_type;
+    using seed_type = config_data::seed_type;
 
     auto&& clusterers = deserialize_ids(get(root, "clusterers"));
     auto&& mst_finders
@@ -57,6 +63,20 @@ auto deserialize(const json_val& root) -> config_data
     auto llp_gamma = as< double >(get(root, "llp-gamma"));
     auto llp_steps = as< steps_type >(get(root, "llp-steps"));
 
+    static_assert(std::is_floating_point_v< resolution_type >);
+    auto leiden_res = as< double >(get(root, "leiden-resolution"));
+    auto leiden_its = as< iterations_type >(get(root, "leiden-iterations"));
+
+    auto mce_min_size
+        = as< clique_size_type >(get(root, "mce-min-clique-size"));
+    auto mce_max_cliques
+        = as< clique_count_type >(get(root, "mce-max-cliques"));
+
+    static_assert(std::is_floating_point_v< seconds_type >);
+    auto mce_time_limit = as< double >(get(root, "mce-time-limit"));
+
+    auto seed = as< seed_type >(get(root, "seed"));
+
     return config_data { .clusterers = std::move(clusterers),
                          .mst_finders = std::move(mst_finders),
                          .clusterer = std::move(clusterer),
@@ -67,7 +87,15 @@ auto deserialize(const json_val& root) -> config_data
                          .min_modularity
                          = static_cast< modularity_type >(min_q),
                          .llp_gamma = static_cast< gamma_type >(llp_gamma),
-                         .llp_steps = llp_steps };
+                         .llp_steps = llp_steps,
+                         .leiden_resolution
+                         = static_cast< resolution_type >(leiden_res),
+                         .leiden_iterations = leiden_its,
+                         .mce_min_clique_size = mce_min_size,
+                         .mce_max_cliques = mce_max_cliques,
+                         .mce_time_limit
+                         = static_cast< seconds_type >(mce_time_limit),
+                         .seed = seed };
 }
 
 namespace
@@ -93,6 +121,12 @@ auto serialize(json_val& root, const config_data& cfg) -> void
     root["min-modularity"] = cfg.min_modularity;
     root["llp-gamma"] = cfg.llp_gamma;
     root["llp-steps"] = cfg.llp_steps;
+    root["leiden-resolution"] = cfg.leiden_resolution;
+    root["leiden-iterations"] = cfg.leiden_iterations;
+    root["mce-min-clique-size"] = cfg.mce_min_clique_size;
+    root["mce-max-cliques"] = cfg.mce_max_cliques;
+    root["mce-time-limit"] = cfg.mce_time_limit;
+    root["seed"] = cfg.seed;
 
     BOOST_LOG_TRIVIAL(debug) << "serialized clustering";
 }
@@ -0,0 +1,269 @@
+// Contains a private module for the parallel Boruvka minimum spanning tree
+// implementation.
+// Soultatos Stefanos 2022
+
+#ifndef CLUSTERING_DETAIL_BORUVKA_MIN_SPANNING_TREE_HPP
+#define CLUSTERING_DETAIL_BORUVKA_MIN_SPANNING_TREE_HPP
+
+#include "misc/parallel.hpp" // for parallel_for, hardware_concurrency
+
+#include <algorithm>                      // for min, max
+#include <atomic>                         // for atomic_ref, memory_order
+#include <boost/graph/adjacency_list.hpp> // for edges, source, target, etc
+#include <cassert>                        // for assert
+#include <cstddef>                        // for size_t
+#include <limits>                         // for numeric_limits
+#include <numeric>                        // for iota, partial_sum
+#include <utility>                        // for exchange, swap
+#include <vector>                         // for vector, erase_if
+
+namespace clustering::boruvka_detail
+{
+
+constexpr auto nil = std::numeric_limits< std::size_t >::max();
+
+// Minimum number of edges, scanned on multiple threads.
+constexpr std::size_t min_parallel_edges = 16384;
+
+/***********************************************************
+ * Edge List                                               *
+ ***********************************************************/
+
+// The edges of a graph, in flat arrays, along with their (materialized)
+// weights, indexed by the vertex indices of the graph.
+template < typename Weight >
+struct edge_list
+{
+    using weight_type = Weight;
+
+    std::vector< std::size_t > source;
+    std::vector< std::size_t > target;
+    std::vector< weight_type > weight;
+
+    auto size() const -> std::size_t { return weight.size(); }
+
+    // Ties are broken by index, so that the minimum spanning tree is unique.
+    auto lighter(std::size_t i, std::size_t j) const -> bool
+    {
+        return weight[i] < weight[j] or (weight[i] == weight[j] and i < j);
+    }
+};
+
+// Makes the edge list of a graph, along with the descriptor of each edge, in
+// O(E).
+template < typename Graph, typename WeightMap, typename EdgeVector >
+auto make_edge_list(const Graph& g, WeightMap edge_weight, EdgeVector& edges)
+{
+    using weight_map_traits = boost::property_traits< WeightMap >;
+    using weight_type = typename weight_map_traits::value_type;
+
+    const auto index = boost::get(boost::vertex_index, g);
+    const auto m = static_cast< std::size_t >(boost::num_edges(g));
+
+    auto res = edge_list< weight_type >();
+    res.source.reserve(m);
+    res.target.reserve(m);
+    res.weight.reserve(m);
+    edges.reserve(m);
+
+    for (auto e : boost::make_iterator_range(boost::edges(g)))
+    {
+        res.source.push_back(
+            static_cast< std::size_t >(boost::get(index, boost::source(e, g))));
+        res.target.push_back(
+            static_cast< std::size_t >(boost::get(index, boost::target(e, g))));
+        res.weight.push_back(boost::get(edge_weight, e));
+        edges.push_back(e);
+    }
+
+    return res;
+}
+
+/***********************************************************
+ * Rounds                                                  *
+ ***********************************************************/
+
+// Lowers the cheapest edge of a component to an edge, if lighter, lock free.
+template < typename Weight >
+inline auto lower_cheapest(
+    const edge_list< Weight >& edges,
+    std::size_t& cheapest,
+    std::size_t i) -> void
+{
+    auto ref = std::atomic_ref< std::size_t >(cheapest);
+    auto current = ref.load(std::memory_order_relaxed);
+
+    while ((current == nil or edges.lighter(i, current))
+           and !ref.compare_exchange_weak(
+               current, i, std::memory_order_relaxed))
+        ;
+}
+
+// Keeps, in order, the indices of a vector that satisfy a predicate, in
+// parallel, in O(n).
+template < typename UnaryPredicate >
+auto parallel_filter(
+    const std::vector< std::size_t >& from,
+    std::vector< std::size_t >& to,
+    UnaryPredicate pred,
+    unsigned num_threads) -> void
+{
+    const auto chunks = std::max(1u, num_threads);
+    const auto n = from.size();
+
+    const auto chunk_first = [n, chunks](unsigned c) { return n * c / chunks; };
+
+    auto offsets = std::vector< std::size_t >(chunks + 1, 0);
+
+    misc::parallel_for(
+        0u,
+        chunks,
+        [&](auto c)
+        {
+            for (auto i = chunk_first(c); i != chunk_first(c + 1); ++i)
+                offsets[c + 1] += pred(from[i]);
+        },
+        num_threads);
+
+    std::partial_sum(
+        std::begin(offsets), std::end(offsets), std::begin(offsets));
+
+    to.resize(offsets.back());
+
+    misc::parallel_for(
+        0u,
+        chunks,
+        [&](auto c)
+        {
+            auto out = offsets[c];
+
+            for (auto i = chunk_first(c); i != chunk_first(c + 1); ++i)
+                if (pred(from[i]))
+                    to[out++] = from[i];
+        },
+        num_threads);
+}
+
+// Finds the minimum spanning forest of an edge list, over a number of vertices,
+// in O(log V) rounds of O(V + E) work.
+// Each round picks the cheapest edge of each component, in parallel, contracts
+// the components along these edges, and drops the edges within a component, in
+// parallel.
+// Returns the indices of the forest edges.
+// NOTE: The result does not depend on the number of threads.
+template < typename Weight >
+auto minimum_spanning_forest(
+    const edge_list< Weight >& edges,
+    std::size_t num_vertices,
+    unsigned num_threads) -> std::vector< std::size_t >
+{
+    auto res = std::vector< std::size_t >();
+
+    // The component of each vertex, (identified by a vertex).
+    auto component = std::vector< std::size_t >(num_vertices);
+    std::iota(std::begin(component), std::end(component), 0);
+
+    auto parent = component;
+    auto components = component;
+    auto cheapest = std::vector< std::size_t >(num_vertices, nil);
+
+    const auto find = [&parent](std::size_t c)
+    {
+        while (parent[c] != c)
+            c = parent[c] = parent[parent[c]];
+        return c;
+    };
+
+    const auto crosses = [&edges, &component](std::size_t i)
+    { return component[edges.source[i]] != component[edges.target[i]]; };
+
+    // The edges between different components.
+    auto active = std::vector< std::size_t >(edges.size());
+    std::iota(std::begin(active), std::end(active), 0);
+
+    auto next = std::vector< std::size_t >();
+    parallel_filter(active, next, crosses, num_threads);
+    std::swap(active, next);
+
+    while (!active.empty())
+    {
+        misc::parallel_for(
+            std::size_t(0),
+            active.size(),
+            [&](auto j)
+            {
+                const auto i = active[j];
+                lower_cheapest(edges, cheapest[component[edges.source[i]]], i);
+                lower_cheapest(edges, cheapest[component[edges.target[i]]], i);
+            },
+            num_threads);
+
+        for (auto c : components)
+        {
+            const auto i = std::exchange(cheapest[c], nil);
+            if (i == nil)
+                continue;
+
+            const auto s = find(component[edges.source[i]]);
+            const auto t = find(component[edges.target[i]]);
+
+            // Picked by both of its components.
+            if (s == t)
+                continue;
+
+            parent[std::max(s, t)] = std::min(s, t);
+            res.push_back(i);
+        }
+
+        for (auto c : components)
+            parent[c] = find(c);
+
+        std::erase_if(components, [&parent](auto c) { return parent[c] != c; });
+
+        misc::parallel_for(
+            std::size_t(0),
+            num_vertices,
+            [&](auto u) { component[u] = parent[component[u]]; },
+            num_threads);
+
+        parallel_filter(active, next, crosses, num_threads);
+        std::swap(active, next);
+    }
+
+    return res;
+}
+
+/***********************************************************
+ * Minimum Spanning Tree                                   *
+ ***********************************************************/
+
+// Finds the minimum spanning tree, (or forest), of a graph, on multiple
+// threads, for large graphs.
+template < typename Graph, typename OutputIterator, typename WeightMap >
+auto minimum_spanning_tree(
+    const Graph& g,
+    OutputIterator out,
+    WeightMap edge_weight) -> OutputIterator
+{
+    using graph_traits = boost::graph_traits< Graph >;
+    using edge_type = typename graph_traits::edge_descriptor;
+
+    auto descriptors = std::vector< edge_type >();
+    const auto edges = make_edge_list(g, edge_weight, descriptors);
+
+    const auto num_threads = edges.size() >= min_parallel_edges
+        ? misc::hardware_concurrency()
+        : 1u;
+
+    for (auto i : minimum_spanning_forest(
+             edges,
+             static_cast< std::size_t >(boost::num_vertices(g)),
+             num_threads))
+        *out++ = descriptors[i];
+
+    return out;
+}
+
+} // namespace clustering::boruvka_detail
+
+#endif // CLUSTERING_DETAIL_BORUVKA_MIN_SPANNING_TREE_HPP
@@ -4,34 +4,104 @@
 #ifndef CLUSTERING_DETAIL_K_SPANNING_TREE_CLUSTERING_HPP
 #define CLUSTERING_DETAIL_K_SPANNING_TREE_CLUSTERING_HPP
 
-#include <algorithm>                      // for max_element, etc
-#include <boost/graph/adjacency_list.hpp> // for vertices, etc
+#include <algorithm>                       // for nth_element, min
+#include <boost/graph/adjacency_list.hpp>  // for vertices, etc
+#include <boost/pending/disjoint_sets.hpp> // for disjoint_sets_with_storage
+#include <cassert>                         // for assert
+#include <cstddef>                         // for size_t
+#include <iterator>                        // for next
+#include <vector>                          // for vector
 
 namespace clustering::detail
 {
 
-// Returns the max weighted edge of an edge set.
-template < typename EdgeSet, typename WeightMap >
-inline auto max_weighted(const EdgeSet& edges, WeightMap edge_weight)
+// Moves the (at most) n heaviest edges of an edge range to its front, in
+// O(E).
+// Returns the number of moved edges.
+template < typename EdgeRange, typename WeightMap >
+inline auto
+select_heaviest(EdgeRange& edges, std::size_t n, WeightMap edge_weight)
+    -> std::size_t
 {
-    return std::max_element(
-        std::cbegin(edges),
-        std::cend(edges),
+    n = std::min(n, static_cast< std::size_t >(std::size(edges)));
+
+    if (n == 0)
+        return 0;
+
+    std::nth_element(
+        std::begin(edges),
+        std::next(std::begin(edges), n - 1),
+        std::end(edges),
         [edge_weight](auto lhs, auto rhs) {
-            return boost::get(edge_weight, lhs) < boost::get(edge_weight, rhs);
+            return boost::get(edge_weight, lhs) > boost::get(edge_weight, rhs);
         });
+
+    return n;
+}
+
+// Joins the vertices of each edge of an edge range, in O(V + E a(V)).
+// Returns the (vertex indexed) component of each vertex.
+template < typename Graph, typename EdgeIterator >
+inline auto connected_components(
+    const Graph& g,
+    EdgeIterator first,
+    EdgeIterator last) -> std::vector< std::size_t >
+{
+    const auto n = static_cast< std::size_t >(boost::num_vertices(g));
+    const auto index = boost::get(boost::vertex_index, g);
+
+    auto sets = boost::disjoint_sets_with_storage<>(n);
+
+    for (std::size_t u = 0; u < n; ++u)
+        sets.make_set(u);
+
+    for (; first != last; ++first)
+        sets.union_set(
+            static_cast< std::size_t >(
+                boost::get(index, boost::source(*first, g))),
+            static_cast< std::size_t >(
+                boost::get(index, boost::target(*first, g))));
+
+    auto res = std::vector< std::size_t >(n);
+
+    for (std::size_t u = 0; u < n; ++u)
+        res[u] = sets.find_set(u);
+
+    return res;
 }
 
-// Returns true if vertex is referenced by any edge of an edge set.
-template < typename Graph, typename EdgeSet, typename Vertex >
-inline auto is_referenced(const Graph& g, const EdgeSet& edges, Vertex v)
+// Assigns the vertices to their component clusters, in O(V).
+// The vertices of every tree, (of more than one vertex), are assigned to
+// cluster 0, while the isolated vertices are assigned to clusters 1, 2, ...,
+// in order of appearance.
+template < typename Graph, typename ClusterMap >
+inline auto cluster_from_components(
+    const Graph& g,
+    const std::vector< std::size_t >& component,
+    ClusterMap vertex_cluster) -> void
 {
-    return std::find_if(
-               std::cbegin(edges),
-               std::cend(edges),
-               [v, &g](auto e)
-               { return boost::source(e, g) == v or boost::target(e, g) == v; })
-        != std::cend(edges);
+    using cluster_map_traits = boost::property_traits< ClusterMap >;
+    using cluster_type = typename cluster_map_traits::value_type;
+
+    constexpr cluster_type mst_cluster = 0;
+
+    const auto index = boost::get(boost::vertex_index, g);
+
+    auto size = std::vector< std::size_t >(component.size(), 0);
+    for (auto com : component)
+        ++size[com];
+
+    cluster_type isolated_cluster = mst_cluster + 1;
+
+    for (auto v : boost::make_iterator_range(boost::vertices(g)))
+    {
+        assert(isolated_cluster != mst_cluster);
+
+        if (size[component[boost::get(index, v)]] > 1)
+            boost::put(vertex_cluster, v, mst_cluster);
+        else
+            boost::put(vertex_cluster, v, isolated_cluster++);
+    }
 }
 
 } // namespace clustering::detail
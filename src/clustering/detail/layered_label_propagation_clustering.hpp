@@ -4,15 +4,20 @@
 #ifndef CLUSTERING_DETAIL_LAYERED_LABEL_PROPAGATION_CLUSTERING_HPP
 #define CLUSTERING_DETAIL_LAYERED_LABEL_PROPAGATION_CLUSTERING_HPP
 
-#include "misc/concepts.hpp" // for arithmetic
-#include "misc/random.hpp"   // for rng
+#include "misc/parallel.hpp" // for parallel_for_each_chunk
 
-#include <algorithm>                      // for find, etc
-#include <boost/graph/adjacency_list.hpp> // for vertices, etc
+#include <algorithm>                      // for sort, shuffle, min, max
+#include <boost/graph/adjacency_list.hpp> // for vertices, out_edges, etc
+#include <boost/graph/graph_concepts.hpp> // for GraphConcept
+#include <boost/graph/graph_utility.hpp>  // for has_no_vertices, has_no_edges
 #include <cassert>                        // for assert
+#include <concepts>                       // for floating_point, invocable
+#include <cstddef>                        // for size_t
 #include <limits>                         // for numeric_limits
-#include <ranges>                         // for values, keys
-#include <unordered_map>                  // for hash, unordered_map
+#include <numeric>                        // for iota
+#include <span>                           // for span
+#include <type_traits>                    // for is_convertible_v
+#include <utility>                        // for pair
 #include <vector>                         // for vector
 
 // NOTE: Based on .js implementation from:
@@ -22,288 +27,366 @@ namespace clustering::llp_detail
 {
 
 /***********************************************************
- * Utilities                                               *
+ * Network                                                 *
  ***********************************************************/
 
-// Emulate js: 'array[key] || alt' expression.
-// E.g: auto i = get_or(arr, 0, 0); -> let i = arr[0] || 0;
-template < typename AssociativeContainer >
-[[maybe_unused]] inline auto get_or(
-    const AssociativeContainer& data,
-    const typename AssociativeContainer::key_type& key,
-    const typename AssociativeContainer::mapped_type& alt)
+// The (out) adjacency of a graph, in compressed rows, indexed by the vertex
+// indices of the graph.
+struct network
 {
-    const auto pos = data.find(key);
-    return pos != std::cend(data) ? pos->second : alt;
-}
+    using weight_type = double;
+    using neighbour = std::pair< std::size_t, weight_type >;
 
-// Safe map access.
-// NOTE: Maybe use get_or(data, key, 0) here.
-template < typename AssociativeContainer >
-inline auto
-get(const AssociativeContainer& data,
-    const typename AssociativeContainer::key_type& key)
-{
-    const auto pos = data.find(key);
-    assert(pos != std::cend(data));
-    return pos->second;
-}
+    std::vector< std::size_t > offsets;
+    std::vector< neighbour > neighbours;
 
-// Returns a range of the keys of an associative container that are mapped with
-// the maximum value.
-template < typename AssociativeContainer >
-inline auto max_value_keys(const AssociativeContainer& data)
-{
-    assert(!data.empty());
-    const auto keys = std::ranges::views::keys(data);
-    const auto values = std::ranges::views::values(data);
-    assert(std::ranges::size(values) != 0);
-    const auto max_iter = std::ranges::max_element(values);
-    assert(max_iter != std::cend(values));
-    const auto& max = *max_iter;
-    const auto max_valued = [&](const auto& k) { return get(data, k) == max; };
-    return keys | std::ranges::views::filter(max_valued);
-}
+    auto num_vertices() const -> std::size_t
+    {
+        return offsets.empty() ? 0 : offsets.size() - 1;
+    }
 
-// Makes a vector from an input range.
-template < std::ranges::input_range InputRange >
-inline auto make_vector(InputRange range)
+    auto neighbours_of(std::size_t u) const -> std::span< const neighbour >
+    {
+        assert(u < num_vertices());
+        return std::span(neighbours)
+            .subspan(offsets[u], offsets[u + 1] - offsets[u]);
+    }
+};
+
+// Makes the network of a graph with weighted edges, in O(V + E).
+template < typename Graph, typename WeightMap >
+auto make_network(const Graph& g, WeightMap edge_weight) -> network
 {
-    using value_type = std::ranges::range_value_t< InputRange >;
-    return std::vector< value_type > { std::begin(range), std::end(range) };
+    const auto n = static_cast< std::size_t >(boost::num_vertices(g));
+    const auto index = boost::get(boost::vertex_index, g);
+
+    auto res = network();
+    res.offsets.assign(n + 1, 0);
+
+    for (auto u : boost::make_iterator_range(boost::vertices(g)))
+        res.offsets[boost::get(index, u) + 1] = boost::out_degree(u, g);
+
+    for (std::size_t u = 0; u < n; ++u)
+        res.offsets[u + 1] += res.offsets[u];
+
+    res.neighbours.resize(res.offsets.back());
+
+    for (auto u : boost::make_iterator_range(boost::vertices(g)))
+    {
+        auto i = res.offsets[boost::get(index, u)];
+
+        for (auto e : boost::make_iterator_range(boost::out_edges(u, g)))
+            res.neighbours[i++] = {
+                static_cast< std::size_t >(
+                    boost::get(index, boost::target(e, g))),
+                static_cast< network::weight_type >(
+                    boost::get(edge_weight, e))
+            };
+    }
+
+    return res;
 }
 
 /***********************************************************
- * Community/Network Properties                            *
+ * Communities                                             *
  ***********************************************************/
 
-// Shared community type traits.
-template < misc::arithmetic Community >
-struct community_traits
+// The community of each vertex, along with the number of members of each
+// community.
+// NOTE: The community ids are vertex ids, (of the network).
+struct communities
 {
-    using numeric_limits = std::numeric_limits< Community >;
-
-    static constexpr auto nil() -> Community { return -1; }
-    static constexpr auto first() -> Community { return 0; }
-    static constexpr auto last() -> Community { return numeric_limits::max(); }
+    std::vector< std::size_t > of_vertex;
+    std::vector< std::size_t > size;
 };
 
-// Advance community com. (Currently com <- com + 1).
-template < misc::arithmetic Community >
-constexpr auto community_advance(Community& com) -> void
+// Places each vertex to its own community, in O(V).
+inline auto make_singletons(std::size_t num_vertices) -> communities
 {
-    ++com;
+    auto res = communities { .of_vertex
+                             = std::vector< std::size_t >(num_vertices),
+                             .size
+                             = std::vector< std::size_t >(num_vertices, 1) };
+
+    std::iota(std::begin(res.of_vertex), std::end(res.of_vertex), 0);
+    return res;
 }
 
-// Network cache data, used for dynamic programming.
-// NOTE: Each storage type must be an associative container.
-template <
-    typename Vertex,
-    typename Community,
-    typename VertexCommunityStorage = std::unordered_map< Vertex, Community > >
-struct network_properties
+// Moves a vertex to a community, in O(1).
+inline auto move_vertex(communities& coms, std::size_t u, std::size_t com)
+    -> void
 {
-    using vertex_type = Vertex;
-    using community_type = Community;
-    using vertex_community_storage_type = VertexCommunityStorage;
+    assert(u < coms.of_vertex.size());
+    assert(com < coms.size.size());
 
-    // Linkage of each vertex to a community.
-    vertex_community_storage_type vertex_community;
+    auto& from = coms.of_vertex[u];
+    assert(coms.size[from] > 0);
 
-    auto operator==(const network_properties&) const -> bool = default;
-    auto operator!=(const network_properties&) const -> bool = default;
-};
+    --coms.size[from];
+    ++coms.size[com];
+    from = com;
+}
 
-// Initialize network properties before/after Louvain execution.
-// Factory for any given network and graph with weighted edges.
-template < typename NetworkProperties, typename Graph >
-auto network_status(const Graph& g) -> NetworkProperties
+// Renumbers the communities in order of appearance, in O(V).
+// Returns the number of communities.
+inline auto renumber_communities(std::span< std::size_t > of_vertex)
+    -> std::size_t
 {
-    using community_type = typename NetworkProperties::community_type;
-    using community_traits_type = community_traits< community_type >;
+    constexpr auto nil = std::numeric_limits< std::size_t >::max();
 
-    NetworkProperties status;
+    auto renumbered = std::vector< std::size_t >(of_vertex.size(), nil);
+    auto num = std::size_t(0);
 
-    for (auto i = community_traits_type::first();
-         auto u : boost::make_iterator_range(boost::vertices(g)))
+    for (auto& com : of_vertex)
     {
-        assert(i != community_traits_type::nil());
+        assert(com < renumbered.size());
 
-        status.vertex_community[u] = i;
+        if (renumbered[com] == nil)
+            renumbered[com] = num++;
 
-        assert(i < community_traits_type::last());
-        community_advance(i);
+        com = renumbered[com];
     }
 
-    return status;
+    return num;
 }
 
-// Each key is a different community & each value is the number of members.
-template < typename VertexCommunityStorage >
-auto community_num_members(const VertexCommunityStorage& vertex_community)
+/***********************************************************
+ * Update Rule                                             *
+ ***********************************************************/
+
+// Maps each neighbour community of a vertex with the weighted degree of the
+// vertex towards the community, while using the gamma value, in O(d log d).
+// Modified version.
+// The result is sorted by community.
+template < std::floating_point Gamma >
+auto neighbour_communities(
+    const network& net,
+    const communities& coms,
+    std::size_t u,
+    Gamma gamma,
+    std::vector< network::neighbour >& res) -> void
 {
-    using community_type = typename VertexCommunityStorage::mapped_type;
-    using size_type = typename VertexCommunityStorage::size_type;
-    using result_type = std::unordered_map< community_type, size_type >;
+    res.clear();
+
+    for (const auto& [v, w] : net.neighbours_of(u))
+        res.emplace_back(coms.of_vertex[v], w);
+
+    std::sort(
+        std::begin(res),
+        std::end(res),
+        [](const auto& lhs, const auto& rhs)
+        { return lhs.first < rhs.first; });
 
-    auto res = result_type();
+    auto last = std::size_t(0);
 
-    for (auto u : std::ranges::views::keys(vertex_community))
+    for (std::size_t i = 0; i < res.size();)
     {
-        const auto com = get(vertex_community, u);
-        res[com] += 1;
+        const auto com = res[i].first;
+        auto w = network::weight_type(0);
+
+        for (; i < res.size() and res[i].first == com; ++i)
+            w += res[i].second;
+
+        res[last++] = { com, w - gamma * (coms.size[com] - w) };
     }
 
-    assert(std::ranges::all_of(
-        std::ranges::views::values(vertex_community),
-        [&res](auto com) { return res.contains(com); }));
-    return res;
+    res.resize(last);
 }
 
-// Maps each neighbor community with the weighted degree of the node by taking
-// into account only links towards the community, while using the gamma value.
-// Modified version.
-template <
-    typename Graph,
-    typename NetworkProperties,
-    typename WeightMap,
-    std::floating_point Gamma = float >
-auto neighbor_communities(
-    typename boost::graph_traits< Graph >::vertex_descriptor u,
-    const Graph& g,
-    const NetworkProperties& status,
-    WeightMap edge_weight,
-    Gamma gamma)
+// Returns the community of a vertex, if it maximizes the LLP equation, or one
+// of the dominant neighbour communities of the vertex, otherwise, in
+// O(d log d).
+// The dominant communities are picked by an index in [0, number of dominant
+// communities), in order of community id.
+// NOTE: Vertices without neighbours stay in their community.
+template < std::floating_point Gamma, typename Picker >
+requires std::invocable< Picker, std::size_t >
+auto dominant_community(
+    const network& net,
+    const communities& coms,
+    std::size_t u,
+    Gamma gamma,
+    Picker pick,
+    std::vector< network::neighbour >& scratch) -> std::size_t
 {
-    using weight_map_traits = boost::property_traits< WeightMap >;
-    using weight_type = typename weight_map_traits::value_type;
-    using community_type = typename NetworkProperties::community_type;
-    using res_type = std::unordered_map< community_type, weight_type >;
+    const auto com = coms.of_vertex[u];
 
-    res_type res;
-    res_type weights;
+    neighbour_communities(net, coms, u, gamma, scratch);
 
-    for (auto e : boost::make_iterator_range(boost::out_edges(u, g)))
-    {
-        const auto v = boost::target(e, g);
-        const auto w = boost::get(edge_weight, e);
-        const auto com = get(status.vertex_community, v);
-        weights[com] += w;
-    }
+    if (scratch.empty())
+        return com;
+
+    auto max = scratch.front().second;
+    auto own = network::weight_type(0);
 
-    for (const auto counter = community_num_members(status.vertex_community);
-         const auto& [com, w] : weights)
+    for (const auto& [c, score] : scratch)
     {
-        const auto num_members = get(counter, com);
-        res[com] = w - gamma * (num_members - w);
-    }
+        max = std::max(max, score);
 
-    return res;
-}
+        if (c == com)
+            own = score;
+    }
 
-// Orders each community.
-template < typename VertexCommunityStorage >
-auto renumber_communities(const VertexCommunityStorage& vertex_community)
-{
-    using community_type = typename VertexCommunityStorage::mapped_type;
-    using community_traits_type = community_traits< community_type >;
-    using temp_values = std::unordered_map< community_type, community_type >;
+    if (own == max)
+        return com;
 
-    temp_values new_coms;
-    VertexCommunityStorage res;
+    const auto num_dominant = static_cast< std::size_t >(std::count_if(
+        std::begin(scratch),
+        std::end(scratch),
+        [max](const auto& pair) { return pair.second == max; }));
 
-    for (auto i = community_traits_type::first();
-         auto v : std::ranges::views::keys(vertex_community))
-    {
-        assert(i != community_traits_type::nil());
+    auto nth = static_cast< std::size_t >(pick(num_dominant));
+    assert(nth < num_dominant);
 
-        const auto com = get(vertex_community, v);
-        auto com2 = get_or(new_coms, com, community_traits_type::nil());
+    for (const auto& [c, score] : scratch)
+        if (score == max and nth-- == 0)
+            return c;
 
-        if (com2 == community_traits_type::nil())
-        {
-            new_coms[com] = i;
-            com2 = i;
-            assert(i < community_traits_type::last());
-            community_advance(i);
-        }
+    assert(false);
+    return com;
+}
 
-        res[v] = com2;
-    }
+/***********************************************************
+ * Propagation                                             *
+ ***********************************************************/
 
-    assert(res.size() == vertex_community.size());
-    assert(std::all_of(
-        std::cbegin(vertex_community),
-        std::cend(vertex_community),
-        [&res](const auto& pair) { return res.contains(pair.first); }));
+// Number of vertex batches per synchronous step.
+constexpr std::size_t batches_per_step = 32;
 
-    return res;
-}
+// Minimum number of vertices per batch, decided on multiple threads.
+constexpr std::size_t min_parallel_batch = 4096;
 
-// Returns true if the community of a node maximizes the LLP equation.
+// Updates the community of each vertex, one by one, (in random order), step by
+// step, until no vertex changes its community, in O(V + E log d) per step.
 template <
-    typename Graph,
-    typename NetworkProperties,
-    typename WeightMap,
-    std::floating_point Gamma = float >
-inline auto dominates(
-    typename boost::graph_traits< Graph >::vertex_descriptor u,
-    const Graph& g,
-    const NetworkProperties& status,
-    WeightMap edge_weight,
-    Gamma gamma) -> bool
+    std::floating_point Gamma,
+    typename UGenerator,
+    typename RNG >
+requires std::invocable< UGenerator, std::size_t, std::size_t >
+auto propagate_labels(
+    const network& net,
+    communities& coms,
+    Gamma gamma,
+    int steps,
+    UGenerator gen,
+    RNG& rng) -> void
 {
-    using std::ranges::views::values;
+    auto order = std::vector< std::size_t >(net.num_vertices());
+    std::iota(std::begin(order), std::end(order), 0);
 
-    const auto jcoms = neighbor_communities(u, g, status, edge_weight, gamma);
-    const bool has_no_neighbours = jcoms.empty();
+    auto scratch = std::vector< network::neighbour >();
 
-    if (has_no_neighbours)
-    {
-        return false;
-    }
-    else
+    const auto pick = [&gen](std::size_t n) { return gen(0, n - 1); };
+
+    for (decltype(steps) i = 0; i < steps; ++i)
     {
-        const auto com = get(status.vertex_community, u);
-        const auto num_js = get_or(jcoms, com, 0);
-        const auto max_iter = std::ranges::max_element(values(jcoms));
-        assert(max_iter != std::cend(values(jcoms)));
-        const auto max_num_members = *max_iter;
-        return num_js == max_num_members;
+        std::shuffle(std::begin(order), std::end(order), rng);
+
+        auto moved = false;
+
+        for (auto u : order)
+        {
+            const auto com
+                = dominant_community(net, coms, u, gamma, pick, scratch);
+
+            if (com == coms.of_vertex[u])
+                continue;
+
+            move_vertex(coms, u, com);
+            moved = true;
+        }
+
+        if (!moved)
+            break;
     }
 }
 
-// Randomly returns one of the dominant neighbour communities of a vertex.
+// Updates the community of each vertex, step by step, until no vertex changes
+// its community, in O(V + E log d) per step.
+// Each step visits the vertices in (random) batches: the updates of a batch are
+// decided in parallel, against the communities before the batch, and then
+// committed in order. The batches and the random draws depend only on the
+// network, so that the result does not depend on the number of threads.
 template <
-    typename Graph,
-    typename NetworkProperties,
-    typename WeightMap,
-    std::floating_point Gamma = float,
-    typename UGenerator = decltype(misc::urandom< std::size_t >) >
+    std::floating_point Gamma,
+    typename UGenerator,
+    typename RNG >
 requires std::invocable< UGenerator, std::size_t, std::size_t >
-inline auto dominant_community(
-    typename boost::graph_traits< Graph >::vertex_descriptor u,
-    const Graph& g,
-    const NetworkProperties& status,
-    WeightMap edge_weight,
+auto propagate_labels_in_batches(
+    const network& net,
+    communities& coms,
     Gamma gamma,
-    UGenerator gen = misc::urandom< std::size_t >)
+    int steps,
+    UGenerator gen,
+    RNG& rng) -> void
 {
-    using community_type = typename NetworkProperties::community_type;
-    using community_traits_type = community_traits< community_type >;
+    const auto n = net.num_vertices();
+    if (n == 0)
+        return;
 
-    const auto jcoms = neighbor_communities(u, g, status, edge_weight, gamma);
-    const bool has_no_neighbours = jcoms.empty();
+    const auto batch_size = std::max< std::size_t >(1, n / batches_per_step);
+    const auto num_threads
+        = batch_size >= min_parallel_batch ? misc::hardware_concurrency() : 1u;
 
-    if (has_no_neighbours)
-    {
-        return community_traits_type::nil();
-    }
-    else
+    auto order = std::vector< std::size_t >(n);
+    std::iota(std::begin(order), std::end(order), 0);
+
+    auto draws = std::vector< std::size_t >(batch_size);
+    auto targets = std::vector< std::size_t >(batch_size);
+
+    for (decltype(steps) i = 0; i < steps; ++i)
     {
-        const auto max_coms = make_vector(max_value_keys(jcoms));
-        assert(!max_coms.empty());
-        return max_coms.at(gen(0, max_coms.size() - 1));
+        std::shuffle(std::begin(order), std::end(order), rng);
+
+        auto moved = false;
+
+        for (std::size_t first = 0; first < n; first += batch_size)
+        {
+            const auto batch = std::span(order).subspan(
+                first, std::min(batch_size, n - first));
+
+            for (std::size_t j = 0; j < batch.size(); ++j)
+                draws[j] = gen(0, std::numeric_limits< std::size_t >::max());
+
+            misc::parallel_for_each_chunk(
+                std::size_t(0),
+                batch.size(),
+                [&](auto chunk_first, auto chunk_last)
+                {
+                    auto scratch = std::vector< network::neighbour >();
+
+                    for (auto j = chunk_first; j != chunk_last; ++j)
+                        targets[j] = dominant_community(
+                            net,
+                            coms,
+                            batch[j],
+                            gamma,
+                            [r = draws[j]](std::size_t k) { return r % k; },
+                            scratch);
+                },
+                num_threads);
+
+            for (std::size_t j = 0; j < batch.size(); ++j)
+            {
+                const auto u = batch[j];
+                const auto from = coms.of_vertex[u];
+                const auto to = targets[j];
+
+                if (to == from)
+                    continue;
+
+                // Stale decisions would swap singletons, instead of merging.
+                if (batch.size() > 1 and coms.size[from] == 1
+                    and coms.size[to] == 1 and to > from)
+                    continue;
+
+                move_vertex(coms, u, to);
+                moved = true;
+            }
+        }
+
+        if (!moved)
+            break;
     }
 }
 
@@ -323,23 +406,70 @@ auto cluster_in_isolation(const Graph& g, ClusterMap vertex_cluster) -> void
         boost::put(vertex_cluster, u, c++);
 }
 
-template <
-    typename Graph,
-    typename VertexCommunityStorage,
-    typename ClusterMap >
-auto cluster_from_partition(
+template < typename Graph, typename ClusterMap >
+auto cluster_from_communities(
     const Graph& g,
-    const VertexCommunityStorage& partition,
+    std::span< const std::size_t > of_vertex,
     ClusterMap vertex_cluster) -> void
 {
     using cluster_map_traits = boost::property_traits< ClusterMap >;
     using cluster_type = typename cluster_map_traits::value_type;
-    using community_type = typename VertexCommunityStorage::mapped_type;
 
-    static_assert(std::is_convertible_v< community_type, cluster_type >);
+    static_assert(std::is_convertible_v< std::size_t, cluster_type >);
+
+    const auto index = boost::get(boost::vertex_index, g);
 
     for (auto u : boost::make_iterator_range(boost::vertices(g)))
-        boost::put(vertex_cluster, u, get(partition, u));
+        boost::put(
+            vertex_cluster,
+            u,
+            static_cast< cluster_type >(of_vertex[boost::get(index, u)]));
+}
+
+// Clusters a graph from the communities of the given propagation step, which is
+// invoked with the network of the graph and its singleton communities.
+template <
+    typename Graph,
+    typename WeightMap,
+    typename ClusterMap,
+    typename Propagation >
+requires std::invocable< Propagation, const network&, communities& >
+auto cluster_by_propagation(
+    const Graph& g,
+    WeightMap edge_weight,
+    ClusterMap vertex_cluster,
+    Propagation propagate) -> void
+{
+    BOOST_CONCEPT_ASSERT((boost::GraphConcept< Graph >));
+
+    BOOST_CONCEPT_ASSERT(
+        (boost::ReadablePropertyMapConcept<
+            WeightMap,
+            typename boost::graph_traits< Graph >::edge_descriptor >));
+
+    BOOST_CONCEPT_ASSERT(
+        (boost::ReadWritePropertyMapConcept<
+            ClusterMap,
+            typename boost::graph_traits< Graph >::vertex_descriptor >));
+
+    // Early exit.
+    if (boost::graph::has_no_vertices(g))
+        return;
+
+    // Early exit.
+    if (boost::graph::has_no_edges(g))
+    {
+        cluster_in_isolation(g, vertex_cluster);
+        return;
+    }
+
+    const auto net = make_network(g, edge_weight);
+    auto coms = make_singletons(net.num_vertices());
+
+    propagate(net, coms);
+
+    renumber_communities(coms.of_vertex);
+    cluster_from_communities(g, coms.of_vertex, vertex_cluster);
 }
 
 } // namespace clustering::llp_detail
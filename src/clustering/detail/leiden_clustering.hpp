@@ -0,0 +1,361 @@
+// Contains a private module for the Leiden clustering implementation.
+// Soultatos Stefanos 2022
+
+#ifndef CLUSTERING_DETAIL_LEIDEN_CLUSTERING_HPP
+#define CLUSTERING_DETAIL_LEIDEN_CLUSTERING_HPP
+
+#include "louvain_method_clustering.hpp" // for network, move_batch, etc
+#include "misc/parallel.hpp"             // for parallel_for_each_chunk
+
+#include <algorithm> // for sort, shuffle, min, max
+#include <cassert>   // for assert
+#include <cstddef>   // for size_t
+#include <iterator>  // for prev
+#include <numeric>   // for iota
+#include <span>      // for span
+#include <utility>   // for move, swap
+#include <vector>    // for vector
+
+// See: Traag, Waltman & van Eck, From Louvain to Leiden: guaranteeing
+// well-connected communities.
+
+namespace clustering::leiden_detail
+{
+
+using louvain_detail::communities;
+using louvain_detail::network;
+
+/***********************************************************
+ * Communities                                             *
+ ***********************************************************/
+
+// Places the vertices of a network to the given communities, in O(V).
+inline auto make_communities(
+    const network& net,
+    std::vector< std::size_t > of_vertex) -> communities
+{
+    const auto n = net.num_vertices();
+    assert(of_vertex.size() == n);
+
+    auto res = communities { .of_vertex = std::move(of_vertex),
+                             .out_strength = std::vector< double >(n, 0),
+                             .in_strength = std::vector< double >(n, 0),
+                             .size = std::vector< std::size_t >(n, 0) };
+
+    for (std::size_t u = 0; u < n; ++u)
+    {
+        const auto com = res.of_vertex[u];
+        assert(com < n);
+
+        res.out_strength[com] += net.out_strength[u];
+        res.in_strength[com] += net.in_strength[u];
+        ++res.size[com];
+    }
+
+    return res;
+}
+
+/***********************************************************
+ * Local moving                                            *
+ ***********************************************************/
+
+// Moves the vertices of a network to their best communities, until none of
+// them is worth moving, in O(V + E log d) per round.
+// Each round visits only the (queued) neighbours of the vertices moved in the
+// previous round, outside of their new community, in batches, as in the
+// Louvain local moving.
+// NOTE: The batches depend only on the network.
+template < typename RNG >
+auto move_vertices_fast(
+    const network& net,
+    communities& coms,
+    double resolution,
+    RNG& rng) -> void
+{
+    namespace impl = louvain_detail;
+
+    const auto n = net.num_vertices();
+    if (n == 0 or net.total == 0)
+        return;
+
+    const auto batch_size
+        = std::max< std::size_t >(1, n / impl::batches_per_pass);
+    const auto num_threads = batch_size >= impl::min_parallel_batch
+        ? misc::hardware_concurrency()
+        : 1u;
+
+    auto queue = std::vector< std::size_t >(n);
+    std::iota(std::begin(queue), std::end(queue), 0);
+    std::shuffle(std::begin(queue), std::end(queue), rng);
+
+    auto queued = std::vector< char >(n, true);
+    auto next = std::vector< std::size_t >();
+    auto targets = std::vector< std::size_t >(batch_size);
+
+    const auto enqueue_neighbours = [&](std::size_t u)
+    {
+        for (const auto& [v, w] : net.neighbours_of(u))
+            if (!queued[v] and coms.of_vertex[v] != coms.of_vertex[u])
+            {
+                queued[v] = true;
+                next.push_back(v);
+            }
+    };
+
+    for (auto round = 0; round < impl::max_passes and !queue.empty(); ++round)
+    {
+        for (std::size_t first = 0; first < queue.size(); first += batch_size)
+        {
+            const auto batch = std::span(queue).subspan(
+                first, std::min(batch_size, queue.size() - first));
+
+            for (auto u : batch)
+                queued[u] = false;
+
+            impl::move_batch(
+                net,
+                coms,
+                batch,
+                resolution,
+                targets,
+                num_threads,
+                enqueue_neighbours);
+        }
+
+        std::swap(queue, next);
+        next.clear();
+    }
+}
+
+/***********************************************************
+ * Refinement                                              *
+ ***********************************************************/
+
+// Splits each community of a network into well connected sub-communities, in
+// O(V + E log d).
+// Starting from singletons, each (still singleton) vertex is merged into the
+// well connected sub-community of its community that it gains the most
+// modularity from, if any.
+// The communities are refined in parallel, in a (random) vertex order that does
+// not depend on the number of threads.
+// Returns the sub-community of each vertex.
+// NOTE: The sub-community ids are vertex ids, (of the network).
+template < typename RNG >
+auto refine(
+    const network& net,
+    const communities& coms,
+    double resolution,
+    RNG& rng) -> std::vector< std::size_t >
+{
+    using neighbour = network::neighbour;
+
+    const auto n = net.num_vertices();
+
+    auto res = std::vector< std::size_t >(n);
+    std::iota(std::begin(res), std::end(res), 0);
+
+    if (n == 0 or net.total == 0)
+        return res;
+
+    // The members of each community, in random order.
+
+    auto order = res;
+    std::shuffle(std::begin(order), std::end(order), rng);
+
+    auto offsets = std::vector< std::size_t >(n + 1, 0);
+    for (std::size_t u = 0; u < n; ++u)
+        ++offsets[coms.of_vertex[u] + 1];
+
+    for (std::size_t com = 0; com < n; ++com)
+        offsets[com + 1] += offsets[com];
+
+    auto members = std::vector< std::size_t >(n);
+    auto next = std::vector< std::size_t >(
+        std::begin(offsets), std::prev(std::end(offsets)));
+
+    for (auto u : order)
+        members[next[coms.of_vertex[u]]++] = u;
+
+    // The sub-communities, along with their links to the rest of their
+    // community.
+
+    auto out_strength = net.out_strength;
+    auto in_strength = net.in_strength;
+    auto size = std::vector< std::size_t >(n, 1);
+    auto external = std::vector< double >(n, 0);
+
+    const auto refine_community = [&](std::size_t com, auto& scratch)
+    {
+        const auto first = offsets[com];
+        const auto last = offsets[com + 1];
+
+        for (auto i = first; i != last; ++i)
+        {
+            const auto u = members[i];
+            for (const auto& [v, w] : net.neighbours_of(u))
+                if (v != u and coms.of_vertex[v] == com)
+                    external[u] += w;
+        }
+
+        // Of a subset of the community, against the rest of it.
+        const auto well_connected = [&](std::size_t sub)
+        {
+            const auto out = out_strength[sub];
+            const auto in = in_strength[sub];
+
+            return external[sub] >= resolution
+                * (out * (coms.in_strength[com] - in)
+                   + in * (coms.out_strength[com] - out))
+                / net.total;
+        };
+
+        for (auto i = first; i != last; ++i)
+        {
+            const auto u = members[i];
+
+            if (res[u] != u or size[u] != 1 or !well_connected(u))
+                continue;
+
+            scratch.clear();
+            for (const auto& [v, w] : net.neighbours_of(u))
+                if (v != u and coms.of_vertex[v] == com)
+                    scratch.emplace_back(res[v], w);
+
+            std::sort(
+                std::begin(scratch),
+                std::end(scratch),
+                [](const auto& lhs, const auto& rhs)
+                { return lhs.first < rhs.first; });
+
+            auto best = u;
+            auto best_gain = 0.0;
+            auto best_links = 0.0;
+
+            for (std::size_t j = 0; j < scratch.size();)
+            {
+                const auto sub = scratch[j].first;
+                auto links = 0.0;
+
+                for (; j < scratch.size() and scratch[j].first == sub; ++j)
+                    links += scratch[j].second;
+
+                if (!well_connected(sub))
+                    continue;
+
+                const auto gain = links
+                    - resolution
+                        * (net.out_strength[u] * in_strength[sub]
+                           + net.in_strength[u] * out_strength[sub])
+                        / net.total;
+
+                if (gain > best_gain)
+                {
+                    best = sub;
+                    best_gain = gain;
+                    best_links = links;
+                }
+            }
+
+            if (best == u)
+                continue;
+
+            external[best] += external[u] - 2 * best_links;
+            out_strength[best] += out_strength[u];
+            in_strength[best] += in_strength[u];
+            ++size[best];
+
+            out_strength[u] = in_strength[u] = external[u] = 0;
+            size[u] = 0;
+            res[u] = best;
+        }
+    };
+
+    const auto num_threads = n >= louvain_detail::min_parallel_batch
+        ? misc::hardware_concurrency()
+        : 1u;
+
+    misc::parallel_for_each_chunk(
+        std::size_t(0),
+        n,
+        [&](auto chunk_first, auto chunk_last)
+        {
+            auto scratch = std::vector< neighbour >();
+
+            for (auto com = chunk_first; com != chunk_last; ++com)
+                refine_community(com, scratch);
+        },
+        num_threads);
+
+    return res;
+}
+
+/***********************************************************
+ * Iteration                                               *
+ ***********************************************************/
+
+// Runs one Leiden iteration, starting from a (densely numbered) partition of
+// a network: local moving, refinement and aggregation of the refined
+// partition, level by level, until each community is a single vertex.
+// The partition is updated in place.
+template < typename RNG >
+auto leiden_iteration(
+    const network& base,
+    std::span< std::size_t > partition,
+    double resolution,
+    RNG& rng) -> void
+{
+    namespace impl = louvain_detail;
+
+    assert(partition.size() == base.num_vertices());
+
+    auto net = base;
+    auto coms = make_communities(
+        net,
+        std::vector< std::size_t >(std::begin(partition), std::end(partition)));
+
+    // The (aggregate) vertex of each base vertex, at the current level.
+    auto membership = std::vector< std::size_t >(base.num_vertices());
+    std::iota(std::begin(membership), std::end(membership), 0);
+
+    while (true)
+    {
+        move_vertices_fast(net, coms, resolution, rng);
+
+        auto of_community = coms.of_vertex;
+        const auto num_communities
+            = impl::renumber_communities(of_community);
+
+        if (num_communities == net.num_vertices())
+            break;
+
+        auto refined = refine(net, coms, resolution, rng);
+        auto num_refined = impl::renumber_communities(refined);
+
+        // Nothing to refine, aggregates the communities instead.
+        if (num_refined == net.num_vertices())
+        {
+            refined = of_community;
+            num_refined = num_communities;
+        }
+
+        // Each refined community starts from its (unrefined) community.
+        auto parent = std::vector< std::size_t >(num_refined);
+        for (std::size_t u = 0; u < net.num_vertices(); ++u)
+            parent[refined[u]] = of_community[u];
+
+        for (auto& v : membership)
+            v = refined[v];
+
+        net = impl::aggregate(net, refined, num_refined);
+        coms = make_communities(net, std::move(parent));
+    }
+
+    for (std::size_t u = 0; u < partition.size(); ++u)
+        partition[u] = coms.of_vertex[membership[u]];
+
+    impl::renumber_communities(partition);
+}
+
+} // namespace clustering::leiden_detail
+
+#endif // CLUSTERING_DETAIL_LEIDEN_CLUSTERING_HPP
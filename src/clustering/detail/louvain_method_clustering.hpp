@@ -4,541 +4,514 @@
 #ifndef CLUSTERING_DETAIL_LOUVAIN_METHOD_CLUSTERING_HPP
 #define CLUSTERING_DETAIL_LOUVAIN_METHOD_CLUSTERING_HPP
 
-#include "misc/algorithm.hpp" // for accumulate
-#include "misc/concepts.hpp"  // for arithmetic
-#include "misc/random.hpp"    // for rng
-#include "utility.hpp"        // for edge_hash
+#include "misc/parallel.hpp" // for parallel_for_each_chunk
 
-#include <boost/graph/adjacency_list.hpp> // for vertices, etc
+#include <boost/graph/adjacency_list.hpp> // for vertices, edges, etc
+#include <algorithm>                      // for sort, shuffle, min, max
 #include <cassert>                        // for assert
-#include <cmath>                          // for pow
-#include <concepts>                       // for floating_point
-#include <ranges>                         // for values, keys
-#include <set>                            // for set
-#include <unordered_map>                  // for unordered_map, hash
+#include <cstddef>                        // for size_t
+#include <numeric>                        // for iota
+#include <span>                           // for span
+#include <type_traits>                    // for is_convertible_v
+#include <utility>                        // for pair
 #include <vector>                         // for vector
 
-// NOTE: Based on .js implementation from:
-// https://github.com/upphiminn/jLouvain/blob/master/src/jLouvain.js
+// See: https://en.wikipedia.org/wiki/Louvain_method
 //
-// See also: https://en.wikipedia.org/wiki/Louvain_method
-
-// NOTE: Currently only taking into account out edges.
-// Must we dispatch on bidirectional graphs?
+// See also: Leicht & Newman, Community structure in directed networks, for the
+// directed modularity:
+// Q = 1/m * sum(A(i, j) - k_out(i) * k_in(j) / m), over i, j of a community.
 
 namespace clustering::louvain_detail
 {
 
 /***********************************************************
- * General                                                 *
+ * Network                                                 *
  ***********************************************************/
 
-// Emulate js: 'array[key] || alt' expression.
-// E.g: auto i = get_or(arr, 0, 0); -> let i = arr[0] || 0;
-template < typename AssociativeContainer >
-[[maybe_unused]] inline auto get_or(
-    const AssociativeContainer& data,
-    const typename AssociativeContainer::key_type& key,
-    const typename AssociativeContainer::mapped_type& alt)
+// Weighted network, over dense vertex indices, in compressed sparse row form.
+// Each vertex neighbour j of a vertex i is weighted by A(i, j) + A(j, i), while
+// the self loops A(i, i) are kept apart.
+// NOTE: Undirected edges count in both directions, (their loops twice).
+struct network
 {
-    const auto pos = data.find(key);
-    return pos != std::cend(data) ? pos->second : alt;
-}
+    using weight_type = double;
+    using neighbour = std::pair< std::size_t, weight_type >;
 
-// Safe map access.
-// NOTE: Maybe use get_or(data, key, 0) here.
-template < typename AssociativeContainer >
-inline auto
-get(const AssociativeContainer& data,
-    const typename AssociativeContainer::key_type& key)
-{
-    const auto pos = data.find(key);
-    assert(pos != std::cend(data));
-    return pos->second;
-}
+    std::vector< std::size_t > offsets; // per vertex, plus one
+    std::vector< neighbour > neighbours;
+    std::vector< weight_type > loops;        // A(i, i)
+    std::vector< weight_type > out_strength; // sum of A(i, j), over j
+    std::vector< weight_type > in_strength;  // sum of A(j, i), over j
+    weight_type total { 0 };                 // sum of A(i, j), over i, j
 
-/***********************************************************
- * Factories                                               *
- ***********************************************************/
+    auto num_vertices() const -> std::size_t { return loops.size(); }
 
-template < std::ranges::input_range InputRange >
-inline auto make_set(InputRange range)
-{
-    using value_type = std::ranges::range_value_t< InputRange >;
-    return std::set< value_type > { std::cbegin(range), std::cend(range) };
-}
+    auto neighbours_of(std::size_t u) const -> std::span< const neighbour >
+    {
+        assert(u < num_vertices());
+        return std::span(neighbours)
+            .subspan(offsets[u], offsets[u + 1] - offsets[u]);
+    }
+};
 
-template < std::input_iterator InputIter >
-inline auto make_set(InputIter first, InputIter last)
+// A (row, column, weight) entry of the neighbour weights.
+struct network_entry
 {
-    using value_type = typename std::iterator_traits< InputIter >::value_type;
-    return std::set< value_type > { first, last };
-}
+    std::size_t row;
+    std::size_t column;
+    network::weight_type weight;
+};
 
-template < std::ranges::input_range InputRange >
-inline auto make_vector(InputRange range)
+// Merges the entries into the compressed sparse neighbour rows of a network,
+// summing the weights of the duplicate ones, in O(E log E).
+inline auto
+set_neighbours(network& net, std::vector< network_entry > entries) -> void
 {
-    using value_type = std::ranges::range_value_t< InputRange >;
-    return std::vector< value_type > { std::cbegin(range), std::cend(range) };
-}
+    const auto n = net.num_vertices();
 
-template < std::input_iterator InputIter >
-inline auto make_vector(InputIter first, InputIter last)
-{
-    using value_type = typename std::iterator_traits< InputIter >::value_type;
-    return std::vector< value_type > { first, last };
-}
+    std::sort(
+        std::begin(entries),
+        std::end(entries),
+        [](const auto& lhs, const auto& rhs)
+        {
+            return lhs.row != rhs.row ? lhs.row < rhs.row
+                                      : lhs.column < rhs.column;
+        });
 
-/***********************************************************
- * Graph Utilities                                         *
- ***********************************************************/
+    net.offsets.assign(n + 1, 0);
+    net.neighbours.clear();
+    net.neighbours.reserve(entries.size());
 
-// Returns the weighted sum of all of the adjacent edges of a vertex.
-template < typename Graph, typename WeightMap >
-inline auto weighted_degree(
-    typename boost::graph_traits< Graph >::vertex_descriptor u,
-    const Graph& g,
-    WeightMap edge_weight)
-{
-    using weight_map_traits = boost::property_traits< WeightMap >;
-    using weight_type = typename weight_map_traits::value_type;
-    return misc::accumulate(
-        misc::subrange(boost::out_edges(u, g)),
-        weight_type(0),
-        [edge_weight](auto sum, auto e)
-        { return sum + boost::get(edge_weight, e); });
-}
-
-// Returns the weighted sum of all of the edges of a graph.
-template < typename Graph, typename WeightMap >
-inline auto weight_sum(const Graph& g, WeightMap edge_weight)
-{
-    using weight_map_traits = boost::property_traits< WeightMap >;
-    using weight_type = typename weight_map_traits::value_type;
-    return misc::accumulate(
-        misc::subrange(boost::edges(g)),
-        weight_type(0),
-        [edge_weight](auto sum, auto e)
-        { return sum + boost::get(edge_weight, e); });
-}
-
-/***********************************************************
- * Community/Network Properties                            *
- ***********************************************************/
+    for (std::size_t i = 0; i < entries.size(); ++i)
+    {
+        const auto& [row, column, weight] = entries[i];
+        assert(row < n);
+        assert(column < n);
 
-// Shared community type traits.
-template < misc::arithmetic Community >
-struct community_traits
-{
-    using numeric_limits = std::numeric_limits< Community >;
+        if (i > 0 and entries[i - 1].row == row
+            and entries[i - 1].column == column)
+        {
+            net.neighbours.back().second += weight;
+        }
+        else
+        {
+            net.neighbours.emplace_back(column, weight);
+            ++net.offsets[row + 1];
+        }
+    }
 
-    static constexpr auto nil() -> Community { return -1; }
-    static constexpr auto first() -> Community { return 0; }
-    static constexpr auto last() -> Community { return numeric_limits::max(); }
-};
+    for (std::size_t u = 0; u < n; ++u)
+        net.offsets[u + 1] += net.offsets[u];
 
-// Advance community com. (Currently com <- com + 1).
-template < misc::arithmetic Community >
-constexpr auto community_advance(Community& com) -> void
-{
-    ++com;
+    assert(net.offsets.back() == net.neighbours.size());
 }
 
-// Network cache data, used for dynamic programming.
-// NOTE: Each storage type must be an associative container.
-template <
-    typename Vertex,
-    typename Weight,
-    typename Community,
-    typename VertexCommunityStorage = std::unordered_map< Vertex, Community >,
-    typename CommunityWeightStorage = std::unordered_map< Community, Weight >,
-    typename VertexWeightStorage = std::unordered_map< Vertex, Weight > >
-struct network_properties
+// Builds the network of a weighted graph, in O(V + E log E).
+// Edges of undirected graphs count in both directions.
+template < typename Graph, typename WeightMap >
+auto make_network(const Graph& g, WeightMap edge_weight) -> network
 {
-    using vertex_type = Vertex;
-    using weight_type = Weight;
-    using community_type = Community;
-    using vertex_community_storage_type = VertexCommunityStorage;
-    using community_weight_storage_type = CommunityWeightStorage;
-    using vertex_weight_storage_type = VertexWeightStorage;
-
-    // Linkage of each vertex to a community.
-    vertex_community_storage_type vertex_community;
-
-    // Sum of the weights of all links inside each community.
-    community_weight_storage_type community_internal;
+    using directed_category =
+        typename boost::graph_traits< Graph >::directed_category;
 
-    // Sum of the weights of all links incident to each community.
-    community_weight_storage_type community_incident;
+    constexpr auto undirected
+        = std::is_convertible_v< directed_category, boost::undirected_tag >;
 
-    // Sum of the weights of all links incident to each vertex.
-    vertex_weight_storage_type vertex_incident;
+    const auto n = static_cast< std::size_t >(boost::num_vertices(g));
+    const auto index = boost::get(boost::vertex_index, g);
 
-    // Loop weight (if existent) of to each vertex.
-    vertex_weight_storage_type vertex_loop;
+    auto res = network();
+    res.loops.assign(n, 0);
+    res.out_strength.assign(n, 0);
+    res.in_strength.assign(n, 0);
 
-    // Sum of all weights present in a graph.
-    weight_type total {};
+    auto entries = std::vector< network_entry >();
+    entries.reserve(2 * static_cast< std::size_t >(boost::num_edges(g)));
 
-    auto operator==(const network_properties&) const -> bool = default;
-    auto operator!=(const network_properties&) const -> bool = default;
-};
-
-// Initialize network properties before/after Louvain execution.
-// Factory for any given network and graph with weighted edges.
-template < typename NetworkProperties, typename Graph, typename WeightMap >
-auto network_status(const Graph& g, WeightMap edge_weight) -> NetworkProperties
-{
-    using community_type = typename NetworkProperties::community_type;
-    using community_traits_type = community_traits< community_type >;
-
-    NetworkProperties status;
-    status.total = weight_sum(g, edge_weight);
-
-    for (auto i = community_traits_type::first();
-         auto u : boost::make_iterator_range(boost::vertices(g)))
+    const auto link = [&res, &entries](auto u, auto v, auto w)
     {
-        assert(i != community_traits_type::nil());
-
-        status.vertex_community[u] = i;
+        res.out_strength[u] += w;
+        res.in_strength[v] += w;
+        res.total += w;
 
-        const auto deg = weighted_degree(u, g, edge_weight);
-        status.community_incident[i] = deg;
-        status.vertex_incident[u] = deg;
+        if (u == v)
+        {
+            res.loops[u] += w;
+            return;
+        }
 
-        const auto [loop, loop_exists] = boost::edge(u, u, g);
-        const auto loop_w = loop_exists ? boost::get(edge_weight, loop) : 0;
-        status.vertex_loop[u] = loop_w;
-        status.community_internal[i] = loop_w;
+        entries.push_back({ .row = u, .column = v, .weight = w });
+        entries.push_back({ .row = v, .column = u, .weight = w });
+    };
 
-        assert(i < community_traits_type::last());
-        community_advance(i);
+    for (auto e : boost::make_iterator_range(boost::edges(g)))
+    {
+        const auto u = static_cast< std::size_t >(
+            boost::get(index, boost::source(e, g)));
+        const auto v = static_cast< std::size_t >(
+            boost::get(index, boost::target(e, g)));
+        const auto w = static_cast< double >(boost::get(edge_weight, e));
+
+        link(u, v, w);
+        if constexpr (undirected)
+            link(v, u, w);
     }
 
-    return status;
+    set_neighbours(res, std::move(entries));
+    return res;
 }
 
-// Maps each neighbor community with the weighted degree of the node by taking
-// into account only links towards the community.
-template < typename Graph, typename NetworkProperties, typename WeightMap >
-auto neighbor_communities(
-    typename boost::graph_traits< Graph >::vertex_descriptor u,
-    const Graph& g,
-    const NetworkProperties& status,
-    WeightMap edge_weight)
+/***********************************************************
+ * Communities                                             *
+ ***********************************************************/
+
+// The communities of the vertices of a network, along with their (cached)
+// strengths.
+// NOTE: The community ids are vertex ids, (of the network).
+struct communities
 {
-    using res_type = typename NetworkProperties::community_weight_storage_type;
+    using weight_type = network::weight_type;
 
-    res_type res;
-    for (auto e : boost::make_iterator_range(boost::out_edges(u, g)))
-    {
-        const auto v = boost::target(e, g);
-        const auto w = boost::get(edge_weight, e);
-        const auto com = get(status.vertex_community, v);
-        res[com] += w;
-    }
+    std::vector< std::size_t > of_vertex;
+    std::vector< weight_type > out_strength;
+    std::vector< weight_type > in_strength;
+    std::vector< std::size_t > size;
+};
 
+// Places each vertex of a network in a community of its own, in O(V).
+inline auto make_singletons(const network& net) -> communities
+{
+    auto res = communities { .of_vertex
+                             = std::vector< std::size_t >(net.num_vertices()),
+                             .out_strength = net.out_strength,
+                             .in_strength = net.in_strength,
+                             .size = std::vector< std::size_t >(
+                                 net.num_vertices(), 1) };
+
+    std::iota(std::begin(res.of_vertex), std::end(res.of_vertex), 0);
     return res;
 }
 
-// Insert a vertex in community (connected by a given weight) and modify network
-// status.
-template < typename Vertex, typename NetworkProperties, typename Weight >
-inline auto community_insert(
-    Vertex u,
-    typename NetworkProperties::community_type com,
-    Weight w,
-    NetworkProperties& status) -> void
+// Moves a vertex of a network to a community, in O(1).
+inline auto move_vertex(
+    const network& net,
+    communities& coms,
+    std::size_t u,
+    std::size_t com) -> void
 {
-    status.vertex_community[u] = com;
-    status.community_incident[com] += get(status.vertex_incident, u);
-    status.community_internal[com] += w + get(status.vertex_loop, u);
-}
+    assert(com < net.num_vertices());
 
-// Remove a vertex from a community (connected by a given weight) and modify
-// network status.
-template < typename Vertex, typename NetworkProperties, typename Weight >
-inline auto community_remove(
-    Vertex u,
-    typename NetworkProperties::community_type com,
-    Weight w,
-    NetworkProperties& status) -> void
-{
-    using community_type = typename NetworkProperties::community_type;
-    using community_traits_type = community_traits< community_type >;
-    status.community_incident[com] -= get(status.vertex_incident, u);
-    status.community_internal[com] -= w - get(status.vertex_loop, u);
-    status.vertex_community[u] = community_traits_type::nil();
+    const auto from = coms.of_vertex[u];
+    assert(coms.size[from] > 0);
+
+    coms.out_strength[from] -= net.out_strength[u];
+    coms.in_strength[from] -= net.in_strength[u];
+    --coms.size[from];
+
+    coms.of_vertex[u] = com;
+    coms.out_strength[com] += net.out_strength[u];
+    coms.in_strength[com] += net.in_strength[u];
+    ++coms.size[com];
 }
 
-// Orders each community.
-// Called after one level, effectively decreases number of communities.
-template < typename VertexCommunityStorage >
-auto renumber_communities(const VertexCommunityStorage& vertex_community)
+// Renumbers the communities densely, in order of appearance, in O(V).
+// Returns the number of communities.
+inline auto renumber_communities(std::span< std::size_t > of_vertex)
+    -> std::size_t
 {
-    using community_type = typename VertexCommunityStorage::mapped_type;
-    using community_traits_type = community_traits< community_type >;
-    using temp_values = std::unordered_map< community_type, community_type >;
+    constexpr auto nil = static_cast< std::size_t >(-1);
 
-    temp_values new_coms;
-    VertexCommunityStorage res;
+    auto ids = std::vector< std::size_t >(of_vertex.size(), nil);
+    auto next = std::size_t(0);
 
-    for (auto i = community_traits_type::first();
-         auto v : std::ranges::views::keys(vertex_community))
+    for (auto& com : of_vertex)
     {
-        assert(i != community_traits_type::nil());
+        assert(com < ids.size());
 
-        const auto com = get(vertex_community, v);
-        auto com2 = get_or(new_coms, com, community_traits_type::nil());
+        if (ids[com] == nil)
+            ids[com] = next++;
 
-        if (com2 == community_traits_type::nil())
-        {
-            new_coms[com] = i;
-            com2 = i;
-            assert(i < community_traits_type::last());
-            community_advance(i);
-        }
-
-        res[v] = com2;
+        com = ids[com];
     }
 
-    assert(res.size() == vertex_community.size());
-    assert(std::all_of(
-        std::cbegin(vertex_community),
-        std::cend(vertex_community),
-        [&res](const auto& pair) { return res.contains(pair.first); }));
-
-    return res;
+    return next;
 }
 
 /***********************************************************
  * Modularity                                              *
  ***********************************************************/
 
-// Modularity (Q) of a community, given cached network properties.
-template < std::floating_point Modularity, typename NetworkProperties >
+// Modularity (Q) of the communities of a network, in O(V + E).
+// The resolution weighs the expected, (random), links of the communities.
 inline auto modularity(
-    const NetworkProperties& status,
-    typename NetworkProperties::community_type c) -> Modularity
+    const network& net,
+    const communities& coms,
+    double resolution = 1) -> double
 {
-    using community_type = typename NetworkProperties::community_type;
+    if (net.total == 0)
+        return 0;
 
-    assert(status.total > 0 && "why am I called?");
-    assert(c != community_traits< community_type >::nil());
+    auto internal = std::vector< double >(net.num_vertices(), 0);
+
+    for (std::size_t u = 0; u < net.num_vertices(); ++u)
+    {
+        const auto com = coms.of_vertex[u];
+        internal[com] += net.loops[u];
 
-    const Modularity s_in = get(status.community_internal, c);
-    const Modularity m = status.total;
-    const Modularity s_tot = get(status.community_incident, c);
-    return (s_in / (2 * m)) - std::pow(s_tot / (2 * m), 2);
+        // Each link is met from both of its vertices.
+        for (const auto& [v, w] : net.neighbours_of(u))
+            if (coms.of_vertex[v] == com)
+                internal[com] += w / 2;
+    }
+
+    auto res = 0.0;
+    for (std::size_t com = 0; com < net.num_vertices(); ++com)
+        res += internal[com]
+            - resolution * coms.out_strength[com] * coms.in_strength[com]
+                / net.total;
+
+    return res / net.total;
 }
 
-// Total modularity (Q) of a network.
-// NOTE: Emit Kronecker delta func by using a set of unique communities.
-template < std::floating_point Modularity, typename NetworkProperties >
-inline auto modularity(const NetworkProperties& status) -> Modularity
+// Returns the community of its neighbourhood (or its own one) that a vertex
+// gains the most modularity from moving into, in O(d log d).
+// Ties favor the current community, and then the lowest id.
+// NOTE: The scratch buffer is only used in order to avoid allocations.
+inline auto best_community(
+    const network& net,
+    const communities& coms,
+    std::size_t u,
+    double resolution,
+    std::vector< network::neighbour >& scratch) -> std::size_t
 {
-    using std::ranges::views::all;
-    using std::ranges::views::values;
+    assert(net.total > 0);
+
+    const auto own = coms.of_vertex[u];
+    auto own_links = 0.0;
 
-    if (status.total == 0) // Early exit.
-        return Modularity(0);
-    else
+    scratch.clear();
+    for (const auto& [v, w] : net.neighbours_of(u))
     {
-        const auto coms = make_set(values(status.vertex_community));
-        return misc::accumulate(
-            all(coms),
-            Modularity(0),
-            [&status](auto sum, auto c)
-            { return sum + modularity< Modularity >(status, c); });
+        if (v == u)
+            continue;
+
+        if (coms.of_vertex[v] == own)
+            own_links += w;
+        else
+            scratch.emplace_back(coms.of_vertex[v], w);
     }
-}
 
-// Delta modularity (DQ) of a vertex, within a network, given its neighbours and
-// a specific community.
-template < std::floating_point Modularity, typename NetworkProperties >
-inline auto delta_modularity(
-    const NetworkProperties& status,
-    typename NetworkProperties::vertex_type i,
-    const typename NetworkProperties::community_weight_storage_type& jcoms,
-    typename NetworkProperties::community_type jcom) -> Modularity
-{
-    assert(status.total > 0 && "why am I called?");
-    assert(jcoms.contains(jcom));
-    const Modularity k_in = get(status.vertex_incident, i);
-    const Modularity m = status.total;
-    const Modularity s_tot = get(status.community_incident, jcom);
-    const Modularity w = get(jcoms, jcom);
-    return w - s_tot * (k_in / (2 * m));
-}
+    // Of inserting the (isolated) vertex into a community, scaled by m.
+    const auto gain = [&](std::size_t com, double links)
+    {
+        auto out = coms.out_strength[com];
+        auto in = coms.in_strength[com];
 
-/***********************************************************
- * Induced Graph                                           *
- ***********************************************************/
+        if (com == own)
+        {
+            out -= net.out_strength[u];
+            in -= net.in_strength[u];
+        }
 
-// Special induced graph used on community aggregation
-template < typename Graph, typename EdgeWeightStorage >
-struct induced_graph
-{
-    using graph_type = Graph;
-    using edge_weight_storage_type = EdgeWeightStorage;
+        return links
+            - resolution
+            * (net.out_strength[u] * in + net.in_strength[u] * out)
+            / net.total;
+    };
 
-    Graph g;
-    EdgeWeightStorage edge_weight;
+    std::sort(
+        std::begin(scratch),
+        std::end(scratch),
+        [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
 
-    auto operator==(const induced_graph&) const -> bool = default;
-    auto operator!=(const induced_graph&) const -> bool = default;
-};
+    auto best = own;
+    auto best_gain = gain(own, own_links);
 
-// Factory for type deduction.
-template < typename Graph, typename EdgeWeightStorage >
-inline auto make_induced_graph(Graph g, EdgeWeightStorage edge_weight)
-{
-    return induced_graph< Graph, EdgeWeightStorage >(
-        std::move(g), std::move(edge_weight));
-}
+    for (std::size_t i = 0; i < scratch.size();)
+    {
+        const auto com = scratch[i].first;
+        auto links = 0.0;
 
-/***********************************************************
- * Dendrogram                                              *
- ***********************************************************/
+        for (; i < scratch.size() and scratch[i].first == com; ++i)
+            links += scratch[i].second;
 
-template < typename VertexCommunityStorage >
-using dendrogram = std::vector< VertexCommunityStorage >;
+        if (const auto g = gain(com, links); g > best_gain)
+        {
+            best = com;
+            best_gain = g;
+        }
+    }
+
+    return best;
+}
 
 /***********************************************************
  * Steps                                                   *
  ***********************************************************/
 
-// Computes one level of the communities dendrogram.
-template <
-    typename Graph,
-    typename NetworkProperties,
-    typename WeightMap,
-    std::floating_point Modularity = float,
-    typename RNG = std::mt19937 >
-auto modularity_optimization(
-    const Graph& g,
-    NetworkProperties& status,
-    WeightMap edge_weight,
-    Modularity min = 0.1,
-    RNG& rng = misc::rng()) -> void
+// Number of vertex batches per local moving pass.
+constexpr std::size_t batches_per_pass = 32;
+
+// Minimum number of vertices per batch, decided on multiple threads.
+constexpr std::size_t min_parallel_batch = 4096;
+
+// Upper bound of local moving passes, per level.
+constexpr auto max_passes = 64;
+
+// Moves a batch of vertices to their best communities, in O(sum d log d).
+// The moves are decided in parallel, against the communities before the batch,
+// and then committed in order, so that the result does not depend on the
+// number of threads.
+// Invokes the visitor with each moved vertex.
+template < typename Visitor >
+auto move_batch(
+    const network& net,
+    communities& coms,
+    std::span< const std::size_t > batch,
+    double resolution,
+    std::span< std::size_t > targets,
+    unsigned num_threads,
+    Visitor on_move) -> void
 {
-    auto do_loop = true;
-    auto cur_mod = modularity< Modularity >(status);
-    auto new_mod = cur_mod;
+    assert(targets.size() >= batch.size());
+
+    misc::parallel_for_each_chunk(
+        std::size_t(0),
+        batch.size(),
+        [&](auto first, auto last)
+        {
+            auto scratch = std::vector< network::neighbour >();
+
+            for (auto i = first; i != last; ++i)
+                targets[i]
+                    = best_community(net, coms, batch[i], resolution, scratch);
+        },
+        num_threads);
 
-    do
+    for (std::size_t i = 0; i < batch.size(); ++i)
     {
-        cur_mod = new_mod;
-        do_loop = false;
+        const auto u = batch[i];
+        const auto from = coms.of_vertex[u];
+        const auto to = targets[i];
 
-        // Make a random vertex ordering.
-        auto vertices = make_vector(misc::subrange(boost::vertices(g)));
-        std::shuffle(std::begin(vertices), std::end(vertices), rng);
+        if (to == from)
+            continue;
 
-        // Begin one level partition
-        for (auto i : vertices)
-        {
-            const auto com = get(status.vertex_community, i);
-            const auto jcoms = neighbor_communities(i, g, status, edge_weight);
+        // Stale decisions would swap singletons, instead of merging.
+        if (batch.size() > 1 and coms.size[from] == 1 and coms.size[to] == 1
+            and to > from)
+            continue;
 
-            community_remove(i, com, get_or(jcoms, i, 0), status);
+        move_vertex(net, coms, u, to);
+        on_move(u);
+    }
+}
 
-            auto best_com = com;
-            auto best_inc = 0;
+// Moves the vertices of a network to their best communities, pass by pass,
+// until the modularity gain of a pass drops below min, in O(V + E log d) per
+// pass.
+// Each pass visits the vertices in (random) batches. The batches depend only
+// on the network, so that the result does not depend on the number of threads.
+// Returns the total modularity gain.
+template < typename RNG >
+auto move_vertices(
+    const network& net,
+    communities& coms,
+    double min,
+    double resolution,
+    RNG& rng) -> double
+{
+    const auto n = net.num_vertices();
+    if (n == 0 or net.total == 0)
+        return 0;
 
-            // Compare DQ of i with each neighbor community.
-            for (auto jcom : std::ranges::views::keys(jcoms))
-            {
-                const auto dq
-                    = delta_modularity< Modularity >(status, i, jcoms, jcom);
+    const auto batch_size = std::max< std::size_t >(1, n / batches_per_pass);
+    const auto num_threads
+        = batch_size >= min_parallel_batch ? misc::hardware_concurrency() : 1u;
 
-                if (dq > best_inc)
-                {
-                    best_inc = dq;
-                    best_com = jcom;
-                }
-            }
+    auto order = std::vector< std::size_t >(n);
+    std::iota(std::begin(order), std::end(order), 0);
 
-            community_insert(i, best_com, get_or(jcoms, best_com, 0), status);
+    auto targets = std::vector< std::size_t >(batch_size);
 
-            if (best_com != com)
-                do_loop = false;
-        }
+    const auto initial = modularity(net, coms, resolution);
+    auto q = initial;
 
-        new_mod = modularity< Modularity >(status);
+    for (auto pass = 0; pass < max_passes; ++pass)
+    {
+        std::shuffle(std::begin(order), std::end(order), rng);
 
-        // Break cycle if DQ is below given threshold.
-        if (new_mod - cur_mod < min)
-            do_loop = false;
+        auto moved = false;
 
-    } while (do_loop);
-}
+        for (std::size_t first = 0; first < n; first += batch_size)
+        {
+            const auto last = std::min(n, first + batch_size);
+
+            move_batch(
+                net,
+                coms,
+                std::span(order).subspan(first, last - first),
+                resolution,
+                targets,
+                num_threads,
+                [&moved](auto) { moved = true; });
+        }
 
-// Performs community aggregation on an induced/root graph.
-// Returns new one.
-// Weight map is expected to be either the initial, or an adaptor from the
-// cached storage.
-template < typename Graph, typename WeightMap, typename VertexCommunityStorage >
-auto community_aggregation(
-    const Graph& g,
-    WeightMap edge_weight,
-    const VertexCommunityStorage& partition)
-{
-    using graph_traits = boost::graph_traits< Graph >;
-    using vertex_type = typename graph_traits::vertex_descriptor;
-    using edge_type = typename graph_traits::edge_descriptor;
-    using weight_map_traits = boost::property_traits< WeightMap >;
-    using weight_type = typename weight_map_traits::value_type;
+        if (!moved)
+            break;
 
-    using weight_storage_type = std::unordered_map<
-        edge_type,
-        weight_type,
-        detail::edge_vertices_hash,
-        detail::edge_vertices_equal_to >;
+        const auto new_q = modularity(net, coms, resolution);
+        const auto dq = new_q - q;
+        q = new_q;
 
-    using std::ranges::views::values;
+        if (dq <= 0 or dq < min)
+            break;
+    }
 
-    static_assert(std::is_arithmetic_v< vertex_type >);
+    return q - initial;
+}
 
-    Graph new_g;
-    weight_storage_type new_weights;
+// Collapses each community of a network into a vertex, and the links within
+// each community into a self loop, in O(V + E log E).
+// NOTE: Expects densely numbered communities.
+inline auto aggregate(
+    const network& net,
+    std::span< const std::size_t > of_vertex,
+    std::size_t num_communities) -> network
+{
+    assert(of_vertex.size() == net.num_vertices());
 
-    // Fill vertices.
-    // There is an 1-1 correspondence between each vertex and community, since
-    // the communities are ordered.
-    for (auto c [[maybe_unused]] : make_set(values(partition)))
-    {
-        [[maybe_unused]] const auto v = boost::add_vertex(new_g);
-        assert(static_cast< vertex_type >(c) == v && "1-1 correspondence");
-    }
+    auto res = network();
+    res.loops.assign(num_communities, 0);
+    res.out_strength.assign(num_communities, 0);
+    res.in_strength.assign(num_communities, 0);
+    res.total = net.total;
 
-    // Fill edges.
-    for (auto e : boost::make_iterator_range(boost::edges(g)))
-    {
-        const auto w = boost::get(edge_weight, e);
+    auto entries = std::vector< network_entry >();
+    entries.reserve(net.neighbours.size());
 
-        const auto com1 = get(partition, boost::source(e, g));
-        const auto com2 = get(partition, boost::target(e, g));
+    for (std::size_t u = 0; u < net.num_vertices(); ++u)
+    {
+        const auto com = of_vertex[u];
+        assert(com < num_communities);
 
-#ifndef NDEBUG
-        const auto new_verts = misc::subrange(boost::vertices(new_g));
-        assert(std::ranges::find(new_verts, com1) != std::cend(new_verts));
-        assert(std::ranges::find(new_verts, com2) != std::cend(new_verts));
-#endif
+        res.loops[com] += net.loops[u];
+        res.out_strength[com] += net.out_strength[u];
+        res.in_strength[com] += net.in_strength[u];
 
-        const auto [curr_e, curr_exists] = boost::edge(com1, com2, new_g);
-        if (curr_exists)
+        for (const auto& [v, w] : net.neighbours_of(u))
         {
-            new_weights[curr_e] += w;
-            continue;
+            if (of_vertex[v] == com)
+                res.loops[com] += w / 2; // met from both vertices
+            else
+                entries.push_back(
+                    { .row = com, .column = of_vertex[v], .weight = w });
         }
-
-        const auto [new_e, new_exists] = boost::add_edge(com1, com2, new_g);
-        assert(new_exists);
-        new_weights[new_e] = w;
     }
 
-    return make_induced_graph(std::move(new_g), std::move(new_weights));
+    set_neighbours(res, std::move(entries));
+    return res;
 }
 
 /***********************************************************
@@ -557,48 +530,25 @@ auto cluster_in_isolation(const Graph& g, ClusterMap vertex_cluster) -> void
         boost::put(vertex_cluster, u, c++);
 }
 
-// Utility, returns the community of a vertex from an unwrapped dendrogram.
-template < typename Dendrogram, typename Vertex >
-auto community(
-    const Dendrogram& parts,
-    typename Dendrogram::const_iterator part_iter,
-    Vertex u)
-{
-    assert(!parts.empty());
-    assert(part_iter != std::cend(parts));
-
-    const bool on_last_partition = (part_iter == std::cend(parts) - 1);
-    if (on_last_partition)
-        return get(*part_iter, u);
-    else
-        return community(parts, part_iter + 1, get(*part_iter, u));
-}
-
-// Utility, returns the community of a vertex from an unwrapped dendrogram.
-template < typename Dendrogram, typename Vertex >
-inline auto community(const Dendrogram& parts, Vertex u)
-{
-    return community(parts, std::cbegin(parts), u);
-}
-
-template < typename Graph, typename ClusterMap, typename Dendrogram >
-auto cluster_from_dendrogram(
+// Copies the (network) communities of each graph vertex to a cluster map.
+template < typename Graph, typename ClusterMap >
+auto cluster_from_communities(
     const Graph& g,
-    ClusterMap vertex_cluster,
-    const Dendrogram& partitions) -> void
+    std::span< const std::size_t > vertex_community,
+    ClusterMap vertex_cluster) -> void
 {
     using cluster_map_traits = boost::property_traits< ClusterMap >;
     using cluster_type = typename cluster_map_traits::value_type;
-    using vertex_community_storage = typename Dendrogram::value_type;
-    using community_type = typename vertex_community_storage::mapped_type;
-
-    static_assert(std::is_convertible_v< community_type, cluster_type >);
 
-    assert(!partitions.empty());
+    const auto index = boost::get(boost::vertex_index, g);
 
-    // Copy communities from dendrogram to cluster map.
     for (auto u : boost::make_iterator_range(boost::vertices(g)))
-        boost::put(vertex_cluster, u, community(partitions, u));
+    {
+        const auto i = static_cast< std::size_t >(boost::get(index, u));
+        assert(i < vertex_community.size());
+        const auto c = static_cast< cluster_type >(vertex_community[i]);
+        boost::put(vertex_cluster, u, c);
+    }
 }
 
 } // namespace clustering::louvain_detail
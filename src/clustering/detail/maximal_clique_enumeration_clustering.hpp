@@ -5,33 +5,56 @@
 #ifndef CLUSTERING_DETAIL_MAXIMAL_CLIQUE_ENUMERATION_CLUSTERING_HPP
 #define CLUSTERING_DETAIL_MAXIMAL_CLIQUE_ENUMERATION_CLUSTERING_HPP
 
-#include <numeric> // for numeric_limits
+#include "misc/parallel.hpp" // for parallel_for, hardware_concurrency
+
+#include <algorithm>                      // for sort, binary_search, etc
+#include <atomic>                         // for atomic
+#include <boost/graph/adjacency_list.hpp> // for adjacent_vertices, etc
+#include <cassert>                        // for assert
+#include <chrono>                         // for steady_clock
+#include <cstddef>                        // for size_t
+#include <iterator>                       // for back_inserter
+#include <limits>                         // for numeric_limits
+#include <span>                           // for span
+#include <utility>                        // for pair
+#include <vector>                         // for vector
 
 namespace clustering::detail
 {
 
+// Records the largest cliques visited so far, (in order), as they are streamed
+// from a clique visitor.
 // NOTE: Use of custom output iterator to comply with boost vistor.clique()
 // api.
-template < typename CliqueMap >
-struct clique_size_record_iterator
+template < typename Cliques >
+struct largest_clique_record_iterator
 {
-    explicit clique_size_record_iterator(CliqueMap& map) : cliques { map } { }
+    explicit largest_clique_record_iterator(Cliques& cliques)
+    : cliques { cliques }
+    {
+    }
 
     template < typename Clique, typename Graph >
     inline auto clique(const Clique& p, const Graph&) -> void
     {
-        cliques.insert({ p.size(), p });
+        if (!cliques.empty() and p.size() < std::size(cliques.front()))
+            return;
+
+        if (!cliques.empty() and p.size() > std::size(cliques.front()))
+            cliques.clear();
+
+        cliques.emplace_back(std::begin(p), std::end(p));
     }
 
 private:
-    CliqueMap& cliques;
+    Cliques& cliques;
 };
 
 // Factory for type deduction.
-template < typename CliqueMap >
-inline auto clique_size_recorder(CliqueMap& map)
+template < typename Cliques >
+inline auto largest_clique_recorder(Cliques& cliques)
 {
-    return clique_size_record_iterator< CliqueMap > { map };
+    return largest_clique_record_iterator< Cliques > { cliques };
 }
 
 template < typename Cluster >
@@ -48,4 +71,453 @@ inline auto advance_shared_cluster(Cluster cluster) -> Cluster
 
 } // namespace clustering::detail
 
+namespace clustering::mce_detail
+{
+
+using clock = std::chrono::steady_clock;
+
+// Minimum number of vertices, whose cliques are searched on multiple threads.
+constexpr std::size_t min_parallel_vertices = 1024;
+
+// Number of search branches between two checks of the time limit.
+constexpr std::size_t deadline_period = 256;
+
+/***********************************************************
+ * Network                                                 *
+ ***********************************************************/
+
+// The sorted, mutually adjacent vertices of each vertex, in compressed rows,
+// indexed by the vertex indices of a graph, without self loops or parallel
+// edges.
+struct network
+{
+    std::vector< std::size_t > offsets;
+    std::vector< std::size_t > neighbours;
+
+    auto num_vertices() const -> std::size_t
+    {
+        return offsets.empty() ? 0 : offsets.size() - 1;
+    }
+
+    auto neighbours_of(std::size_t u) const -> std::span< const std::size_t >
+    {
+        assert(u < num_vertices());
+        return std::span(neighbours)
+            .subspan(offsets[u], offsets[u + 1] - offsets[u]);
+    }
+
+    auto adjacent(std::size_t u, std::size_t v) const -> bool
+    {
+        const auto row = neighbours_of(u);
+        return std::binary_search(std::begin(row), std::end(row), v);
+    }
+};
+
+// Makes the network of a graph, in O(V + E log d).
+// NOTE: The vertices of a directed graph are adjacent only if they are
+// connected both ways, as in boost::bron_kerbosch_all_cliques.
+template < typename Graph >
+auto make_network(const Graph& g) -> network
+{
+    const auto n = static_cast< std::size_t >(boost::num_vertices(g));
+    const auto index = boost::get(boost::vertex_index, g);
+
+    const auto index_of = [index](auto v)
+    { return static_cast< std::size_t >(boost::get(index, v)); };
+
+    // The sorted, deduplicated, adjacent vertices of each vertex, in rows of
+    // (at most) the out degree of each vertex.
+
+    auto offsets = std::vector< std::size_t >(n + 1, 0);
+    auto sizes = std::vector< std::size_t >(n, 0);
+
+    for (auto u : boost::make_iterator_range(boost::vertices(g)))
+        offsets[index_of(u) + 1] = boost::out_degree(u, g);
+
+    for (std::size_t u = 0; u < n; ++u)
+        offsets[u + 1] += offsets[u];
+
+    auto adjacent = std::vector< std::size_t >(offsets.back());
+
+    for (auto u : boost::make_iterator_range(boost::vertices(g)))
+    {
+        const auto i = index_of(u);
+        for (auto v :
+             boost::make_iterator_range(boost::adjacent_vertices(u, g)))
+            adjacent[offsets[i] + sizes[i]++] = index_of(v);
+    }
+
+    const auto row = [&](std::size_t u)
+    { return std::span(adjacent).subspan(offsets[u], sizes[u]); };
+
+    for (std::size_t u = 0; u < n; ++u)
+    {
+        const auto r = row(u);
+        std::sort(std::begin(r), std::end(r));
+        const auto last = std::unique(std::begin(r), std::end(r));
+        sizes[u] = std::remove(std::begin(r), last, u) - std::begin(r);
+    }
+
+    // The mutually adjacent ones.
+
+    auto res = network();
+    res.offsets.assign(n + 1, 0);
+    res.neighbours.reserve(adjacent.size());
+
+    for (std::size_t u = 0; u < n; ++u)
+    {
+        for (auto v : row(u))
+        {
+            const auto r = row(v);
+            if (std::binary_search(std::begin(r), std::end(r), u))
+                res.neighbours.push_back(v);
+        }
+
+        res.offsets[u + 1] = res.neighbours.size();
+    }
+
+    return res;
+}
+
+// Orders the vertices by their core numbers, (as if repeatedly removing a
+// vertex of minimum degree), in O(V + E).
+// NOTE: Each vertex has at most as many later neighbours as the degeneracy of
+// the network.
+// See: https://arxiv.org/abs/cs/0310049
+inline auto degeneracy_order(const network& net) -> std::vector< std::size_t >
+{
+    const auto n = net.num_vertices();
+
+    auto degree = std::vector< std::size_t >(n);
+    auto max_degree = std::size_t(0);
+
+    for (std::size_t u = 0; u < n; ++u)
+    {
+        degree[u] = net.neighbours_of(u).size();
+        max_degree = std::max(max_degree, degree[u]);
+    }
+
+    // The first position of each degree, in a bucket sort of the vertices.
+    auto bin = std::vector< std::size_t >(max_degree + 1, 0);
+    for (auto d : degree)
+        ++bin[d];
+
+    for (std::size_t d = 0, first = 0; d <= max_degree; ++d)
+        first += std::exchange(bin[d], first);
+
+    auto pos = std::vector< std::size_t >(n);
+    auto res = std::vector< std::size_t >(n);
+
+    for (std::size_t u = 0; u < n; ++u)
+    {
+        pos[u] = bin[degree[u]]++;
+        res[pos[u]] = u;
+    }
+
+    for (auto d = max_degree; d > 0; --d)
+        bin[d] = bin[d - 1];
+    bin[0] = 0;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const auto v = res[i];
+
+        for (auto u : net.neighbours_of(v))
+        {
+            if (degree[u] <= degree[v])
+                continue;
+
+            // Swap u with the first vertex of its degree, and shrink it.
+            const auto w = res[bin[degree[u]]];
+            if (u != w)
+            {
+                std::swap(res[pos[u]], res[pos[w]]);
+                std::swap(pos[u], pos[w]);
+            }
+
+            ++bin[degree[u]];
+            --degree[u];
+        }
+    }
+
+    return res;
+}
+
+/***********************************************************
+ * Search                                                  *
+ ***********************************************************/
+
+// The limits of a clique search.
+struct bounds
+{
+    std::size_t min_size { 2 };
+    std::size_t max_cliques { std::numeric_limits< std::size_t >::max() };
+    clock::time_point deadline { clock::time_point::max() };
+};
+
+// The state shared between the search threads.
+struct search_state
+{
+    std::atomic< std::size_t > best { 0 };
+    std::atomic< std::size_t > num_cliques { 0 };
+    std::atomic< bool > stopped { false };
+};
+
+// The largest cliques found by a thread, along with the (degeneracy) position
+// of the vertex whose search found them.
+struct clique_buffer
+{
+    using clique = std::vector< std::size_t >;
+    using entry = std::pair< std::size_t, clique >;
+
+    std::size_t size { 0 };
+    std::vector< entry > cliques;
+};
+
+// The largest cliques found by a search, and whether it ran to completion.
+struct search_result
+{
+    std::vector< std::vector< std::size_t > > cliques;
+    bool complete { true };
+};
+
+// Keeps the vertices of a sorted set that are adjacent to a vertex.
+inline auto restrict_to_neighbours(
+    const network& net,
+    std::span< const std::size_t > set,
+    std::size_t v) -> std::vector< std::size_t >
+{
+    auto res = std::vector< std::size_t >();
+    std::copy_if(
+        std::begin(set),
+        std::end(set),
+        std::back_inserter(res),
+        [&net, v](auto u) { return net.adjacent(v, u); });
+    return res;
+}
+
+// Picks the (Tomita) pivot, out of the candidate and excluded vertices, with
+// the most candidate neighbours.
+inline auto pick_pivot(
+    const network& net,
+    const std::vector< std::size_t >& candidates,
+    const std::vector< std::size_t >& excluded) -> std::size_t
+{
+    assert(!candidates.empty() or !excluded.empty());
+
+    auto res = candidates.empty() ? excluded.front() : candidates.front();
+    auto res_links = std::size_t(0);
+
+    for (const auto* set : { &candidates, &excluded })
+    {
+        for (auto u : *set)
+        {
+            const auto links = static_cast< std::size_t >(std::count_if(
+                std::begin(candidates),
+                std::end(candidates),
+                [&net, u](auto v) { return net.adjacent(u, v); }));
+
+            if (links > res_links)
+                res = u, res_links = links;
+        }
+    }
+
+    return res;
+}
+
+// Records a maximal clique, if not smaller than the largest ones found so far.
+// NOTE: Every maximal clique reached counts towards the limit, recorded or not.
+inline auto record_clique(
+    const std::vector< std::size_t >& clique,
+    std::size_t position,
+    const bounds& limits,
+    search_state& state,
+    clique_buffer& buffer) -> void
+{
+    if (state.num_cliques.fetch_add(1, std::memory_order_relaxed) + 1
+        >= limits.max_cliques)
+        state.stopped.store(true, std::memory_order_relaxed);
+
+    auto best = state.best.load(std::memory_order_relaxed);
+
+    if (clique.size() < best)
+        return;
+
+    while (best < clique.size()
+           and !state.best.compare_exchange_weak(
+               best, clique.size(), std::memory_order_relaxed))
+        ;
+
+    if (clique.size() > buffer.size)
+    {
+        buffer.size = clique.size();
+        buffer.cliques.clear();
+    }
+
+    auto sorted = clique;
+    std::sort(std::begin(sorted), std::end(sorted));
+    buffer.cliques.emplace_back(position, std::move(sorted));
+}
+
+// Bron Kerbosch with Tomita pivoting, from a clique, over its candidate and
+// excluded (sorted) vertices.
+// Skips the branches that cannot reach the largest cliques found so far.
+inline auto expand_clique(
+    const network& net,
+    std::vector< std::size_t >& clique,
+    std::vector< std::size_t > candidates,
+    std::vector< std::size_t > excluded,
+    std::size_t position,
+    const bounds& limits,
+    search_state& state,
+    clique_buffer& buffer,
+    std::size_t& branches) -> void
+{
+    if (state.stopped.load(std::memory_order_relaxed))
+        return;
+
+    if (++branches % deadline_period == 0 and clock::now() >= limits.deadline)
+    {
+        state.stopped.store(true, std::memory_order_relaxed);
+        return;
+    }
+
+    if (candidates.empty())
+    {
+        if (excluded.empty())
+            record_clique(clique, position, limits, state, buffer);
+        return;
+    }
+
+    const auto pivot = pick_pivot(net, candidates, excluded);
+
+    auto branch_vertices = std::vector< std::size_t >();
+    std::copy_if(
+        std::begin(candidates),
+        std::end(candidates),
+        std::back_inserter(branch_vertices),
+        [&net, pivot](auto v) { return !net.adjacent(pivot, v); });
+
+    for (auto v : branch_vertices)
+    {
+        if (clique.size() + candidates.size()
+                < state.best.load(std::memory_order_relaxed)
+            or state.stopped.load(std::memory_order_relaxed))
+            return;
+
+        clique.push_back(v);
+        expand_clique(
+            net,
+            clique,
+            restrict_to_neighbours(net, candidates, v),
+            restrict_to_neighbours(net, excluded, v),
+            position,
+            limits,
+            state,
+            buffer,
+            branches);
+        clique.pop_back();
+
+        candidates.erase(
+            std::lower_bound(std::begin(candidates), std::end(candidates), v));
+        excluded.insert(
+            std::lower_bound(std::begin(excluded), std::end(excluded), v), v);
+    }
+}
+
+// Finds the largest maximal cliques of a network, (of at least min size), by
+// searching from each vertex, in degeneracy order, the cliques of its later
+// neighbours, on multiple threads.
+// The cliques are ordered by the (degeneracy) position of their vertex whose
+// search found them.
+// NOTE: Unless stopped by the limits, the result does not depend on the number
+// of threads.
+inline auto largest_cliques(
+    const network& net,
+    const bounds& limits,
+    unsigned num_threads) -> search_result
+{
+    assert(limits.min_size > 0);
+    assert(limits.max_cliques > 0);
+
+    const auto n = net.num_vertices();
+    const auto order = degeneracy_order(net);
+
+    auto position = std::vector< std::size_t >(n);
+    for (std::size_t i = 0; i < n; ++i)
+        position[order[i]] = i;
+
+    auto state = search_state();
+    state.best = limits.min_size;
+
+    auto buffers = std::vector< clique_buffer >(std::max(1u, num_threads));
+    auto next = std::atomic< std::size_t >(0);
+
+    misc::parallel_for(
+        std::size_t(0),
+        buffers.size(),
+        [&](auto t)
+        {
+            auto clique = std::vector< std::size_t >();
+            auto branches = std::size_t(0);
+
+            for (auto i = next++;
+                 i < n and !state.stopped.load(std::memory_order_relaxed);
+                 i = next++)
+            {
+                const auto v = order[i];
+                const auto row = net.neighbours_of(v);
+
+                auto candidates = std::vector< std::size_t >();
+                auto excluded = std::vector< std::size_t >();
+
+                for (auto u : row)
+                    (position[u] > i ? candidates : excluded).push_back(u);
+
+                if (1 + candidates.size()
+                    < state.best.load(std::memory_order_relaxed))
+                    continue;
+
+                clique.assign(1, v);
+                expand_clique(
+                    net,
+                    clique,
+                    std::move(candidates),
+                    std::move(excluded),
+                    i,
+                    limits,
+                    state,
+                    buffers[t],
+                    branches);
+            }
+        },
+        static_cast< unsigned >(buffers.size()));
+
+    auto found = std::vector< clique_buffer::entry >();
+    const auto best = state.best.load();
+
+    for (auto& buffer : buffers)
+        if (buffer.size == best)
+            std::move(
+                std::begin(buffer.cliques),
+                std::end(buffer.cliques),
+                std::back_inserter(found));
+
+    std::stable_sort(
+        std::begin(found),
+        std::end(found),
+        [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    auto res = search_result();
+    res.complete = !state.stopped.load();
+    res.cliques.reserve(found.size());
+
+    for (auto& [pos, clique] : found)
+        res.cliques.push_back(std::move(clique));
+
+    return res;
+}
+
+} // namespace clustering::mce_detail
+
 #endif // CLUSTERING_DETAIL_MAXIMAL_CLIQUE_ENUMERATION_CLUSTERING_HPP
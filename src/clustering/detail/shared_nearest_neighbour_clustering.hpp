@@ -4,38 +4,242 @@
 #ifndef CLUSTERING_DETAIL_SHARED_NEAREST_NEIGHBOUR_CLUSTERING_HPP
 #define CLUSTERING_DETAIL_SHARED_NEAREST_NEIGHBOUR_CLUSTERING_HPP
 
-#include "misc/algorithm.hpp" // for set_intersection
+#include "misc/parallel.hpp" // for parallel_for, hardware_concurrency
 
+#include <algorithm>                      // for sort, lower_bound, max
+#include <boost/dynamic_bitset.hpp>       // for dynamic_bitset
 #include <boost/graph/adjacency_list.hpp> // for source, target, etc
+#include <cassert>                        // for assert
+#include <cstddef>                        // for size_t
+#include <limits>                         // for numeric_limits
+#include <span>                           // for span
+#include <utility>                        // for pair
+#include <vector>                         // for vector
 
 namespace clustering::detail
 {
 
-// Fills a property map of edge keys with the number of shared neighbours of
-// each src and target.
-template < typename Graph, typename ProximityMap >
-auto shared_nearest_neighbour(const Graph& g, ProximityMap edge_proximity)
-    -> void
+/***********************************************************
+ * Neighbourhoods                                          *
+ ***********************************************************/
+
+// The sorted, deduplicated, adjacent vertices of each vertex, along with the
+// number of times each one is adjacent, in compressed rows, indexed by the
+// vertex indices of a graph.
+struct neighbourhoods
+{
+    using neighbour = std::pair< std::size_t, std::size_t >;
+    using row = std::pair< std::size_t, std::size_t >;
+
+    std::vector< row > rows;
+    std::vector< neighbour > neighbours;
+
+    auto num_vertices() const -> std::size_t { return rows.size(); }
+
+    auto neighbours_of(std::size_t u) const -> std::span< const neighbour >
+    {
+        assert(u < num_vertices());
+        const auto [first, last] = rows[u];
+        return std::span(neighbours).subspan(first, last - first);
+    }
+};
+
+// Makes the neighbourhoods of a graph, in O(V + E log d).
+template < typename Graph >
+auto make_neighbourhoods(const Graph& g) -> neighbourhoods
+{
+    const auto index = boost::get(boost::vertex_index, g);
+
+    auto res = neighbourhoods();
+    res.rows.resize(static_cast< std::size_t >(boost::num_vertices(g)));
+
+    auto adjacent = std::vector< std::size_t >();
+
+    for (auto u : boost::make_iterator_range(boost::vertices(g)))
+    {
+        adjacent.clear();
+        for (auto v :
+             boost::make_iterator_range(boost::adjacent_vertices(u, g)))
+            adjacent.push_back(
+                static_cast< std::size_t >(boost::get(index, v)));
+
+        std::sort(std::begin(adjacent), std::end(adjacent));
+
+        const auto first = res.neighbours.size();
+
+        for (std::size_t i = 0; i < adjacent.size();)
+        {
+            const auto v = adjacent[i];
+            auto times = std::size_t(0);
+
+            for (; i < adjacent.size() and adjacent[i] == v; ++i)
+                ++times;
+
+            res.neighbours.emplace_back(v, times);
+        }
+
+        res.rows[boost::get(index, u)] = { first, res.neighbours.size() };
+    }
+
+    return res;
+}
+
+/***********************************************************
+ * Intersections                                           *
+ ***********************************************************/
+
+using neighbour_span = std::span< const neighbourhoods::neighbour >;
+
+// Degree ratio, past which the smaller neighbourhood is searched in the larger.
+constexpr std::size_t gallop_ratio = 32;
+
+// Minimum number of (distinct) neighbours of a hub vertex, whose neighbourhood
+// is stored in a bitset, (in addition to the vertices per bitset word).
+constexpr std::size_t min_hub_degree = 1024;
+
+// Minimum number of edges, processed on multiple threads.
+constexpr std::size_t min_parallel_edges = 4096;
+
+// Number of times the vertices of u are adjacent to vertices of v, by merging
+// both neighbourhoods, in O(du + dv).
+inline auto merge_shared(neighbour_span u, neighbour_span v) -> std::size_t
+{
+    auto res = std::size_t(0);
+
+    for (auto i = std::begin(u), j = std::begin(v);
+         i != std::end(u) and j != std::end(v);)
+    {
+        if (i->first < j->first)
+            ++i;
+        else if (j->first < i->first)
+            ++j;
+        else
+            res += (i++)->second, ++j;
+    }
+
+    return res;
+}
+
+// Number of times the vertices of u are adjacent to vertices of v, by
+// searching each neighbour of the smaller neighbourhood in the larger one, in
+// O(min(du, dv) log max(du, dv)).
+inline auto gallop_shared(neighbour_span u, neighbour_span v) -> std::size_t
 {
-    using graph_traits = boost::graph_traits< Graph >;
-    using vertex_type = typename graph_traits::vertex_descriptor;
-    using vertices_type = std::vector< vertex_type >;
+    const auto u_probes = u.size() <= v.size();
+    const auto probes = u_probes ? u : v;
+    const auto targets = u_probes ? v : u;
 
-    // for each edge (u, v), u -> v
-    for (auto edge : boost::make_iterator_range(boost::edges(g)))
+    auto res = std::size_t(0);
+    auto first = std::begin(targets);
+
+    for (const auto& probe : probes)
     {
-        const auto u = boost::source(edge, g);
-        const auto [ubegin, uend] = boost::adjacent_vertices(u, g);
+        first = std::lower_bound(
+            first,
+            std::end(targets),
+            probe,
+            [](const auto& lhs, const auto& rhs)
+            { return lhs.first < rhs.first; });
+
+        if (first == std::end(targets))
+            break;
+
+        if (first->first == probe.first)
+            res += u_probes ? probe.second : first->second;
+    }
 
-        const auto v = boost::target(edge, g);
-        const auto [vbegin, vend] = boost::adjacent_vertices(v, g);
+    return res;
+}
+
+// Number of times the vertices of u are adjacent to vertices of v, given the
+// neighbourhood bitset of v, in O(du).
+inline auto bitset_shared(neighbour_span u, const boost::dynamic_bitset<>& v)
+    -> std::size_t
+{
+    auto res = std::size_t(0);
+
+    for (const auto& [w, times] : u)
+        if (v.test(w))
+            res += times;
 
-        vertices_type intersection;
-        misc::set_intersection(
-            ubegin, uend, vbegin, vend, std::back_inserter(intersection));
+    return res;
+}
+
+/***********************************************************
+ * Shared Nearest Neighbour                                *
+ ***********************************************************/
+
+// Returns the number of shared neighbours of the source and target of each
+// edge, in the order of the graph edges.
+// The neighbours of the source are counted as many times as they are adjacent
+// to the source.
+// The neighbourhoods of very high degree vertices are stored in bitsets, and
+// the edges are processed in parallel.
+template < typename Graph >
+auto shared_nearest_neighbour(const Graph& g) -> std::vector< std::size_t >
+{
+    constexpr auto nil = std::numeric_limits< std::size_t >::max();
 
-        boost::put(edge_proximity, edge, intersection.size());
+    const auto index = boost::get(boost::vertex_index, g);
+    const auto hoods = make_neighbourhoods(g);
+    const auto n = hoods.num_vertices();
+
+    // The neighbourhood bitset of each hub vertex.
+
+    const auto hub_degree = std::max(min_hub_degree, n / 64);
+
+    auto hub = std::vector< std::size_t >(n, nil);
+    auto bitsets = std::vector< boost::dynamic_bitset<> >();
+
+    for (std::size_t u = 0; u < n; ++u)
+    {
+        if (hoods.neighbours_of(u).size() < hub_degree)
+            continue;
+
+        hub[u] = bitsets.size();
+        auto& bits = bitsets.emplace_back(n);
+
+        for (const auto& [v, times] : hoods.neighbours_of(u))
+            bits.set(v);
     }
+
+    // The edge endpoints.
+
+    auto endpoints = std::vector< std::pair< std::size_t, std::size_t > >();
+    endpoints.reserve(static_cast< std::size_t >(boost::num_edges(g)));
+
+    for (auto e : boost::make_iterator_range(boost::edges(g)))
+        endpoints.emplace_back(
+            static_cast< std::size_t >(boost::get(index, boost::source(e, g))),
+            static_cast< std::size_t >(boost::get(index, boost::target(e, g))));
+
+    auto res = std::vector< std::size_t >(endpoints.size());
+
+    const auto num_threads = endpoints.size() >= min_parallel_edges
+        ? misc::hardware_concurrency()
+        : 1u;
+
+    misc::parallel_for(
+        std::size_t(0),
+        endpoints.size(),
+        [&](auto i)
+        {
+            const auto [u, v] = endpoints[i];
+            const auto uhood = hoods.neighbours_of(u);
+            const auto vhood = hoods.neighbours_of(v);
+
+            if (hub[v] != nil)
+                res[i] = bitset_shared(uhood, bitsets[hub[v]]);
+            else if (
+                uhood.size() * gallop_ratio < vhood.size()
+                or vhood.size() * gallop_ratio < uhood.size())
+                res[i] = gallop_shared(uhood, vhood);
+            else
+                res[i] = merge_shared(uhood, vhood);
+        },
+        num_threads);
+
+    return res;
 }
 
 // Little heuristic, not complete by any means.
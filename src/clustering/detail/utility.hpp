@@ -4,26 +4,40 @@
 #ifndef CLUSTERING_DETAIL_UTILITY_HPP
 #define CLUSTERING_DETAIL_UTILITY_HPP
 
-#include <cstdint>       // for uint64_t
-#include <unordered_map> // for hash
+#include "misc/boost_graphfwd.hpp" // for csr_edge_descriptor
+
+#include <boost/container_hash/hash.hpp> // for hash_combine
+#include <cstdint>                        // for uint64_t
+#include <unordered_map>                  // for hash
 
 namespace clustering::detail
 {
 
+// NOTE: Combining (identity) hashes by multiplication collides heavily, e.g.
+// (u, v) & (v, u), or any edge touching vertex 0.
+
 // Hashes the edge vertices & property.
 struct edge_hash
 {
     using num_type = uint64_t;
-    using hash_type = std::hash< num_type >;
 
     template < typename Edge >
-    inline auto operator()(Edge e) const -> auto
+    inline auto operator()(Edge e) const -> std::size_t
     {
-        const auto p = hash_type()(reinterpret_cast< num_type >(e.m_eproperty));
-        const auto s = hash_type()(reinterpret_cast< num_type >(e.m_source));
-        const auto t = hash_type()(reinterpret_cast< num_type >(e.m_target));
+        auto seed = std::size_t(0);
+        boost::hash_combine(seed, reinterpret_cast< num_type >(e.m_eproperty));
+        boost::hash_combine(seed, reinterpret_cast< num_type >(e.m_source));
+        boost::hash_combine(seed, reinterpret_cast< num_type >(e.m_target));
+        return seed;
+    }
 
-        return p * s * t;
+    // Compressed sparse row edges are identified by their index.
+    template < typename Vertex, typename EdgeIndex >
+    inline auto
+    operator()(boost::detail::csr_edge_descriptor< Vertex, EdgeIndex > e) const
+        -> std::size_t
+    {
+        return boost::hash_value(e.idx);
     }
 };
 
@@ -31,15 +45,14 @@ struct edge_hash
 struct edge_vertices_hash
 {
     using num_type = uint64_t;
-    using hash_type = std::hash< num_type >;
 
     template < typename Edge >
-    inline auto operator()(Edge e) const
+    inline auto operator()(Edge e) const -> std::size_t
     {
-        const auto s = hash_type()(reinterpret_cast< num_type >(e.m_source));
-        const auto t = hash_type()(reinterpret_cast< num_type >(e.m_target));
-
-        return s * t;
+        auto seed = std::size_t(0);
+        boost::hash_combine(seed, reinterpret_cast< num_type >(e.m_source));
+        boost::hash_combine(seed, reinterpret_cast< num_type >(e.m_target));
+        return seed;
     }
 };
 
@@ -4,19 +4,23 @@
 #ifndef CLUSTERING_K_SPANNING_TREE_CLUSTERING_HPP
 #define CLUSTERING_K_SPANNING_TREE_CLUSTERING_HPP
 
-#include "detail/k_spanning_tree_clustering.hpp" // for k_spanning_tree_clustering
-#include "detail/utility.hpp"                    // for max_weighted
+#include "detail/k_spanning_tree_clustering.hpp" // for select_heaviest, etc
 
 #include <boost/graph/adjacency_list.hpp> // for vertices
 #include <boost/graph/graph_utility.hpp>  // for has_no_vertices
 #include <cassert>                        // for assert
+#include <cstddef>                        // for size_t
+#include <iterator>                       // for back_insert_iterator
 #include <type_traits>                    // for is_integral_v
-#include <unordered_set>                  // for unordered_set
+#include <vector>                         // for vector
 
 namespace clustering
 {
 
 // k-Spanning Tree graph clustering algorithm.
+// Removes the k - 1 heaviest edges of a minimum spanning tree, and clusters
+// the vertices by the components of the rest of the tree, in O(V + E a(V)),
+// (on top of the minimum spanning tree).
 template <
     typename Graph,
     typename MinimumSpanningTreeFunc,
@@ -43,14 +47,14 @@ auto k_spanning_tree_clustering(
 
     using graph_traits = boost::graph_traits< Graph >;
     using edge_type = typename graph_traits::edge_descriptor;
-    using edges_set = std::unordered_set< edge_type, detail::edge_hash >;
+    using edges_vector = std::vector< edge_type >;
     using cluster_map_traits = boost::property_traits< ClusterMap >;
     using cluster_type = typename cluster_map_traits::value_type;
 
     static_assert(std::is_invocable_v<
                   MinimumSpanningTreeFunc,
                   const Graph&,
-                  std::insert_iterator< edges_set >,
+                  std::back_insert_iterator< edges_vector >,
                   WeightMap >);
 
     static_assert(std::is_integral_v< cluster_type >);
@@ -61,38 +65,19 @@ auto k_spanning_tree_clustering(
     if (boost::graph::has_no_vertices(g))
         return;
 
-    // Fill mst edge set.
-    auto mst = edges_set();
-    fill_mst(g, std::inserter(mst, std::begin(mst)), edge_weight);
+    // Fill mst edge vector.
+    auto mst = edges_vector();
+    fill_mst(g, std::back_inserter(mst), edge_weight);
 
-    // Remove k-1 highest weight edges from the mst set.
-    const auto steps = k - 1;
-    for (decltype(k) i = 0; i < steps; ++i)
-    {
-        const auto iter = detail::max_weighted(mst, edge_weight);
-        const bool out_of_edges = (iter == std::cend(mst));
-
-        if (out_of_edges)
-            break;
-        else
-            mst.erase(iter);
-    }
+    // Skip k-1 highest weight edges of the mst.
+    const auto removed = detail::select_heaviest(
+        mst, static_cast< std::size_t >(k - 1), edge_weight);
 
     // Assign vertices to clusters.
-    constexpr cluster_type mst_cluster = 0;
-    cluster_type isolated_cluster = mst_cluster + 1;
-
-    for (auto v : boost::make_iterator_range(boost::vertices(g)))
-    {
-        assert(isolated_cluster != mst_cluster);
-
-        if (detail::is_referenced(g, mst, v))
-            boost::put(vertex_cluster, v, mst_cluster);
-        else
-            boost::put(vertex_cluster, v, isolated_cluster++);
-    }
+    const auto component = detail::connected_components(
+        g, std::next(std::begin(mst), removed), std::end(mst));
 
-    assert(isolated_cluster >= static_cast< cluster_type >(k));
+    detail::cluster_from_components(g, component, vertex_cluster);
 }
 
 } // namespace clustering
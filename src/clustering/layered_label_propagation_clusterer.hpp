@@ -6,6 +6,7 @@
 
 #include "clusterer.hpp"                            // for clusterer
 #include "layered_label_propagation_clustering.hpp" // for layered_label_propagation_clustering
+#include "misc/random.hpp"                          // for make_rng
 #include "plugin.hpp"                               // for id_t
 
 namespace clustering
@@ -33,6 +34,7 @@ public:
 
     using gamma_type = float;
     using steps_type = int;
+    using seed_type = misc::seed_type;
 
     explicit layered_label_propagation_clusterer(
         weight_map_type edge_weight,
@@ -49,6 +51,10 @@ public:
     auto steps() const -> steps_type { return m_steps; }
     auto set_steps(steps_type s) -> void { m_steps = s; }
 
+    // NOTE: Each run restarts the random sequence of the seed.
+    auto seed() const -> seed_type { return m_seed; }
+    auto set_seed(seed_type seed) -> void { m_seed = seed; }
+
     auto id() const -> id_type override { return llp_clusterer_id; }
     auto operator()(const graph_type& g) const -> cluster_map override;
     auto clone() const -> std::unique_ptr< base > override;
@@ -57,6 +63,7 @@ private:
     weight_map_type m_edge_weight;
     gamma_type m_gamma {};
     steps_type m_steps {};
+    seed_type m_seed { misc::default_seed };
 };
 
 /***********************************************************
@@ -78,12 +85,16 @@ inline auto layered_label_propagation_clusterer< Graph, WeightMap >::operator()(
     const graph_type& g) const -> cluster_map
 {
     auto res = cluster_map();
+    auto rng = misc::make_rng(seed(), id());
     layered_label_propagation_clustering(
         g,
         edge_weight(),
         gamma(),
         steps(),
-        boost::make_assoc_property_map(res));
+        boost::make_assoc_property_map(res),
+        [&rng](std::size_t min, std::size_t max)
+        { return misc::urandom_from(rng, min, max); },
+        rng);
     return res;
 }
 
@@ -5,15 +5,15 @@
 #ifndef CLUSTERING_LAYERED_LABEL_PROPAGATION_CLUSTERING_HPP
 #define CLUSTERING_LAYERED_LABEL_PROPAGATION_CLUSTERING_HPP
 
-#include "detail/layered_label_propagation_clustering.hpp" // for layered_label_propagation_clustering
-#include "misc/algorithm.hpp"                              // for subrange
+#include "detail/layered_label_propagation_clustering.hpp" // for cluster_by_propagation, etc
+#include "misc/random.hpp"                                 // for rng, urandom
 
-#include <boost/graph/adjacency_list.hpp> // for vertices
-#include <boost/graph/graph_concepts.hpp> // for GraphConcept
-#include <boost/graph/graph_utility.hpp>  // for has_no_vertices, has_no_edges
+#include <concepts> // for floating_point, invocable
+#include <cstddef>  // for size_t
 
 namespace clustering
 {
+
 // Generic Layered Label Propagation clustering algorithm implementation.
 //
 // The update rule distinguishes LLP from Label Propagation. Instead of limiting
@@ -21,6 +21,9 @@ namespace clustering
 // neighborhood, it takes into account a factor that considers the labeled nodes
 // in the complete network. In fact, both algorithm versions are equivalent
 // whenever this factor is considered 0.
+//
+// Updates the vertices one by one, (asynchronously), over dense, (vertex
+// indexed), arrays, in O(V + E log d) per step.
 template <
     typename Graph,
     typename WeightMap,
@@ -38,63 +41,47 @@ auto layered_label_propagation_clustering(
     UGenerator gen = misc::urandom< std::size_t >,
     RNG& rng = misc::rng()) -> void
 {
-    BOOST_CONCEPT_ASSERT((boost::GraphConcept< Graph >));
-
-    BOOST_CONCEPT_ASSERT(
-        (boost::ReadablePropertyMapConcept<
-            WeightMap,
-            typename boost::graph_traits< Graph >::edge_descriptor >));
-
-    BOOST_CONCEPT_ASSERT(
-        (boost::ReadWritePropertyMapConcept<
-            ClusterMap,
-            typename boost::graph_traits< Graph >::vertex_descriptor >));
-
-    using graph_traits = boost::graph_traits< Graph >;
-    using vertex_type = typename graph_traits::vertex_descriptor;
-    using cluster_map_traits = boost::property_traits< ClusterMap >;
-    using cluster_type = typename cluster_map_traits::value_type;
-    using community_type = cluster_type;
-
-    namespace impl = llp_detail;
-
-    using network = impl::network_properties< vertex_type, community_type >;
-
-    // Early exit.
-    if (boost::graph::has_no_vertices(g))
-        return;
-
-    // Early exit.
-    if (boost::graph::has_no_edges(g))
-    {
-        impl::cluster_in_isolation(g, vertex_cluster);
-        return;
-    }
-
-    // Core LLP
-
-    auto net = impl::network_status< network >(g);
-
-    // This cycle is not the one that removes or inserts nodes.
-    for (decltype(steps) i = 0; i < steps; ++i)
-    {
-        const auto prev_part = net.vertex_community;
-
-        auto vertices = impl::make_vector(misc::subrange(boost::vertices(g)));
-        std::shuffle(std::begin(vertices), std::end(vertices), rng);
-
-        for (auto u : vertices)
-            if (!impl::dominates(u, g, net, edge_weight, gamma))
-                net.vertex_community[u] = impl::dominant_community(
-                    u, g, net, edge_weight, gamma, gen);
-
-        if (prev_part == net.vertex_community)
-            break;
-    }
+    llp_detail::cluster_by_propagation(
+        g,
+        edge_weight,
+        vertex_cluster,
+        [&](const auto& net, auto& coms)
+        { llp_detail::propagate_labels(net, coms, gamma, steps, gen, rng); });
+}
 
-    // Cluster from final partition.
-    const auto part = impl::renumber_communities(net.vertex_community);
-    impl::cluster_from_partition(g, part, vertex_cluster);
+// Generic Layered Label Propagation clustering algorithm implementation, with
+// parallel, synchronous updates.
+//
+// Updates the vertices in batches, each one decided in parallel against the
+// communities before it, in O(V + E log d) per step.
+// The result depends only on the graph and the random sequences, not on the
+// number of threads.
+template <
+    typename Graph,
+    typename WeightMap,
+    typename ClusterMap,
+    std::floating_point Gamma = float,
+    typename UGenerator = decltype(misc::urandom< std::size_t >),
+    typename RNG = std::mt19937 >
+requires std::invocable< UGenerator, std::size_t, std::size_t >
+auto parallel_layered_label_propagation_clustering(
+    const Graph& g,
+    WeightMap edge_weight,
+    Gamma gamma,
+    int steps,
+    ClusterMap vertex_cluster,
+    UGenerator gen = misc::urandom< std::size_t >,
+    RNG& rng = misc::rng()) -> void
+{
+    llp_detail::cluster_by_propagation(
+        g,
+        edge_weight,
+        vertex_cluster,
+        [&](const auto& net, auto& coms)
+        {
+            llp_detail::propagate_labels_in_batches(
+                net, coms, gamma, steps, gen, rng);
+        });
 }
 
 } // namespace clustering
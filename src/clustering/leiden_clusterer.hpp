@@ -0,0 +1,110 @@
+// Contains the Leiden clusterer implementation.
+// Soultatos Stefanos 2022
+
+#ifndef CLUSTERING_LEIDEN_CLUSTERER_HPP
+#define CLUSTERING_LEIDEN_CLUSTERER_HPP
+
+#include "clusterer.hpp"         // for clusterer
+#include "leiden_clustering.hpp" // for leiden_clustering
+#include "misc/random.hpp"       // for make_rng
+#include "plugin.hpp"            // for id_t
+
+namespace clustering
+{
+
+/***********************************************************
+ * Leiden Clusterer                                        *
+ ***********************************************************/
+
+// Leiden clusterer algorithm implementation.
+template < typename Graph, typename WeightMap >
+class leiden_clusterer : public clusterer< Graph >
+{
+    using base = clusterer< Graph >;
+    using self = leiden_clusterer< Graph, WeightMap >;
+    using graph_traits = boost::graph_traits< Graph >;
+
+public:
+    using id_type = typename base::id_type;
+    using graph_type = Graph;
+    using weight_map_type = WeightMap;
+
+    using cluster = typename base::cluster;
+    using cluster_map = typename base::cluster_map;
+
+    using resolution_type = float;
+    using iterations_type = int;
+    using seed_type = misc::seed_type;
+
+    explicit leiden_clusterer(
+        weight_map_type edge_weight,
+        resolution_type resolution = 1.0f,
+        iterations_type iterations = 2);
+
+    ~leiden_clusterer() override = default;
+
+    auto edge_weight() const -> weight_map_type { return m_edge_weight; }
+
+    auto resolution() const -> resolution_type { return m_resolution; }
+    auto set_resolution(resolution_type r) -> void { m_resolution = r; }
+
+    auto iterations() const -> iterations_type { return m_iterations; }
+    auto set_iterations(iterations_type i) -> void { m_iterations = i; }
+
+    // NOTE: Each run restarts the random sequence of the seed.
+    auto seed() const -> seed_type { return m_seed; }
+    auto set_seed(seed_type seed) -> void { m_seed = seed; }
+
+    auto id() const -> id_type override { return leiden_clusterer_id; }
+    auto operator()(const graph_type& g) const -> cluster_map override;
+    auto clone() const -> std::unique_ptr< base > override;
+
+private:
+    weight_map_type m_edge_weight;
+    resolution_type m_resolution {};
+    iterations_type m_iterations {};
+    seed_type m_seed { misc::default_seed };
+};
+
+/***********************************************************
+ * Definitions                                             *
+ ***********************************************************/
+
+template < typename Graph, typename WeightMap >
+inline leiden_clusterer< Graph, WeightMap >::leiden_clusterer(
+    weight_map_type edge_weight,
+    resolution_type resolution,
+    iterations_type iterations)
+: m_edge_weight { edge_weight }
+, m_resolution { resolution }
+, m_iterations { iterations }
+{
+}
+
+template < typename Graph, typename WeightMap >
+inline auto
+leiden_clusterer< Graph, WeightMap >::operator()(const graph_type& g) const
+    -> cluster_map
+{
+    auto res = cluster_map();
+    auto rng = misc::make_rng(seed(), id());
+    leiden_clustering(
+        g,
+        edge_weight(),
+        boost::make_assoc_property_map(res),
+        resolution(),
+        iterations(),
+        rng);
+    return res;
+}
+
+template < typename Graph, typename WeightMap >
+inline auto leiden_clusterer< Graph, WeightMap >::clone() const
+    -> std::unique_ptr< base >
+{
+    return std::make_unique< self >(*this);
+}
+
+} // namespace clustering
+
+#endif // CLUSTERING_LEIDEN_CLUSTERER_HPP
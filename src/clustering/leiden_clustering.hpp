@@ -0,0 +1,113 @@
+// Contains the Leiden clustering algorithm.
+// Soultatos Stefanos 2022
+
+#ifndef CLUSTERING_LEIDEN_CLUSTERING_HPP
+#define CLUSTERING_LEIDEN_CLUSTERING_HPP
+
+#include "detail/leiden_clustering.hpp" // for leiden_iteration
+#include "misc/random.hpp"              // for rng
+
+#include <boost/graph/adjacency_list.hpp> // for vertices
+#include <boost/graph/graph_utility.hpp>  // for has_no_vertices, has_no_edges
+#include <concepts>                       // for floating_point
+#include <cstddef>                        // for size_t
+#include <numeric>                        // for iota
+#include <type_traits>                    // for is_arithmetic_v
+#include <vector>                         // for vector
+
+namespace clustering
+{
+
+// Generic Leiden clustering algorithm implementation.
+//
+// An improvement of the Louvain Method, which guarantees well connected
+// communities. Each iteration goes through three phases: local moving of the
+// vertices between communities, refinement of each community into well
+// connected sub-communities, and aggregation of the refined partition into a
+// new network, whose vertices start from their (unrefined) communities.
+// Each iteration starts from the partition of the previous one, until the
+// partition stops changing or the iterations are exhausted.
+//
+// The resolution weighs the expected links of each community, higher
+// resolutions lead to more (smaller) communities.
+//
+// Runs over dense, (vertex indexed), arrays, while the local moving and the
+// refinement phases are multithreaded on large networks.
+//
+// See: https://en.wikipedia.org/wiki/Leiden_algorithm
+template <
+    typename Graph,
+    typename WeightMap,
+    typename ClusterMap,
+    std::floating_point Resolution = float,
+    typename RNG = std::mt19937 >
+auto leiden_clustering(
+    const Graph& g,
+    WeightMap edge_weight,
+    ClusterMap vertex_cluster,
+    Resolution resolution = 1,
+    int iterations = 2,
+    RNG& rng = misc::rng()) -> void
+{
+    BOOST_CONCEPT_ASSERT((boost::GraphConcept< Graph >));
+
+    BOOST_CONCEPT_ASSERT(
+        (boost::ReadablePropertyMapConcept<
+            WeightMap,
+            typename boost::graph_traits< Graph >::edge_descriptor >));
+
+    BOOST_CONCEPT_ASSERT(
+        (boost::ReadWritePropertyMapConcept<
+            ClusterMap,
+            typename boost::graph_traits< Graph >::vertex_descriptor >));
+
+    using weight_map_traits = boost::property_traits< WeightMap >;
+    using weight_type = typename weight_map_traits::value_type;
+    using cluster_map_traits = boost::property_traits< ClusterMap >;
+    using cluster_type = typename cluster_map_traits::value_type;
+
+    namespace impl = louvain_detail;
+
+    static_assert(std::is_arithmetic_v< cluster_type >);
+    static_assert(std::is_arithmetic_v< weight_type >);
+
+    // Early exit.
+    if (boost::graph::has_no_vertices(g))
+        return;
+
+    // Early exit.
+    if (boost::graph::has_no_edges(g) or iterations < 1)
+    {
+        impl::cluster_in_isolation(g, vertex_cluster);
+        return;
+    }
+
+    const auto net = impl::make_network(g, edge_weight);
+
+    // Early exit.
+    if (net.total == 0)
+    {
+        impl::cluster_in_isolation(g, vertex_cluster);
+        return;
+    }
+
+    auto partition = std::vector< std::size_t >(net.num_vertices());
+    std::iota(std::begin(partition), std::end(partition), 0);
+
+    for (auto i = 0; i < iterations; ++i)
+    {
+        const auto prev = partition;
+
+        leiden_detail::leiden_iteration(
+            net, partition, static_cast< double >(resolution), rng);
+
+        if (partition == prev)
+            break;
+    }
+
+    impl::cluster_from_communities(g, partition, vertex_cluster);
+}
+
+} // namespace clustering
+
+#endif // CLUSTERING_LEIDEN_CLUSTERING_HPP
@@ -6,6 +6,7 @@
 
 #include "clusterer.hpp"                 // for clusterer
 #include "louvain_method_clustering.hpp" // for louvain_method_clustering
+#include "misc/random.hpp"               // for make_rng
 #include "plugin.hpp"                    // for id_t
 
 namespace clustering
@@ -32,6 +33,7 @@ public:
     using cluster_map = typename base::cluster_map;
 
     using modularity_type = float;
+    using seed_type = misc::seed_type;
 
     explicit louvain_method_clusterer(
         weight_map_type edge_weight,
@@ -43,6 +45,10 @@ public:
     auto min() const -> modularity_type { return m_min; }
     auto set_min(modularity_type q) -> void { m_min = q; }
 
+    // NOTE: Each run restarts the random sequence of the seed.
+    auto seed() const -> seed_type { return m_seed; }
+    auto set_seed(seed_type seed) -> void { m_seed = seed; }
+
     auto id() const -> id_type override { return louvain_method_clusterer_id; }
     auto operator()(const graph_type& g) const -> cluster_map override;
     auto clone() const -> std::unique_ptr< base > override;
@@ -50,6 +56,7 @@ public:
 private:
     weight_map_type m_edge_weight;
     modularity_type m_min;
+    seed_type m_seed { misc::default_seed };
 };
 
 /***********************************************************
@@ -69,8 +76,9 @@ inline auto louvain_method_clusterer< Graph, WeightMap >::operator()(
     const graph_type& g) const -> cluster_map
 {
     auto res = cluster_map();
+    auto rng = misc::make_rng(seed(), id());
     louvain_method_clustering(
-        g, edge_weight(), boost::make_assoc_property_map(res), min());
+        g, edge_weight(), boost::make_assoc_property_map(res), min(), rng);
     return res;
 }
 
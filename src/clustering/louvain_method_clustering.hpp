@@ -10,6 +10,10 @@
 #include <boost/graph/adjacency_list.hpp> // for vertices
 #include <boost/graph/graph_utility.hpp>  // for has_no_vertices, has_no_edges
 #include <concepts>                       // for floating_point
+#include <cstddef>                        // for size_t
+#include <numeric>                        // for iota
+#include <type_traits>                    // for is_arithmetic_v
+#include <vector>                         // for vector
 
 namespace clustering
 {
@@ -31,8 +35,11 @@ namespace clustering
 // links in a given community (strictly connecting nodes inside of it) before
 // being collapsed into a single one.
 //
+// Runs over dense, (vertex indexed), arrays, in O((V + E) log E) per level.
+// Directed graphs are clustered by their directed modularity, while undirected
+// ones by the standard one.
+//
 // See: https://en.wikipedia.org/wiki/Louvain_method
-// NOTE: Currently only taking into account out edges.
 template <
     typename Graph,
     typename WeightMap,
@@ -58,23 +65,14 @@ auto louvain_method_clustering(
             ClusterMap,
             typename boost::graph_traits< Graph >::vertex_descriptor >));
 
-    using graph_traits = boost::graph_traits< Graph >;
-    using vertex_type = typename graph_traits::vertex_descriptor;
     using weight_map_traits = boost::property_traits< WeightMap >;
     using weight_type = typename weight_map_traits::value_type;
     using cluster_map_traits = boost::property_traits< ClusterMap >;
     using cluster_type = typename cluster_map_traits::value_type;
-    using community_type = cluster_type;
 
     namespace impl = louvain_detail;
 
-    using network
-        = impl::network_properties< vertex_type, weight_type, community_type >;
-    using dendrogram
-        = impl::dendrogram< typename network::vertex_community_storage_type >;
-
-    static_assert(std::is_arithmetic_v< vertex_type >);
-    static_assert(std::is_arithmetic_v< community_type >);
+    static_assert(std::is_arithmetic_v< cluster_type >);
     static_assert(std::is_arithmetic_v< weight_type >);
 
     // Early exit.
@@ -88,50 +86,38 @@ auto louvain_method_clustering(
         return;
     }
 
-    dendrogram partitions;
-    Modularity curr_mod { 0 };
+    auto net = impl::make_network(g, edge_weight);
 
-    auto status = impl::network_status< network >(g, edge_weight);
-
-    impl::modularity_optimization(g, status, edge_weight, min, rng);
-    curr_mod = impl::modularity< Modularity >(status);
+    // Early exit.
+    if (net.total == 0)
+    {
+        impl::cluster_in_isolation(g, vertex_cluster);
+        return;
+    }
 
-    auto&& lvl1_part = impl::renumber_communities(status.vertex_community);
-    auto curr_sub = impl::community_aggregation(g, edge_weight, lvl1_part);
-    partitions.push_back(std::move(lvl1_part));
+    // The community of each graph vertex, at the current level.
+    auto membership = std::vector< std::size_t >(net.num_vertices());
+    std::iota(std::begin(membership), std::end(membership), 0);
 
     // Keeps partitioning until no significant modularity increase occurs.
-    do
+    while (true)
     {
-        auto new_status = impl::network_status< network >(
-            curr_sub.g, boost::make_assoc_property_map(curr_sub.edge_weight));
+        auto coms = impl::make_singletons(net);
+        const auto gain = impl::move_vertices(net, coms, min, 1.0, rng);
 
-        impl::modularity_optimization(
-            curr_sub.g,
-            new_status,
-            boost::make_assoc_property_map(curr_sub.edge_weight),
-            min,
-            rng);
+        const auto num_communities
+            = impl::renumber_communities(coms.of_vertex);
 
-        const auto new_mod = impl::modularity< Modularity >(new_status);
+        for (auto& com : membership)
+            com = coms.of_vertex[com];
 
-        if (new_mod - curr_mod < min)
+        if (gain <= 0 or gain < min or num_communities == net.num_vertices())
             break;
 
-        curr_mod = new_mod;
-
-        auto&& part = impl::renumber_communities(new_status.vertex_community);
-
-        curr_sub = impl::community_aggregation(
-            curr_sub.g,
-            boost::make_assoc_property_map(curr_sub.edge_weight),
-            part);
-
-        partitions.push_back(std::move(part));
-
-    } while (true);
+        net = impl::aggregate(net, coms.of_vertex, num_communities);
+    }
 
-    impl::cluster_from_dendrogram(g, vertex_cluster, partitions);
+    impl::cluster_from_communities(g, membership, vertex_cluster);
 }
 
 } // namespace clustering
@@ -8,7 +8,9 @@
 #include "maximal_clique_enumeration_clustering.hpp" // for maximal_clique_enumeration_clustering
 #include "plugin.hpp"                                // for id_t
 
-#include <boost/graph/bron_kerbosch_all_cliques.hpp> // for bron_kerbosch_all_cliques
+#include <cassert> // for assert
+#include <chrono>  // for duration
+#include <cstddef> // for size_t
 
 namespace clustering
 {
@@ -18,10 +20,8 @@ namespace clustering
  ***********************************************************/
 
 // Generic maximal clique enumeration clusterer.
-// NOTE: Currently uses the Bron Kerbosch clique visitor.
-// Implementation details:
-// see
-// https://www.boost.org/doc/libs/1_46_1/boost/graph/bron_kerbosch_all_cliques.hpp
+// Bounded by a min clique size, a max number of visited cliques and a time
+// limit, (in seconds).
 template < typename Graph >
 class maximal_clique_enumeration_clusterer : public clusterer< Graph >
 {
@@ -36,28 +36,67 @@ public:
     using cluster = typename base::cluster;
     using cluster_map = typename base::cluster_map;
 
-    maximal_clique_enumeration_clusterer() = default;
+    using clique_size_type = int;
+    using clique_count_type = int;
+    using seconds_type = float;
+
+    explicit maximal_clique_enumeration_clusterer(
+        clique_size_type min_clique_size = 2,
+        clique_count_type max_cliques = 100000,
+        seconds_type time_limit = 10);
+
     ~maximal_clique_enumeration_clusterer() override = default;
 
+    auto min_clique_size() const -> clique_size_type { return m_min_size; }
+    auto set_min_clique_size(clique_size_type n) -> void { m_min_size = n; }
+
+    auto max_cliques() const -> clique_count_type { return m_max_cliques; }
+    auto set_max_cliques(clique_count_type n) -> void { m_max_cliques = n; }
+
+    auto time_limit() const -> seconds_type { return m_time_limit; }
+    auto set_time_limit(seconds_type secs) -> void { m_time_limit = secs; }
+
     auto id() const -> id_type override { return max_clique_enum_clusterer_id; }
     auto operator()(const graph_type& g) const -> cluster_map override;
     auto clone() const -> std::unique_ptr< base > override;
+
+private:
+    clique_size_type m_min_size {};
+    clique_count_type m_max_cliques {};
+    seconds_type m_time_limit {};
 };
 
 /***********************************************************
  * Definitions                                             *
  ***********************************************************/
 
+template < typename Graph >
+inline maximal_clique_enumeration_clusterer< Graph >::
+    maximal_clique_enumeration_clusterer(
+        clique_size_type min_clique_size,
+        clique_count_type max_cliques,
+        seconds_type time_limit)
+: m_min_size { min_clique_size }
+, m_max_cliques { max_cliques }
+, m_time_limit { time_limit }
+{
+}
+
 template < typename Graph >
 inline auto maximal_clique_enumeration_clusterer< Graph >::operator()(
     const graph_type& g) const -> cluster_map
 {
+    assert(min_clique_size() > 0);
+    assert(max_cliques() > 0);
+    assert(time_limit() > 0);
+
     auto res = cluster_map();
     maximal_clique_enumeration_clustering(
         g,
-        [](const auto& g, const auto& f)
-        { boost::bron_kerbosch_all_cliques(g, f); },
-        boost::make_assoc_property_map(res));
+        boost::make_assoc_property_map(res),
+        static_cast< std::size_t >(min_clique_size()),
+        static_cast< std::size_t >(max_cliques()),
+        std::chrono::duration< seconds_type >(time_limit()));
     return res;
 }
 
@@ -4,22 +4,36 @@
 #ifndef CLUSTERING_MAXIMAL_CLIQUE_ENUMERATION_CLUSTERING_HPP
 #define CLUSTERING_MAXIMAL_CLIQUE_ENUMERATION_CLUSTERING_HPP
 
-#include "detail/maximal_clique_enumeration_clustering.hpp" // for clique_size_recorder
+#include "detail/maximal_clique_enumeration_clustering.hpp" // for largest_clique_recorder, largest_cliques
 
+#include <algorithm>                      // for sort
 #include <boost/graph/adjacency_list.hpp> // for vertices
 #include <boost/graph/graph_utility.hpp>  // for has_no_vertices, has_no_edges
-#include <deque>                          // for dequeue
-#include <map>                            // for multimap
+#include <boost/log/trivial.hpp>          // for BOOST_LOG_TRIVIAL
+#include <cassert>                        // for assert
+#include <chrono>                         // for duration
+#include <cstddef>                        // for size_t
+#include <limits>                         // for numeric_limits
+#include <ratio>                          // for ratio
+#include <type_traits>                    // for is_invocable_v
+#include <vector>                         // for vector
 
 namespace clustering
 {
 
 // Generic maximal clique enumeration clustering algorithm.
+// Only the largest cliques visited are kept, (as they are streamed), each one
+// in a shared cluster.
 // NOTE: the default min number of vertices per clique depends on the clique
 // visitor implementation.
 // NOTE: Confusingly the VisitCliques visitor is input an object of abstract
 // type: boost::CliqueVisitor (the applied function).
 template < typename Graph, typename VisitCliques, typename ClusterMap >
+requires std::is_invocable_v<
+    VisitCliques,
+    Graph,
+    detail::largest_clique_record_iterator< std::vector< std::vector<
+        typename boost::graph_traits< Graph >::vertex_descriptor > > > >
 auto maximal_clique_enumeration_clustering(
     const Graph& g,
     VisitCliques visit_cliques,
@@ -34,16 +48,11 @@ auto maximal_clique_enumeration_clustering(
 
     using graph_traits = boost::graph_traits< Graph >;
     using vertex_type = typename graph_traits::vertex_descriptor;
-    using clique = std::deque< vertex_type >;
-    using clique_map = std::multimap< std::size_t, clique >;
+    using clique = std::vector< vertex_type >;
+    using clique_vector = std::vector< clique >;
     using cluster_map_traits = boost::property_traits< ClusterMap >;
     using cluster_type = typename cluster_map_traits::value_type;
 
-    static_assert(std::is_invocable_v<
-                  VisitCliques,
-                  Graph,
-                  detail::clique_size_record_iterator< clique_map > >);
-
     // Early exit
     if (boost::graph::has_no_vertices(g))
         return;
@@ -57,25 +66,122 @@ auto maximal_clique_enumeration_clustering(
     if (boost::graph::has_no_edges(g))
         return;
 
-    // Record cliques by size.
-    clique_map cliques;
-    visit_cliques(g, detail::clique_size_recorder(cliques));
+    // Record the largest cliques.
+    clique_vector cliques;
+    visit_cliques(g, detail::largest_clique_recorder(cliques));
+
+    // Fill clusters of maximal cliques.
+    for (auto c = detail::shared_cluster< cluster_type >();
+         const auto& clique : cliques)
+    {
+        for (auto v : clique)
+            boost::put(vertex_cluster, v, c);
+
+        c = detail::advance_shared_cluster(c);
+    }
+}
+
+// Bounded maximal clique enumeration clustering algorithm.
+//
+// Enumerates the maximal cliques, (of at least min size), from each vertex in
+// degeneracy order, with Tomita pivoting, keeping only the largest ones found
+// so far, and skipping the branches that cannot reach them. Each of the
+// largest cliques is assigned to a shared cluster.
+//
+// Stops once the time limit passes, or the max number of cliques are visited,
+// with the largest cliques found until then.
+//
+// The vertices of a directed graph are adjacent only if they are connected
+// both ways. The search is multithreaded on large graphs, and, unless stopped
+// by a limit, does not depend on the number of threads.
+//
+// See: https://en.wikipedia.org/wiki/Bron%E2%80%93Kerbosch_algorithm
+template <
+    typename Graph,
+    typename ClusterMap,
+    typename Rep = double,
+    typename Period = std::ratio< 1 > >
+auto maximal_clique_enumeration_clustering(
+    const Graph& g,
+    ClusterMap vertex_cluster,
+    std::size_t min_clique_size = 2,
+    std::size_t max_cliques = std::numeric_limits< std::size_t >::max(),
+    std::chrono::duration< Rep, Period > time_limit
+    = std::chrono::duration< Rep, Period >::max()) -> void
+{
+    BOOST_CONCEPT_ASSERT((boost::GraphConcept< Graph >));
+
+    BOOST_CONCEPT_ASSERT(
+        (boost::ReadWritePropertyMapConcept<
+            ClusterMap,
+            typename boost::graph_traits< Graph >::vertex_descriptor >));
+
+    using graph_traits = boost::graph_traits< Graph >;
+    using vertex_type = typename graph_traits::vertex_descriptor;
+    using cluster_map_traits = boost::property_traits< ClusterMap >;
+    using cluster_type = typename cluster_map_traits::value_type;
+    using clock = mce_detail::clock;
+
+    namespace impl = mce_detail;
+
+    assert(min_clique_size > 0 && "empty cliques make no sense");
+    assert(max_cliques > 0 && "no cliques make no sense");
+
+    const auto now = clock::now();
+
+    auto limits = impl::bounds();
+    limits.min_size = min_clique_size;
+    limits.max_cliques = max_cliques;
+    limits.deadline = time_limit < clock::time_point::max() - now
+        ? now + std::chrono::duration_cast< clock::duration >(time_limit)
+        : clock::time_point::max();
+
+    // Early exit
+    if (boost::graph::has_no_vertices(g))
+        return;
+
+    // Isolate clusters
+    auto vertices = std::vector< vertex_type >();
+
+    for (cluster_type c = 0;
+         auto v : boost::make_iterator_range(boost::vertices(g)))
+    {
+        boost::put(vertex_cluster, v, c++);
+        vertices.push_back(v);
+    }
 
     // Early exit
-    if (cliques.empty())
+    if (boost::graph::has_no_edges(g))
         return;
 
-    // Fill clusters of maximal cliques.
-    assert(!cliques.empty());
-    const auto max_clique_size = (*std::rbegin(cliques)).first;
-    const auto max_cliques_iters = cliques.equal_range(max_clique_size);
-    const auto max_cliques = boost::make_iterator_range(max_cliques_iters);
+    // By vertex index.
+    const auto index = boost::get(boost::vertex_index, g);
+    std::sort(
+        std::begin(vertices),
+        std::end(vertices),
+        [index](auto lhs, auto rhs)
+        { return boost::get(index, lhs) < boost::get(index, rhs); });
 
+    const auto net = impl::make_network(g);
+
+    const auto num_threads = net.num_vertices() >= impl::min_parallel_vertices
+        ? misc::hardware_concurrency()
+        : 1u;
+
+    const auto found = impl::largest_cliques(net, limits, num_threads);
+
+    if (!found.complete)
+        BOOST_LOG_TRIVIAL(warning)
+            << "stopped maximal clique enumeration early, at "
+            << found.cliques.size() << " cliques of size "
+            << (found.cliques.empty() ? 0 : found.cliques.front().size());
+
+    // Fill clusters of maximal cliques.
     for (auto c = detail::shared_cluster< cluster_type >();
-         const auto& [size, clique] : max_cliques)
+         const auto& clique : found.cliques)
     {
         for (auto v : clique)
-            boost::put(vertex_cluster, v, c);
+            boost::put(vertex_cluster, vertices[v], c);
 
         c = detail::advance_shared_cluster(c);
     }
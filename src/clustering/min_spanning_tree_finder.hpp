@@ -4,12 +4,11 @@
 #ifndef CLUSTERING_MIN_SPANNING_TREE_FINDER_HPP
 #define CLUSTERING_MIN_SPANNING_TREE_FINDER_HPP
 
-#include "detail/utility.hpp" // for edge_hash
-
 #include <boost/graph/graph_concepts.hpp> // for GraphConcept
+#include <iterator>                       // for back_insert_iterator
 #include <memory>                         // for unique_ptr
 #include <string_view>                    // for string_view
-#include <unordered_set>                  // for unordered_set
+#include <vector>                         // for vector
 
 namespace clustering
 {
@@ -33,8 +32,8 @@ public:
     using weight_map_type = WeightMap;
     using edge_type = typename graph_traits::edge_descriptor;
 
-    using spanning_tree = std::unordered_set< edge_type, detail::edge_hash >;
-    using output_iterator = std::insert_iterator< spanning_tree >;
+    using spanning_tree = std::vector< edge_type >;
+    using output_iterator = std::back_insert_iterator< spanning_tree >;
 
     min_spanning_tree_finder() = default;
     min_spanning_tree_finder(const min_spanning_tree_finder&) = default;
@@ -4,6 +4,7 @@
 #ifndef CLUSTERING_MIN_SPANNING_TREE_FINDER_FACTORY_HPP
 #define CLUSTERING_MIN_SPANNING_TREE_FINDER_FACTORY_HPP
 
+#include "boruvka_min_spanning_tree.hpp" // for boruvka_min_spanning_tree
 #include "kruskal_min_spanning_tree.hpp" // for kruskal_min_spanning_tree
 #include "min_spanning_tree_finder.hpp"  // for min_spanning_tree_finder
 #include "plugin.hpp"                    // for id_t
@@ -39,6 +40,7 @@ public:
 
     using prim_mst_type = prim_min_spanning_tree< Graph, WeightMap >;
     using kruskal_mst_type = kruskal_min_spanning_tree< Graph, WeightMap >;
+    using boruvka_mst_type = boruvka_min_spanning_tree< Graph, WeightMap >;
 
     min_spanning_tree_finder_factory(const min_spanning_tree_finder_factory&)
         = delete;
@@ -74,6 +76,10 @@ min_spanning_tree_finder_factory< Graph, WeightMap >::make_mst_finder(
     {
         return std::make_unique< kruskal_mst_type >();
     }
+    else if (id == boruvka_mst_id)
+    {
+        return std::make_unique< boruvka_mst_type >();
+    }
     else
     {
         assert(!is_mst_finder_plugged_in(id));
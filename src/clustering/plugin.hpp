@@ -26,6 +26,7 @@ constexpr id_t max_clique_enum_clusterer_id = "Maximal Clique Enumeration";
 constexpr id_t louvain_method_clusterer_id = "Louvain Method";
 constexpr id_t llp_clusterer_id = "Layered Label Propagation";
 constexpr id_t infomap_clusterer_id = "Infomap";
+constexpr id_t leiden_clusterer_id = "Leiden";
 
 constexpr auto clusterer_ids = std::array { k_spanning_tree_clusterer_id,
                                             snn_clusterer_id,
@@ -33,7 +34,8 @@ constexpr auto clusterer_ids = std::array { k_spanning_tree_clusterer_id,
                                             max_clique_enum_clusterer_id,
                                             louvain_method_clusterer_id,
                                             llp_clusterer_id,
-                                            infomap_clusterer_id };
+                                            infomap_clusterer_id,
+                                            leiden_clusterer_id };
 
 constexpr auto is_clusterer_plugged_in(id_t id) -> bool
 {
@@ -47,6 +49,7 @@ static_assert(is_clusterer_plugged_in(max_clique_enum_clusterer_id));
 static_assert(is_clusterer_plugged_in(louvain_method_clusterer_id));
 static_assert(is_clusterer_plugged_in(llp_clusterer_id));
 static_assert(is_clusterer_plugged_in(infomap_clusterer_id));
+static_assert(is_clusterer_plugged_in(leiden_clusterer_id));
 
 /***********************************************************
  * Min Spanning Tree Finders                               *
@@ -54,8 +57,10 @@ static_assert(is_clusterer_plugged_in(infomap_clusterer_id));
 
 constexpr id_t prim_mst_id = "Prim MST";
 constexpr id_t kruskal_mst_id = "Kruskal MST";
+constexpr id_t boruvka_mst_id = "Boruvka MST";
 
-constexpr auto mst_finders_ids = std::array { prim_mst_id, kruskal_mst_id };
+constexpr auto mst_finders_ids
+    = std::array { prim_mst_id, kruskal_mst_id, boruvka_mst_id };
 
 constexpr auto is_mst_finder_plugged_in(id_t id) -> bool
 {
@@ -64,6 +69,7 @@ constexpr auto is_mst_finder_plugged_in(id_t id) -> bool
 
 static_assert(is_mst_finder_plugged_in(prim_mst_id));
 static_assert(is_mst_finder_plugged_in(kruskal_mst_id));
+static_assert(is_mst_finder_plugged_in(boruvka_mst_id));
 
 } // namespace clustering
 
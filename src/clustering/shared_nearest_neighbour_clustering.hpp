@@ -4,12 +4,13 @@
 #ifndef CLUSTERING_SHARED_NEAREST_NEIGHBOUR_CLUSTERING_HPP
 #define CLUSTERING_SHARED_NEAREST_NEIGHBOUR_CLUSTERING_HPP
 
-#include "detail/shared_nearest_neighbour_clustering.hpp" // for shared_nearest_neighbour_clustering
-#include "detail/utility.hpp" // for edge_hash, shared_nearest_neighbour
+#include "detail/shared_nearest_neighbour_clustering.hpp" // for shared_nearest_neighbour
 
 #include <boost/graph/adjacency_list.hpp> // for vertices
 #include <boost/graph/graph_utility.hpp>  // for has_no_vertices, has_no_edges
 #include <cassert>                        // for assert
+#include <cstddef>                        // for size_t
+#include <limits>                         // for numeric_limits
 
 namespace clustering
 {
@@ -30,11 +31,6 @@ auto shared_nearest_neighbour_clustering(
             ClusterMap,
             typename boost::graph_traits< Graph >::vertex_descriptor >));
 
-    using graph_traits = boost::graph_traits< Graph >;
-    using edge_type = typename graph_traits::edge_descriptor;
-    using proximity_type = decltype(threshold);
-    using proximity_storage
-        = std::unordered_map< edge_type, proximity_type, detail::edge_hash >;
     using cluster_map_traits = boost::property_traits< ClusterMap >;
     using cluster_type = typename cluster_map_traits::value_type;
     using cluster_limits = std::numeric_limits< cluster_type >;
@@ -54,19 +50,18 @@ auto shared_nearest_neighbour_clustering(
     if (boost::graph::has_no_edges(g))
         return;
 
-    // Fill edge proximity map.
-    proximity_storage edge_proximity;
-    detail::shared_nearest_neighbour(
-        g, boost::make_assoc_property_map(edge_proximity));
+    // Compute edge proximities, (in edge order).
+    const auto edge_proximity = detail::shared_nearest_neighbour(g);
 
     // Fill cluster map.
+    std::size_t i = 0;
     for (cluster_type shared = cluster_limits::max();
          auto e : boost::make_iterator_range(boost::edges(g)))
     {
-        const auto iter = edge_proximity.find(e);
-        assert(iter != std::cend(edge_proximity));
-        const auto proximity = iter->second;
-        const bool share_t_neighbours = (proximity >= threshold);
+        assert(i < edge_proximity.size());
+        const auto proximity = edge_proximity[i++];
+        const bool share_t_neighbours
+            = (proximity >= static_cast< std::size_t >(threshold));
 
         if (share_t_neighbours)
         {
@@ -5,8 +5,26 @@
 namespace color_coding
 {
 
+namespace
+{
+    inline auto id_of(color_repo::dependency_type dep)
+    {
+        return misc::interned_dependency(dep).handle();
+    }
+
+} // namespace
+
 color_repo::color_repo(hash_table map) : m_map { std::move(map) }
 {
+    for (const auto& [dep, code] : m_map)
+    {
+        const auto id = id_of(dep);
+
+        if (id >= m_dense.size())
+            m_dense.resize(id + 1);
+
+        m_dense[id] = code;
+    }
 }
 
 auto color_repo::get_color(dependency_type dep) const -> color_code
@@ -16,12 +34,21 @@ auto color_repo::get_color(dependency_type dep) const -> color_code
     return (*iter).second;
 }
 
+auto color_repo::get_color(dependency_id_type dep) const -> color_code
+{
+    assert(dep < m_dense.size());
+    assert(m_dense[dep]);
+    return *m_dense[dep];
+}
+
 auto color_repo::set_color(dependency_type dep, color_code rgba) -> void
 {
     auto iter = m_map.find(dep);
     assert(iter != std::cend(m_map));
     (*iter).second = rgba; // heterogeneous, no allocations
+    m_dense[id_of(dep)] = rgba;
     assert(get_color(dep) == rgba);
+    assert(get_color(id_of(dep)) == rgba);
 }
 
-} // namespace color_coding
\ No newline at end of file
+} // namespace color_coding
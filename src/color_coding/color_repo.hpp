@@ -5,10 +5,12 @@
 #define COLOR_CODING_COLOR_REPO_HPP
 
 #include "misc/heterogeneous.hpp" // for unordered_string_map
+#include "misc/interning.hpp"     // for interned_dependency
 
 #include <array>       // for array
 #include <optional>    // for optional
 #include <string_view> // for string_view
+#include <vector>      // for vector
 
 namespace color_coding
 {
@@ -24,10 +26,13 @@ struct color_code
     constexpr auto operator!=(const color_code&) const -> bool = default;
 };
 
+// Color codes are also indexed by interned dependency handles, in O(1) time,
+// without any hashing.
 class color_repo
 {
 public:
     using dependency_type = std::string_view;
+    using dependency_id_type = misc::interned_dependency::handle_type;
     using hash_table = misc::unordered_string_map< color_code >;
 
     explicit color_repo(hash_table map = hash_table());
@@ -35,6 +40,7 @@ public:
     // Precondition: the dependency must have been assigned on construction.
 
     auto get_color(dependency_type dep) const -> color_code;
+    auto get_color(dependency_id_type dep) const -> color_code;
     auto set_color(dependency_type dep, color_code rgba) -> void;
 
     auto begin() -> auto { return std::begin(m_map); }
@@ -45,11 +51,21 @@ public:
     auto end() const -> auto { return std::end(m_map); }
     auto cend() const -> auto { return std::cend(m_map); }
 
-    auto operator==(const color_repo&) const -> bool = default;
-    auto operator!=(const color_repo&) const -> bool = default;
+    auto operator==(const color_repo& other) const -> bool
+    {
+        return m_map == other.m_map;
+    }
+
+    auto operator!=(const color_repo& other) const -> bool
+    {
+        return !(*this == other);
+    }
 
 private:
+    using dense_table = std::vector< std::optional< color_code > >;
+
     hash_table m_map;
+    dense_table m_dense;
 };
 
 } // namespace color_coding
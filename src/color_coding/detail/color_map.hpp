@@ -5,9 +5,11 @@
 #define COLOR_CODING_DETAIL_COLOR_MAP_HPP
 
 #include "color_coding/backend.hpp" // for backend
+#include "misc/interning.hpp"        // for interned_dependency
 
 #include <boost/graph/graph_concepts.hpp> // for boost::get
 #include <optional>                       // for optional
+#include <type_traits>                    // for is_same_v, decay_t
 
 namespace color_coding::detail
 {
@@ -28,9 +30,20 @@ struct color_dispatcher
     inline auto operator()(Edge e) const -> result_type
     {
         const auto& dependency = boost::get(edge_dependency, e);
-        const auto& [col, active] = get_color_code(*back, dependency);
+        const auto& [col, active] = color_code_of(dependency);
         return active ? result_type(col) : std::nullopt;
     }
+
+    template < typename Dependency >
+    inline auto color_code_of(const Dependency& dependency) const
+        -> color_code_type
+    {
+        // Interned dependencies are resolved by index, not by name.
+        if constexpr (std::is_same_v< Dependency, misc::interned_dependency >)
+            return back->repo().get_color(dependency.handle());
+        else
+            return get_color_code(*back, dependency);
+    }
 };
 
 } // namespace color_coding::detail
@@ -71,6 +71,36 @@ auto clustering_editor::llp_steps() const -> steps_type
     return m_llp_steps();
 }
 
+auto clustering_editor::leiden_resolution() const -> resolution_type
+{
+    assert(m_leiden_resolution);
+    return m_leiden_resolution();
+}
+
+auto clustering_editor::leiden_iterations() const -> iterations_type
+{
+    assert(m_leiden_iterations);
+    return m_leiden_iterations();
+}
+
+auto clustering_editor::mce_min_clique_size() const -> clique_size_type
+{
+    assert(m_mce_min_clique_size);
+    return m_mce_min_clique_size();
+}
+
+auto clustering_editor::mce_max_cliques() const -> clique_count_type
+{
+    assert(m_mce_max_cliques);
+    return m_mce_max_cliques();
+}
+
+auto clustering_editor::mce_time_limit() const -> seconds_type
+{
+    assert(m_mce_time_limit);
+    return m_mce_time_limit();
+}
+
 auto clustering_editor::set_clusterer(clusterer_accessor f) -> void
 {
     assert(f);
@@ -119,6 +149,36 @@ auto clustering_editor::set_llp_steps(steps_accessor f) -> void
     m_llp_steps = std::move(f);
 }
 
+auto clustering_editor::set_leiden_resolution(resolution_accessor f) -> void
+{
+    assert(f);
+    m_leiden_resolution = std::move(f);
+}
+
+auto clustering_editor::set_leiden_iterations(iterations_accessor f) -> void
+{
+    assert(f);
+    m_leiden_iterations = std::move(f);
+}
+
+auto clustering_editor::set_mce_min_clique_size(clique_size_accessor f) -> void
+{
+    assert(f);
+    m_mce_min_clique_size = std::move(f);
+}
+
+auto clustering_editor::set_mce_max_cliques(clique_count_accessor f) -> void
+{
+    assert(f);
+    m_mce_max_cliques = std::move(f);
+}
+
+auto clustering_editor::set_mce_time_limit(seconds_accessor f) -> void
+{
+    assert(f);
+    m_mce_time_limit = std::move(f);
+}
+
 auto clustering_editor::connect_to_clusterer(const clustererer_slot& f)
     -> connection
 {
@@ -164,6 +224,36 @@ auto clustering_editor::connect_to_llp_steps(const steps_slot& f) -> connection
     return m_llp_steps_sig.connect(f);
 }
 
+auto clustering_editor::connect_to_leiden_resolution(const resolution_slot& f)
+    -> connection
+{
+    return m_leiden_resolution_sig.connect(f);
+}
+
+auto clustering_editor::connect_to_leiden_iterations(const iterations_slot& f)
+    -> connection
+{
+    return m_leiden_iterations_sig.connect(f);
+}
+
+auto clustering_editor::connect_to_mce_min_clique_size(
+    const clique_size_slot& f) -> connection
+{
+    return m_mce_min_clique_size_sig.connect(f);
+}
+
+auto clustering_editor::connect_to_mce_max_cliques(const clique_count_slot& f)
+    -> connection
+{
+    return m_mce_max_cliques_sig.connect(f);
+}
+
+auto clustering_editor::connect_to_mce_time_limit(const seconds_slot& f)
+    -> connection
+{
+    return m_mce_time_limit_sig.connect(f);
+}
+
 auto clustering_editor::connect_to_cluster(const cluster_slot& f) -> connection
 {
     return m_cluster_sig.connect(f);
@@ -219,6 +309,32 @@ auto clustering_editor::emit_llp_steps(steps_type s) const -> void
     m_llp_steps_sig(s);
 }
 
+auto clustering_editor::emit_leiden_resolution(resolution_type r) const -> void
+{
+    m_leiden_resolution_sig(r);
+}
+
+auto clustering_editor::emit_leiden_iterations(iterations_type i) const -> void
+{
+    m_leiden_iterations_sig(i);
+}
+
+auto clustering_editor::emit_mce_min_clique_size(clique_size_type n) const
+    -> void
+{
+    m_mce_min_clique_size_sig(n);
+}
+
+auto clustering_editor::emit_mce_max_cliques(clique_count_type n) const -> void
+{
+    m_mce_max_cliques_sig(n);
+}
+
+auto clustering_editor::emit_mce_time_limit(seconds_type secs) const -> void
+{
+    m_mce_time_limit_sig(secs);
+}
+
 auto clustering_editor::emit_cluster() const -> void
 {
     m_cluster_sig();
@@ -353,6 +469,15 @@ auto clustering_editor::render_settings_for_nerds() const -> void
         render_llp_gamma_editor();
         render_llp_steps_editor();
         spaced_separator();
+        spaced_text("Leiden");
+        render_leiden_resolution_editor();
+        render_leiden_iterations_editor();
+        spaced_separator();
+        spaced_text("Maximal Clique Enumeration");
+        render_mce_min_clique_size_editor();
+        render_mce_max_cliques_editor();
+        render_mce_time_limit_editor();
+        spaced_separator();
 
         ImGui::EndPopup();
     }
@@ -446,4 +571,90 @@ auto clustering_editor::render_llp_steps_editor() const -> void
         "long as a different partition is produced at each step)");
 }
 
-} // namespace gui
\ No newline at end of file
+auto clustering_editor::render_leiden_resolution_editor() const -> void
+{
+    auto resolution = leiden_resolution();
+
+    if (ImGui::InputFloat(
+            "Resolution##clustering",
+            &resolution,
+            0.1f,
+            1.0f,
+            "%.3f",
+            ImGuiInputTextFlags_EnterReturnsTrue))
+        emit_leiden_resolution(resolution);
+    ImGui::SameLine();
+    detail::render_help_marker(
+        "Leiden resolution parameter\nHigher resolutions lead to more "
+        "(smaller) clusters");
+}
+
+auto clustering_editor::render_leiden_iterations_editor() const -> void
+{
+    auto iterations = leiden_iterations();
+
+    if (ImGui::InputInt(
+            "Iterations##clustering",
+            &iterations,
+            1,
+            100,
+            ImGuiInputTextFlags_EnterReturnsTrue))
+        emit_leiden_iterations(iterations);
+    ImGui::SameLine();
+    detail::render_help_marker(
+        "Max number of Leiden algorithm iterations\n(As "
+        "long as a different partition is produced at each iteration)");
+}
+
+auto clustering_editor::render_mce_min_clique_size_editor() const -> void
+{
+    auto n = mce_min_clique_size();
+
+    if (ImGui::InputInt(
+            "Min Clique Size##clustering",
+            &n,
+            1,
+            10,
+            ImGuiInputTextFlags_EnterReturnsTrue))
+        emit_mce_min_clique_size(n);
+    ImGui::SameLine();
+    detail::render_help_marker(
+        "Min number of vertices of a clique, in order to be clustered");
+}
+
+auto clustering_editor::render_mce_max_cliques_editor() const -> void
+{
+    auto n = mce_max_cliques();
+
+    if (ImGui::InputInt(
+            "Max Cliques##clustering",
+            &n,
+            1000,
+            100000,
+            ImGuiInputTextFlags_EnterReturnsTrue))
+        emit_mce_max_cliques(n);
+    ImGui::SameLine();
+    detail::render_help_marker(
+        "Max number of maximal cliques visited\n(The largest cliques "
+        "found until then are clustered)");
+}
+
+auto clustering_editor::render_mce_time_limit_editor() const -> void
+{
+    auto secs = mce_time_limit();
+
+    if (ImGui::InputFloat(
+            "Time Limit##clustering",
+            &secs,
+            1.0f,
+            10.0f,
+            "%.3f",
+            ImGuiInputTextFlags_EnterReturnsTrue))
+        emit_mce_time_limit(secs);
+    ImGui::SameLine();
+    detail::render_help_marker(
+        "Max number of seconds spent visiting maximal cliques\n(The "
+        "largest cliques found until then are clustered)");
+}
+
+} // namespace gui
@@ -23,6 +23,11 @@ public:
     using modularity_type = float;
     using gamma_type = float;
     using steps_type = int;
+    using resolution_type = float;
+    using iterations_type = int;
+    using clique_size_type = int;
+    using clique_count_type = int;
+    using seconds_type = float;
 
     using clusterer_accessor = std::function< clusterer_type() >;
     using intensity_accessor = std::function< intensity_type() >;
@@ -32,6 +37,11 @@ public:
     using modularity_accessor = std::function< modularity_type() >;
     using gamma_accessor = std::function< gamma_type() >;
     using steps_accessor = std::function< steps_type() >;
+    using resolution_accessor = std::function< resolution_type() >;
+    using iterations_accessor = std::function< iterations_type() >;
+    using clique_size_accessor = std::function< clique_size_type() >;
+    using clique_count_accessor = std::function< clique_count_type() >;
+    using seconds_accessor = std::function< seconds_type() >;
 
 private:
     using clusterer_signal = boost::signals2::signal< void(clusterer_type) >;
@@ -42,6 +52,13 @@ private:
     using modularity_signal = boost::signals2::signal< void(modularity_type) >;
     using gamma_signal = boost::signals2::signal< void(gamma_type) >;
     using steps_signal = boost::signals2::signal< void(steps_type) >;
+    using resolution_signal = boost::signals2::signal< void(resolution_type) >;
+    using iterations_signal = boost::signals2::signal< void(iterations_type) >;
+    using clique_size_signal
+        = boost::signals2::signal< void(clique_size_type) >;
+    using clique_count_signal
+        = boost::signals2::signal< void(clique_count_type) >;
+    using seconds_signal = boost::signals2::signal< void(seconds_type) >;
     using cluster_signal = boost::signals2::signal< void() >;
     using hide_signal = boost::signals2::signal< void() >;
     using restore_signal = boost::signals2::signal< void() >;
@@ -55,6 +72,11 @@ public:
     using modularity_slot = modularity_signal::slot_type;
     using gamma_slot = gamma_signal::slot_type;
     using steps_slot = steps_signal::slot_type;
+    using resolution_slot = resolution_signal::slot_type;
+    using iterations_slot = iterations_signal::slot_type;
+    using clique_size_slot = clique_size_signal::slot_type;
+    using clique_count_slot = clique_count_signal::slot_type;
+    using seconds_slot = seconds_signal::slot_type;
     using cluster_slot = cluster_signal::slot_type;
     using hide_slot = hide_signal::slot_type;
     using restore_slot = restore_signal::slot_type;
@@ -76,6 +98,11 @@ public:
     auto min_modularity() const -> modularity_type;
     auto llp_gamma() const -> gamma_type;
     auto llp_steps() const -> steps_type;
+    auto leiden_resolution() const -> resolution_type;
+    auto leiden_iterations() const -> iterations_type;
+    auto mce_min_clique_size() const -> clique_size_type;
+    auto mce_max_cliques() const -> clique_count_type;
+    auto mce_time_limit() const -> seconds_type;
 
     auto set_clusterer(clusterer_accessor f) -> void;
     auto set_intensity(intensity_accessor f) -> void;
@@ -85,6 +112,11 @@ public:
     auto set_min_modularity(modularity_accessor f) -> void;
     auto set_llp_gamma(gamma_accessor f) -> void;
     auto set_llp_steps(steps_accessor f) -> void;
+    auto set_leiden_resolution(resolution_accessor f) -> void;
+    auto set_leiden_iterations(iterations_accessor f) -> void;
+    auto set_mce_min_clique_size(clique_size_accessor f) -> void;
+    auto set_mce_max_cliques(clique_count_accessor f) -> void;
+    auto set_mce_time_limit(seconds_accessor f) -> void;
 
     auto connect_to_clusterer(const clustererer_slot& f) -> connection;
     auto connect_to_intensity(const intensity_slot& f) -> connection;
@@ -94,6 +126,12 @@ public:
     auto connect_to_min_modularity(const modularity_slot& f) -> connection;
     auto connect_to_llp_gamma(const gamma_slot& f) -> connection;
     auto connect_to_llp_steps(const steps_slot& f) -> connection;
+    auto connect_to_leiden_resolution(const resolution_slot& f) -> connection;
+    auto connect_to_leiden_iterations(const iterations_slot& f) -> connection;
+    auto connect_to_mce_min_clique_size(const clique_size_slot& f)
+        -> connection;
+    auto connect_to_mce_max_cliques(const clique_count_slot& f) -> connection;
+    auto connect_to_mce_time_limit(const seconds_slot& f) -> connection;
     auto connect_to_cluster(const cluster_slot& f) -> connection;
     auto connect_to_hide(const hide_slot& f) -> connection;
     auto connect_to_restore(const restore_slot& f) -> connection;
@@ -115,6 +153,11 @@ protected:
     auto emit_min_modularity(modularity_type q) const -> void;
     auto emit_llp_gamma(gamma_type g) const -> void;
     auto emit_llp_steps(steps_type s) const -> void;
+    auto emit_leiden_resolution(resolution_type r) const -> void;
+    auto emit_leiden_iterations(iterations_type i) const -> void;
+    auto emit_mce_min_clique_size(clique_size_type n) const -> void;
+    auto emit_mce_max_cliques(clique_count_type n) const -> void;
+    auto emit_mce_time_limit(seconds_type secs) const -> void;
     auto emit_cluster() const -> void;
     auto emit_hide() const -> void;
     auto emit_restore() const -> void;
@@ -134,6 +177,11 @@ private:
     auto render_min_modularity_editor() const -> void;
     auto render_llp_gamma_editor() const -> void;
     auto render_llp_steps_editor() const -> void;
+    auto render_leiden_resolution_editor() const -> void;
+    auto render_leiden_iterations_editor() const -> void;
+    auto render_mce_min_clique_size_editor() const -> void;
+    auto render_mce_max_cliques_editor() const -> void;
+    auto render_mce_time_limit_editor() const -> void;
 
     mutable bool m_visible { false };
     clusterer_signal m_clusterer_sig;
@@ -144,6 +192,11 @@ private:
     modularity_signal m_min_mod_sig;
     gamma_signal m_llp_gamma_sig;
     steps_signal m_llp_steps_sig;
+    resolution_signal m_leiden_resolution_sig;
+    iterations_signal m_leiden_iterations_sig;
+    clique_size_signal m_mce_min_clique_size_sig;
+    clique_count_signal m_mce_max_cliques_sig;
+    seconds_signal m_mce_time_limit_sig;
     cluster_signal m_cluster_sig;
     hide_signal m_hide_sig;
     restore_signal m_restore_sig;
@@ -156,6 +209,11 @@ private:
     modularity_accessor m_min_mod;
     gamma_accessor m_llp_gamma;
     steps_accessor m_llp_steps;
+    resolution_accessor m_leiden_resolution;
+    iterations_accessor m_leiden_iterations;
+    clique_size_accessor m_mce_min_clique_size;
+    clique_count_accessor m_mce_max_cliques;
+    seconds_accessor m_mce_time_limit;
 
     mutable render_vector m_clusterers;
     mutable render_vector m_mst_finders;
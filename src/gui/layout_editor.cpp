@@ -38,8 +38,10 @@ auto layout_editor::render() const -> void
     render_layout_editor();
     render_topology_editor();
     render_scale_editor();
+    render_auto_refine_editor();
     spaces();
     render_restore_button();
+    render_progress_bar();
     ImGui::End();
 }
 
@@ -76,12 +78,29 @@ auto layout_editor::render_scale_editor() const -> void
         emit_scale(f);
 }
 
+auto layout_editor::render_auto_refine_editor() const -> void
+{
+    auto enabled = auto_refine();
+
+    if (ImGui::Checkbox("Refine on weight changes", &enabled))
+        emit_auto_refine(enabled);
+}
+
 auto layout_editor::render_restore_button() const -> void
 {
     if (ImGui::Button("Restore Defaults"))
         emit_restore();
 }
 
+auto layout_editor::render_progress_bar() const -> void
+{
+    if (progress() >= 1)
+        return;
+
+    spaces();
+    ImGui::ProgressBar(progress(), ImVec2(-1, 0), "Computing layout...");
+}
+
 auto layout_editor::layout() const -> layout_type
 {
     assert(m_layout);
@@ -100,6 +119,12 @@ auto layout_editor::scale() const -> scale_type
     return m_scale();
 }
 
+auto layout_editor::auto_refine() const -> bool
+{
+    assert(m_auto_refine);
+    return m_auto_refine();
+}
+
 auto layout_editor::set_layout(layout_accessor f) -> void
 {
     assert(f);
@@ -118,6 +143,12 @@ auto layout_editor::set_scale(scale_accessor f) -> void
     m_scale = std::move(f);
 }
 
+auto layout_editor::set_auto_refine(auto_refine_accessor f) -> void
+{
+    assert(f);
+    m_auto_refine = std::move(f);
+}
+
 auto layout_editor::connect_to_layout(const layout_slot& f) -> connection
 {
     return m_layout_sig.connect(f);
@@ -138,6 +169,12 @@ auto layout_editor::connect_to_restore(const restore_slot& f) -> connection
     return m_restore_sig.connect(f);
 }
 
+auto layout_editor::connect_to_auto_refine(const auto_refine_slot& f)
+    -> connection
+{
+    return m_auto_refine_sig.connect(f);
+}
+
 auto layout_editor::emit_layout(layout_type l) const -> void
 {
     m_layout_sig(l);
@@ -158,4 +195,9 @@ auto layout_editor::emit_restore() const -> void
     m_restore_sig();
 }
 
+auto layout_editor::emit_auto_refine(bool enabled) const -> void
+{
+    m_auto_refine_sig(enabled);
+}
+
 } // namespace gui
\ No newline at end of file
@@ -18,22 +18,26 @@ public:
     using layout_type = std::string_view;
     using topology_type = std::string_view;
     using scale_type = float;
+    using progress_type = float; // in [0, 1]
 
     using layout_accessor = std::function< layout_type() >;
     using topology_accessor = std::function< topology_type() >;
     using scale_accessor = std::function< scale_type() >;
+    using auto_refine_accessor = std::function< bool() >;
 
 private:
     using layout_signal = boost::signals2::signal< void(layout_type) >;
     using topology_signal = boost::signals2::signal< void(topology_type) >;
     using scale_signal = boost::signals2::signal< void(scale_type) >;
     using restore_signal = boost::signals2::signal< void() >;
+    using auto_refine_signal = boost::signals2::signal< void(bool) >;
 
 public:
     using layout_slot = layout_signal::slot_type;
     using topology_slot = topology_signal::slot_type;
     using scale_slot = scale_signal::slot_type;
     using restore_slot = restore_signal::slot_type;
+    using auto_refine_slot = auto_refine_signal::slot_type;
     using connection = boost::signals2::connection;
 
     layout_editor();
@@ -48,14 +52,23 @@ public:
     auto topology() const -> topology_type;
     auto scale() const -> scale_type;
 
+    // Whether the layout is refined upon each weights change.
+    auto auto_refine() const -> bool;
+
     auto set_layout(layout_accessor f) -> void;
     auto set_topology(topology_accessor f) -> void;
     auto set_scale(scale_accessor f) -> void;
+    auto set_auto_refine(auto_refine_accessor f) -> void;
+
+    // Shows the progress of a layout computation, if not complete.
+    auto progress() const -> progress_type { return m_progress; }
+    auto set_progress(progress_type p) -> void { m_progress = p; }
 
     auto connect_to_layout(const layout_slot& f) -> connection;
     auto connect_to_topology(const topology_slot& f) -> connection;
     auto connect_to_scale(const scale_slot& f) -> connection;
     auto connect_to_restore(const restore_slot& f) -> connection;
+    auto connect_to_auto_refine(const auto_refine_slot& f) -> connection;
 
 protected:
     using render_vector = std::vector< const char* >;
@@ -70,22 +83,29 @@ protected:
     auto emit_topology(topology_type t) const -> void;
     auto emit_scale(scale_type s) const -> void;
     auto emit_restore() const -> void;
+    auto emit_auto_refine(bool enabled) const -> void;
 
 private:
     auto render_layout_editor() const -> void;
     auto render_topology_editor() const -> void;
     auto render_scale_editor() const -> void;
+    auto render_auto_refine_editor() const -> void;
     auto render_restore_button() const -> void;
+    auto render_progress_bar() const -> void;
 
     mutable bool m_visible { false };
     layout_signal m_layout_sig;
     topology_signal m_topology_sig;
     scale_signal m_scale_sig;
     restore_signal m_restore_sig;
+    auto_refine_signal m_auto_refine_sig;
 
     layout_accessor m_layout;
     topology_accessor m_topology;
     scale_accessor m_scale;
+    auto_refine_accessor m_auto_refine;
+
+    progress_type m_progress { 1 };
 
     // For rendering only.
     mutable render_vector m_layouts;
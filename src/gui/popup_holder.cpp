@@ -22,6 +22,12 @@ auto popup_holder::contains(id_type id) const -> bool
     return m_popups.contains(id);
 }
 
+auto popup_holder::contains(std::string_view id) const -> bool
+{
+    const auto interned = id_type::find(id);
+    return interned and contains(*interned);
+}
+
 auto popup_holder::size() const -> size_type
 {
     return m_popups.size();
@@ -42,6 +48,12 @@ auto popup_holder::remove(id_type id) -> void
     assert(size() < m_popups.max_size());
 }
 
+auto popup_holder::remove(std::string_view id) -> void
+{
+    if (const auto interned = id_type::find(id); interned)
+        remove(*interned);
+}
+
 auto popup_holder::clear() -> void
 {
     m_popups.clear();
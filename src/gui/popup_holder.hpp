@@ -4,6 +4,7 @@
 #ifndef GUI_POPUP_HOLDER_HPP
 #define GUI_POPUP_HOLDER_HPP
 
+#include "misc/interning.hpp"   // for interned_string
 #include "structure_popup.hpp" // for structure_popup
 
 #include <string_view>   // for string_view
@@ -20,17 +21,19 @@ class popup_holder
 {
 public:
     using popup_type = structure_popup; // This will be a std::variant later.
-    using id_type = std::string_view;
+    using id_type = misc::interned_string;
     using size_type = std::size_t;
 
     auto get(id_type id) const -> const popup_type&;
     auto get(id_type id) -> popup_type&;
 
     auto contains(id_type id) const -> bool;
+    auto contains(std::string_view id) const -> bool;
     auto size() const -> size_type;
 
     auto insert(id_type id, popup_type popup) -> void;
     auto remove(id_type id) -> void;
+    auto remove(std::string_view id) -> void;
     auto clear() -> void;
 
 private:
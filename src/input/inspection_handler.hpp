@@ -5,6 +5,7 @@
 #ifndef INPUT_INSPECTION_HANDLER_HPP
 #define INPUT_INSPECTION_HANDLER_HPP
 
+#include "misc/interning.hpp"      // for interned_string
 #include "presentation/deffwd.hpp" // for graph_renderer, graph_collision_checker, overlay_manager, popup_holder
 
 #include <OGRE/Bites/OgreInput.h>   // for InputListener
@@ -51,7 +52,7 @@ public:
     auto mousePressed(const OgreBites::MouseButtonEvent& e) -> bool;
 
 private:
-    using collision_id_type = std::string;
+    using collision_id_type = misc::interned_string;
     using collision_stack = std::stack< collision_id_type >;
 
     graph_renderer_type& m_renderer;
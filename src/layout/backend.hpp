@@ -6,19 +6,27 @@
 
 #include "backend_config.hpp"   // for backend_config
 #include "layout.hpp"           // for layout
+#include "layout_cache.hpp"     // for layout_cache
 #include "layout_factory.hpp"   // for layout_factory
+#include "misc/array_map.hpp"   // for copy_edges
+#include "misc/job.hpp"         // for async_job, job_cancelled
+#include "misc/random.hpp"      // for stream_seed
 #include "plugin.hpp"           // for id_t
 #include "topology.hpp"         // for topology
 #include "topology_factory.hpp" // for topology_factory
 
 #include <boost/exception/all.hpp>        // for exception
+#include <boost/functional/hash.hpp>      // for hash_combine
 #include <boost/graph/graph_concepts.hpp> // for GraphConcept
 #include <boost/signals2/signal.hpp>      // for signal, connection
+#include <algorithm>                      // for find
 #include <cassert>                        // for assert
 #include <memory>                         // for unique_ptr
+#include <optional>                       // for optional
 #include <stdexcept>                      // for exception
 #include <string>                         // for string
 #include <string_view>                    // for string_view
+#include <vector>                         // for vector
 
 namespace layout
 {
@@ -59,6 +67,8 @@ using scale_info
  ***********************************************************/
 
 // Controls user interactions with the layout management system.
+// Caches the computed layouts, so that returning to a previous configuration
+// (e.g. through undo/redo) doesn't recompute its layout.
 template < typename Graph, typename WeightMap >
 class backend
 {
@@ -80,10 +90,16 @@ public:
     using topology_type = topology;
     using id_type = id_t;
     using scale_type = topology_type::scale_type;
+    using seed_type = topology_type::seed_type;
+    using progress_type = misc::job_token::progress_type;
+    using cache_type = layout_cache;
+
+    static constexpr auto refinement_iterations = 10;
 
 private:
     using layout_signal = boost::signals2::signal< void(const layout_type&) >;
     using topology_signal = boost::signals2::signal< void(const topology&) >;
+    using progress_signal = boost::signals2::signal< void(progress_type) >;
 
 public:
     using layout_factory_type = layout_factory< graph_type >;
@@ -91,6 +107,7 @@ public:
 
     using layout_slot = typename layout_signal::slot_type;
     using topology_slot = topology_signal::slot_type;
+    using progress_slot = progress_signal::slot_type;
     using connection = boost::signals2::connection;
 
     backend(
@@ -105,11 +122,49 @@ public:
     auto weight_map() const -> const weight_map_type& { return m_edge_weight; }
     auto config_data() const -> const config_data_type& { return m_config; }
 
+    // The seed of the layout random stream, derived from the configured one.
+    auto seed() const -> seed_type;
+    auto cache() const -> const cache_type& { return m_cache; }
+
+    // NOTE: Scale only updates rescale the current positions, instead of
+    // computing a new layout.
     auto update_layout(id_type id) -> void;
     auto update_layout(id_type space, scale_type scale, id_type lay) -> void;
 
+    // Asynchronous counterparts, computed on a background worker.
+    // A newer request supersedes (cancels) a pending one.
+    // Committed & emitted on the thread that polls the backend.
+    auto request_layout(id_type id) -> void;
+    auto request_layout(id_type space, scale_type scale, id_type lay) -> void;
+
+    // Emits the progress of a pending request, or commits it, if finished.
+    // A failed request is logged & dropped, keeping the committed layout.
+    // NOTE: Meant to be called periodically, e.g. once per frame.
+    auto poll() -> void;
+    auto cancel() -> void;
+
+    auto is_pending() const -> bool { return m_pending.has_value(); }
+
+    // Requests a few refinement iterations of the current layout, warm
+    // started from its current positions, (e.g. after a weights change).
+    auto request_refinement() -> void;
+
+    // Whether to request a refinement whenever the edge weights change.
+    auto auto_refine() const -> bool { return m_auto_refine; }
+    auto set_auto_refine(bool enabled) -> void { m_auto_refine = enabled; }
+
+    // NOTE: The weight map is read by the layouts, so this is how the backend
+    // is notified of any edge weight change.
+    auto notify_weights_changed() -> void;
+
+    // The latest requested layout & topology, (committed or pending).
+    auto requested_layout() const -> id_type;
+    auto requested_topology() const -> id_type;
+    auto requested_scale() const -> scale_type;
+
     auto connect_to_layout(const layout_slot& slot) -> connection;
     auto connect_to_topology(const topology_slot& slot) -> connection;
+    auto connect_to_progress(const progress_slot& slot) -> connection;
 
 protected:
     auto set_layout(id_type id) -> void;
@@ -117,11 +172,43 @@ protected:
 
     auto emit_layout() const -> void;
     auto emit_topology() const -> void;
+    auto emit_progress(progress_type progress) const -> void;
 
 private:
     using layout_pointer = typename layout_factory< graph_type >::pointer;
     using topology_pointer = topology_factory::pointer;
 
+    struct job_result
+    {
+        topology_pointer topology;
+        layout_pointer layout;
+    };
+
+    using job_type = misc::async_job< job_result >;
+    using job_pointer = std::unique_ptr< job_type >;
+
+    // NOTE: Refers to the (static) plugin ids.
+    struct pending_request
+    {
+        id_type topology;
+        scale_type scale;
+        id_type layout;
+        std::optional< layout_cache_key > key; // at request time, if caching
+        job_pointer job;
+    };
+
+    auto is_rescale(id_type space, scale_type scale, id_type lay) const
+        -> bool;
+    auto rescale(scale_type scale) -> void;
+
+    auto cache_key(id_type space, scale_type scale, id_type lay) const
+        -> layout_cache_key;
+    auto request_key(id_type space, scale_type scale, id_type lay) const
+        -> std::optional< layout_cache_key >;
+    auto restore_cached(id_type space, scale_type scale, id_type lay) -> bool;
+    auto cache_current() -> void;
+    auto cache_current(const layout_cache_key& key) -> void;
+
     auto verify_config() const -> void;
 
     const graph_type& m_g;
@@ -129,11 +216,18 @@ private:
 
     layout_signal m_layout_sig;
     topology_signal m_topology_sig;
+    progress_signal m_progress_sig;
 
     topology_pointer m_topology;
     layout_pointer m_layout;
 
     config_data_type m_config;
+    cache_type m_cache;
+
+    std::optional< pending_request > m_pending;
+    std::vector< job_pointer > m_cancelled; // until they return
+
+    bool m_auto_refine { false };
 };
 
 /***********************************************************
@@ -145,12 +239,22 @@ inline backend< Graph, WeightMap >::backend(
     const graph_type& g,
     weight_map_type edge_weight,
     config_data_type config)
-: m_g { g }, m_edge_weight { edge_weight }, m_config { std::move(config) }
+: m_g { g }
+, m_edge_weight { edge_weight }
+, m_config { std::move(config) }
+, m_cache { cache_type::budget_type(config_data().cache_budget) * 1024 * 1024 }
 {
     verify_config();
 
     set_topology(config_data().topology, config_data().scale);
     set_layout(config_data().layout);
+    cache_current();
+}
+
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::seed() const -> seed_type
+{
+    return misc::stream_seed(config_data().seed, "layout");
 }
 
 template < typename Graph, typename WeightMap >
@@ -162,7 +266,12 @@ inline auto backend< Graph, WeightMap >::update_layout(id_type id) -> void
         return;
     }
 
+    if (restore_cached(get_topology().id(), get_topology().scale(), id))
+        return;
+
+    cancel();
     set_layout(id);
+    cache_current();
     emit_layout();
 }
 
@@ -179,13 +288,229 @@ inline auto backend< Graph, WeightMap >::update_layout(
         return;
     }
 
+    if (restore_cached(space, scale, lay))
+        return;
+
+    if (is_rescale(space, scale, lay))
+    {
+        rescale(scale);
+        return;
+    }
+
+    cancel();
     set_topology(space, scale);
     set_layout(lay);
+    cache_current();
 
     emit_layout();
     emit_topology();
 }
 
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::request_layout(id_type id) -> void
+{
+    request_layout(requested_topology(), requested_scale(), id);
+}
+
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::request_layout(
+    id_type space,
+    scale_type scale,
+    id_type lay) -> void
+{
+    if (!is_topology_listed(config_data(), space) or scale < 0
+        or !is_layout_listed(config_data(), lay))
+    {
+        BOOST_LOG_TRIVIAL(warning) << "ignoring invalid layout request";
+        return;
+    }
+
+    if (restore_cached(space, scale, lay))
+        return;
+
+    if (is_rescale(space, scale, lay))
+    {
+        rescale(scale);
+        return;
+    }
+
+    assert(std::ranges::find(topology_ids, space) != std::end(topology_ids));
+    assert(std::ranges::find(layout_ids, lay) != std::end(layout_ids));
+
+    auto request = pending_request { *std::ranges::find(topology_ids, space),
+                                     scale,
+                                     *std::ranges::find(layout_ids, lay),
+                                     request_key(space, scale, lay),
+                                     nullptr };
+
+    cancel();
+
+    auto topology = topology_factory_type::make_topology(
+        request.topology, request.scale, seed());
+    assert(topology);
+
+    // NOTE: The graph is only read by the worker, while the weights may be
+    // rewritten in place, hence copied.
+    request.job = std::make_unique< job_type >(
+        [&g = graph(),
+         edge_weight = misc::copy_edges(graph(), weight_map()),
+         topology = std::move(topology),
+         lay = request.layout](misc::job_token& token) mutable
+        {
+            auto layout = layout_factory_type::make_layout(
+                lay, g, *topology, edge_weight, token);
+            return job_result { std::move(topology), std::move(layout) };
+        });
+
+    m_pending = std::move(request);
+
+    BOOST_LOG_TRIVIAL(debug) << "requested layout: " << m_pending->layout;
+}
+
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::request_refinement() -> void
+{
+    // Warm starting from positions that are about to be replaced is pointless.
+    if (is_pending())
+    {
+        request_layout(
+            requested_topology(), requested_scale(), requested_layout());
+        return;
+    }
+
+    auto request = pending_request {
+        get_topology().id(),
+        get_topology().scale(),
+        get_layout().id(),
+        request_key(
+            get_topology().id(), get_topology().scale(), get_layout().id()),
+        nullptr
+    };
+
+    // NOTE: The graph is only read by the worker, while the weights may be
+    // rewritten in place, hence copied.
+    request.job = std::make_unique< job_type >(
+        [&g = graph(),
+         edge_weight = misc::copy_edges(graph(), weight_map()),
+         topology = get_topology().clone(),
+         lay = request.layout,
+         initial = std::vector(
+             std::begin(get_layout().positions()),
+             std::end(get_layout().positions()))](
+            misc::job_token& token) mutable
+        {
+            auto layout = layout_factory_type::make_layout(
+                lay,
+                g,
+                *topology,
+                edge_weight,
+                initial,
+                refinement_iterations,
+                token);
+            return job_result { std::move(topology), std::move(layout) };
+        });
+
+    m_pending = std::move(request);
+
+    BOOST_LOG_TRIVIAL(debug) << "requested refinement: " << m_pending->layout;
+}
+
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::notify_weights_changed() -> void
+{
+    if (auto_refine())
+        request_refinement();
+}
+
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::poll() -> void
+{
+    std::erase_if(m_cancelled, [](const auto& job) { return job->ready(); });
+
+    if (!is_pending())
+        return;
+
+    if (!m_pending->job->ready())
+    {
+        emit_progress(m_pending->job->progress());
+        return;
+    }
+
+    auto job = std::move(m_pending->job);
+    const auto requested = m_pending->layout;
+    const auto key = m_pending->key;
+    m_pending.reset();
+
+    auto result = std::optional< job_result >();
+
+    try
+    {
+        result = job->get();
+    }
+    catch (const std::exception& e)
+    {
+        BOOST_LOG_TRIVIAL(error) << "failed layout: " << requested << '\n'
+                                 << boost::diagnostic_information(e);
+        emit_progress(1);
+        return;
+    }
+
+    auto&& [topology, layout] = *result;
+    assert(topology);
+    assert(layout);
+
+    const auto topology_changed = topology->id() != get_topology().id()
+        or topology->scale() != get_topology().scale();
+
+    m_topology = std::move(topology);
+    m_layout = std::move(layout);
+
+    // NOTE: The weights may have changed since the request.
+    if (key)
+        cache_current(*key);
+
+    BOOST_LOG_TRIVIAL(debug) << "committed layout: " << get_layout().id();
+
+    emit_progress(1);
+    emit_layout();
+
+    if (topology_changed)
+        emit_topology();
+}
+
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::cancel() -> void
+{
+    if (!is_pending())
+        return;
+
+    m_pending->job->cancel();
+    m_cancelled.push_back(std::move(m_pending->job));
+    m_pending.reset();
+
+    BOOST_LOG_TRIVIAL(debug) << "cancelled pending layout";
+
+    emit_progress(1);
+}
+
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::requested_layout() const -> id_type
+{
+    return is_pending() ? m_pending->layout : get_layout().id();
+}
+
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::requested_topology() const -> id_type
+{
+    return is_pending() ? m_pending->topology : get_topology().id();
+}
+
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::requested_scale() const -> scale_type
+{
+    return is_pending() ? m_pending->scale : get_topology().scale();
+}
+
 template < typename Graph, typename WeightMap >
 inline auto
 backend< Graph, WeightMap >::connect_to_layout(const layout_slot& slot)
@@ -202,12 +527,22 @@ backend< Graph, WeightMap >::connect_to_topology(const topology_slot& slot)
     return m_topology_sig.connect(slot);
 }
 
+template < typename Graph, typename WeightMap >
+inline auto
+backend< Graph, WeightMap >::connect_to_progress(const progress_slot& slot)
+    -> connection
+{
+    return m_progress_sig.connect(slot);
+}
+
 template < typename Graph, typename WeightMap >
 inline auto backend< Graph, WeightMap >::set_layout(id_type id) -> void
 {
     assert(m_topology);
-    m_layout = layout_factory_type::make_layout(
-        id, graph(), get_topology(), weight_map());
+    // NOTE: A fresh clone restarts the random sequence of the seed.
+    const auto space = get_topology().clone();
+    m_layout
+        = layout_factory_type::make_layout(id, graph(), *space, weight_map());
     assert(m_layout);
     assert(m_topology);
 }
@@ -216,7 +551,7 @@ template < typename Graph, typename WeightMap >
 inline auto
 backend< Graph, WeightMap >::set_topology(id_type id, scale_type scale) -> void
 {
-    m_topology = topology_factory_type::make_topology(id, scale);
+    m_topology = topology_factory_type::make_topology(id, scale, seed());
     assert(m_topology);
 }
 
@@ -232,6 +567,139 @@ inline auto backend< Graph, WeightMap >::emit_topology() const -> void
     m_topology_sig(get_topology());
 }
 
+template < typename Graph, typename WeightMap >
+inline auto
+backend< Graph, WeightMap >::emit_progress(progress_type progress) const
+    -> void
+{
+    m_progress_sig(progress);
+}
+
+// Whether only the scale of the committed layout changes.
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::is_rescale(
+    id_type space,
+    scale_type scale,
+    id_type lay) const -> bool
+{
+    return !is_pending() and space == get_topology().id()
+        and lay == get_layout().id() and scale != get_topology().scale()
+        and get_topology().scale() > 0;
+}
+
+// Scales the current positions, about the space center, in O(V).
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::rescale(scale_type scale) -> void
+{
+    assert(!is_pending());
+    assert(get_topology().scale() > 0);
+
+    const auto factor = scale / get_topology().scale();
+
+    auto positions = std::vector(
+        std::begin(get_layout().positions()),
+        std::end(get_layout().positions()));
+
+    for (auto& p : positions)
+        for (auto& coord : p)
+            coord *= factor;
+
+    set_topology(get_topology().id(), scale);
+    m_layout = layout_factory_type::make_layout(
+        get_layout().id(), graph(), get_topology(), weight_map(), positions, 0);
+    assert(m_layout);
+    cache_current();
+
+    BOOST_LOG_TRIVIAL(debug) << "rescaled layout by: " << factor;
+
+    emit_layout();
+    emit_topology();
+}
+
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::cache_key(
+    id_type space,
+    scale_type scale,
+    id_type lay) const -> layout_cache_key
+{
+    auto weights = std::size_t(0);
+    for (auto e : boost::make_iterator_range(boost::edges(graph())))
+        boost::hash_combine(weights, boost::get(weight_map(), e));
+
+    return { .layout = lay,
+             .topology = space,
+             .scale = scale,
+             .weights = weights,
+             .seed = seed() };
+}
+
+// The cache key of a requested configuration, if caching, in O(E).
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::request_key(
+    id_type space,
+    scale_type scale,
+    id_type lay) const -> std::optional< layout_cache_key >
+{
+    if (cache().budget() == 0)
+        return std::nullopt;
+
+    return cache_key(space, scale, lay);
+}
+
+// Commits the cached layout of a configuration, if any, in O(V + E).
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::restore_cached(
+    id_type space,
+    scale_type scale,
+    id_type lay) -> bool
+{
+    if (cache().empty())
+        return false;
+
+    const auto* positions = m_cache.find(cache_key(space, scale, lay));
+    if (!positions)
+        return false;
+
+    const auto topology_changed
+        = space != get_topology().id() or scale != get_topology().scale();
+
+    cancel();
+    set_topology(space, scale);
+    m_layout = layout_factory_type::make_layout(
+        lay, graph(), get_topology(), weight_map(), *positions, 0);
+    assert(m_layout);
+
+    BOOST_LOG_TRIVIAL(debug) << "restored cached layout: " << lay;
+
+    emit_layout();
+
+    if (topology_changed)
+        emit_topology();
+
+    return true;
+}
+
+template < typename Graph, typename WeightMap >
+inline auto backend< Graph, WeightMap >::cache_current() -> void
+{
+    if (cache().budget() == 0)
+        return;
+
+    cache_current(cache_key(
+        get_topology().id(), get_topology().scale(), get_layout().id()));
+}
+
+// Caches the committed layout under the key of its inputs.
+template < typename Graph, typename WeightMap >
+inline auto
+backend< Graph, WeightMap >::cache_current(const layout_cache_key& key) -> void
+{
+    m_cache.insert(
+        key,
+        { std::begin(get_layout().positions()),
+          std::end(get_layout().positions()) });
+}
+
 template < typename Graph, typename WeightMap >
 inline auto backend< Graph, WeightMap >::verify_config() const -> void
 {
@@ -347,6 +815,58 @@ inline auto restore_defaults(backend< Graph, WeightMap >& b)
         b.config_data().layout);
 }
 
+template < typename Graph, typename WeightMap >
+inline auto request_layout(
+    backend< Graph, WeightMap >& b,
+    typename backend< Graph, WeightMap >::id_type id)
+{
+    b.request_layout(id);
+}
+
+template < typename Graph, typename WeightMap >
+inline auto request_layout(
+    backend< Graph, WeightMap >& b,
+    typename backend< Graph, WeightMap >::id_type algo_id,
+    typename backend< Graph, WeightMap >::id_type space_id,
+    typename backend< Graph, WeightMap >::scale_type scale)
+{
+    b.request_layout(space_id, scale, algo_id);
+}
+
+template < typename Graph, typename WeightMap >
+inline auto request_topology(
+    backend< Graph, WeightMap >& b,
+    typename backend< Graph, WeightMap >::id_type id,
+    typename backend< Graph, WeightMap >::scale_type scale)
+{
+    b.request_layout(id, scale, b.requested_layout());
+}
+
+template < typename Graph, typename WeightMap >
+inline auto request_topology(
+    backend< Graph, WeightMap >& b,
+    typename backend< Graph, WeightMap >::id_type id)
+{
+    request_topology(b, id, b.requested_scale());
+}
+
+template < typename Graph, typename WeightMap >
+inline auto request_scale(
+    backend< Graph, WeightMap >& b,
+    typename backend< Graph, WeightMap >::scale_type scale)
+{
+    request_topology(b, b.requested_topology(), scale);
+}
+
+template < typename Graph, typename WeightMap >
+inline auto request_defaults(backend< Graph, WeightMap >& b)
+{
+    b.request_layout(
+        b.config_data().topology,
+        b.config_data().scale,
+        b.config_data().layout);
+}
+
 template < typename Graph, typename WeightMap >
 inline auto export_configs(const backend< Graph, WeightMap >& b)
 {
@@ -359,6 +879,8 @@ inline auto export_configs(const backend< Graph, WeightMap >& b)
     cfg.layout = get_layout_id(b);
     cfg.topology = get_topology_id(b);
     cfg.scale = get_scale(b);
+    cfg.cache_budget = b.config_data().cache_budget;
+    cfg.seed = b.config_data().seed;
     return cfg;
 }
 
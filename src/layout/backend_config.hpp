@@ -21,6 +21,8 @@ struct backend_config
     using id_view_type = std::string_view;
     using ids_type = std::vector< id_type >;
     using scale_type = double;
+    using budget_type = unsigned int;
+    using seed_type = unsigned int;
 
     ids_type layouts;
     ids_type topologies;
@@ -29,6 +31,9 @@ struct backend_config
     id_type topology;
     scale_type scale;
 
+    budget_type cache_budget { 0 }; // in megabytes
+    seed_type seed { 0 };
+
     auto operator==(const backend_config&) const -> bool = default;
     auto operator!=(const backend_config&) const -> bool = default;
 };
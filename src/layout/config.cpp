@@ -53,12 +53,17 @@ auto deserialize(const json_val& root) -> config_data
     auto&& layout = as< config_data::id_type >(get(root, "layout"));
     auto&& topology = as< config_data::id_type >(get(root, "topology"));
     auto&& scale = as< config_data::scale_type >(get(root, "scale"));
+    auto&& cache_budget
+        = as< config_data::budget_type >(get(root, "cache-budget"));
+    auto&& seed = as< config_data::seed_type >(get(root, "seed"));
 
     config_data res { .layouts = std::move(layouts),
                       .topologies = std::move(topologies),
                       .layout = std::move(layout),
                       .topology = std::move(topology),
-                      .scale = scale };
+                      .scale = scale,
+                      .cache_budget = cache_budget,
+                      .seed = seed };
 
     return res;
 }
@@ -79,6 +84,8 @@ auto serialize(json_val& root, const config_data& cfg) -> void
     root["layout"] = cfg.layout;
     root["topology"] = cfg.topology;
     root["scale"] = cfg.scale;
+    root["cache-budget"] = cfg.cache_budget;
+    root["seed"] = cfg.seed;
 
     BOOST_LOG_TRIVIAL(debug) << "serialized layout";
 }
@@ -5,7 +5,8 @@
 namespace layout
 {
 
-cube::cube(scale_type scale) : m_cube { scale }, m_scale { scale }
+cube::cube(scale_type scale, seed_type seed)
+: m_cube { make_data(scale, seed) }, m_scale { scale }, m_seed { seed }
 {
 }
 
@@ -14,28 +15,16 @@ auto cube::id() const -> id_type
     return cube_id;
 }
 
-auto cube::random_point() const -> point_type
-{
-    return data().random_point();
-}
-
-auto cube::distance(const point_type& p1, const point_type& p2) const
-    -> distance_type
-{
-    return data().distance(p1, p2);
-}
-
-auto cube::move_position_toward(
-    const point_type& p1,
-    fraction_type fraction,
-    const point_type& p2) const -> point_type
+auto cube::clone() const -> std::unique_ptr< topology >
 {
-    return data().move_position_toward(p1, fraction, p2);
+    return std::make_unique< cube >(scale(), seed());
 }
 
-auto cube::clone() const -> std::unique_ptr< topology >
+auto cube::make_data(scale_type scale, seed_type seed) -> data_type
 {
-    return std::make_unique< cube >(*this);
+    // NOTE: The boost topology copies the generator.
+    auto gen = std::minstd_rand(seed);
+    return data_type(gen, scale);
 }
 
 } // namespace layout
\ No newline at end of file
@@ -11,37 +11,57 @@
 namespace layout
 {
 
-class cube : public topology
+// NOTE: Final, so that the calls through a cube are statically dispatched.
+// NOTE: Its random points are reproducible, from its seed, and its clones
+// restart the random sequence of the seed.
+class cube final : public topology
 {
 public:
-    explicit cube(scale_type scale);
+    explicit cube(scale_type scale, seed_type seed = misc::default_seed);
     virtual ~cube() override = default;
 
-    auto random_point() const -> point_type override;
+    auto random_point() const -> point_type override
+    {
+        return data().random_point();
+    }
 
     auto distance(const point_type& p1, const point_type& p2) const
-        -> distance_type override;
+        -> distance_type override
+    {
+        return data().distance(p1, p2);
+    }
 
     auto move_position_toward(
         const point_type& p1,
         fraction_type fraction,
-        const point_type& p2) const -> point_type override;
+        const point_type& p2) const -> point_type override
+    {
+        return data().move_position_toward(p1, fraction, p2);
+    }
+
+    auto bound(const point_type& p) const -> point_type override
+    {
+        return data().bound(p);
+    }
 
     auto id() const -> id_type override;
     auto scale() const -> scale_type override { return m_scale; }
+    auto seed() const -> seed_type { return m_seed; }
 
     auto clone() const -> std::unique_ptr< topology > override;
 
-protected:
+private:
     using data_type = boost::cube_topology< std::minstd_rand >;
 
     // Raw topology data access.
     auto data() const -> const data_type& { return m_cube; }
     auto data() -> data_type& { return m_cube; }
 
-private:
+    static auto make_data(scale_type scale, seed_type seed) -> data_type;
+
     data_type m_cube;
     scale_type m_scale;
+    seed_type m_seed;
 };
 
 } // namespace layout
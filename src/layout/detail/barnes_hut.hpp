@@ -0,0 +1,292 @@
+// Contains a private module for the fruchterman_reingold_layout header.
+// Soultatos Stefanos 2022
+
+#ifndef LAYOUT_DETAIL_BARNES_HUT_HPP
+#define LAYOUT_DETAIL_BARNES_HUT_HPP
+
+#include <algorithm> // for partition, minmax
+#include <array>     // for array
+#include <cassert>   // for assert
+#include <cstddef>   // for size_t
+#include <cstdint>   // for uint32_t
+#include <numeric>   // for iota
+#include <span>      // for span
+#include <vector>    // for vector
+
+namespace layout::detail
+{
+
+using vector3 = std::array< double, 3 >;
+
+inline auto operator+(const vector3& lhs, const vector3& rhs) -> vector3
+{
+    return { lhs[0] + rhs[0], lhs[1] + rhs[1], lhs[2] + rhs[2] };
+}
+
+inline auto operator-(const vector3& lhs, const vector3& rhs) -> vector3
+{
+    return { lhs[0] - rhs[0], lhs[1] - rhs[1], lhs[2] - rhs[2] };
+}
+
+inline auto operator*(const vector3& v, double s) -> vector3
+{
+    return { v[0] * s, v[1] * s, v[2] * s };
+}
+
+inline auto dot(const vector3& lhs, const vector3& rhs) -> double
+{
+    return lhs[0] * rhs[0] + lhs[1] * rhs[1] + lhs[2] * rhs[2];
+}
+
+// Barnes-Hut space partitioning tree, over a set of 3D points.
+// Approximates the repulsive forces between n points in O(n log n).
+class octree
+{
+public:
+    using point_type = vector3;
+    using points_view = std::span< const point_type >;
+    using size_type = std::size_t;
+
+    static constexpr size_type leaf_capacity = 8;
+    static constexpr size_type max_depth = 32; // for coincident points
+
+    explicit octree(points_view points);
+
+    auto points() const -> points_view { return m_points; }
+
+    auto num_nodes() const -> size_type { return m_nodes.size(); }
+
+    // Sums the repulsive displacements, (k^2 / d), exerted on the i-th point
+    // from every other point.
+    // Clusters of points, whose width to distance ratio is below theta, are
+    // treated as a single point at their center of mass (0 for exact sums).
+    auto repulsion(size_type i, double k2, double theta) const -> vector3;
+
+private:
+    using index_type = std::uint32_t;
+
+    static constexpr index_type none = 0; // the root is never a child
+
+    struct node
+    {
+        point_type center;
+        double half_width;
+        point_type mass_center;
+        double mass;
+        size_type first, last; // in the points order
+        std::array< index_type, 8 > children;
+        bool leaf;
+    };
+
+    auto build(
+        size_type first,
+        size_type last,
+        const point_type& center,
+        double half_width,
+        size_type depth) -> index_type;
+
+    auto contains(const node& n, const point_type& p) const -> bool;
+
+    points_view m_points;
+    std::vector< size_type > m_order;
+    std::vector< node > m_nodes;
+};
+
+/***********************************************************
+ * Definitions                                             *
+ ***********************************************************/
+
+inline octree::octree(points_view points) : m_points { points }
+{
+    if (points.empty())
+        return;
+
+    m_order.resize(points.size());
+    std::iota(std::begin(m_order), std::end(m_order), size_type(0));
+
+    auto min = points.front();
+    auto max = points.front();
+    for (const auto& p : points)
+        for (auto axis = 0; axis < 3; ++axis)
+        {
+            min[axis] = std::min(min[axis], p[axis]);
+            max[axis] = std::max(max[axis], p[axis]);
+        }
+
+    const auto center = (min + max) * 0.5;
+    const auto extent = max - min;
+    const auto half_width
+        = std::max({ extent[0], extent[1], extent[2], 1e-9 }) * 0.5;
+
+    m_nodes.reserve(2 * points.size() / leaf_capacity + 1);
+    [[maybe_unused]] const auto root
+        = build(0, points.size(), center, half_width, 0);
+    assert(root == 0);
+}
+
+inline auto octree::build(
+    size_type first,
+    size_type last,
+    const point_type& center,
+    double half_width,
+    size_type depth) -> index_type
+{
+    assert(first < last);
+
+    const auto index = static_cast< index_type >(m_nodes.size());
+    m_nodes.push_back({ .center = center,
+                        .half_width = half_width,
+                        .mass_center = { 0, 0, 0 },
+                        .mass = 0,
+                        .first = first,
+                        .last = last,
+                        .children = {},
+                        .leaf = true });
+
+    if (last - first <= leaf_capacity or depth == max_depth)
+    {
+        auto sum = point_type { 0, 0, 0 };
+        for (auto i = first; i != last; ++i)
+            sum = sum + m_points[m_order[i]];
+
+        auto& n = m_nodes[index];
+        n.mass = static_cast< double >(last - first);
+        n.mass_center = sum * (1 / n.mass);
+        return index;
+    }
+
+    // Partition the points into octants, (x, y, z) high bits, in order.
+    const auto begin = std::begin(m_order);
+    const auto split = [this, begin, &center](auto f, auto l, int axis)
+    {
+        const auto it = std::partition(
+            begin + f,
+            begin + l,
+            [this, &center, axis](auto i)
+            { return m_points[i][axis] < center[axis]; });
+
+        return static_cast< size_type >(it - begin);
+    };
+
+    auto bounds = std::array< size_type, 9 > {};
+    bounds[0] = first;
+    bounds[8] = last;
+    bounds[4] = split(bounds[0], bounds[8], 0);
+    bounds[2] = split(bounds[0], bounds[4], 1);
+    bounds[6] = split(bounds[4], bounds[8], 1);
+    bounds[1] = split(bounds[0], bounds[2], 2);
+    bounds[3] = split(bounds[2], bounds[4], 2);
+    bounds[5] = split(bounds[4], bounds[6], 2);
+    bounds[7] = split(bounds[6], bounds[8], 2);
+
+    auto children = std::array< index_type, 8 > {};
+    auto sum = point_type { 0, 0, 0 };
+    const auto quarter_width = half_width * 0.5;
+
+    for (auto octant = 0; octant < 8; ++octant)
+    {
+        if (bounds[octant] == bounds[octant + 1])
+            continue;
+
+        const auto offset = point_type {
+            octant & 4 ? quarter_width : -quarter_width,
+            octant & 2 ? quarter_width : -quarter_width,
+            octant & 1 ? quarter_width : -quarter_width
+        };
+
+        const auto child = build(
+            bounds[octant],
+            bounds[octant + 1],
+            center + offset,
+            quarter_width,
+            depth + 1);
+
+        // NOTE: m_nodes may have reallocated.
+        const auto& c = m_nodes[child];
+        sum = sum + c.mass_center * c.mass;
+        children[octant] = child;
+    }
+
+    auto& n = m_nodes[index];
+    n.leaf = false;
+    n.children = children;
+    n.mass = static_cast< double >(last - first);
+    n.mass_center = sum * (1 / n.mass);
+    return index;
+}
+
+inline auto octree::contains(const node& n, const point_type& p) const -> bool
+{
+    for (auto axis = 0; axis < 3; ++axis)
+        if (p[axis] < n.center[axis] - n.half_width
+            or p[axis] > n.center[axis] + n.half_width)
+            return false;
+
+    return true;
+}
+
+inline auto octree::repulsion(size_type i, double k2, double theta) const
+    -> vector3
+{
+    assert(i < m_points.size());
+
+    // Nudge for coincident points, in order to separate them.
+    constexpr auto min_distance = 1e-6;
+
+    auto res = vector3 { 0, 0, 0 };
+    if (m_nodes.empty())
+        return res;
+
+    const auto& p = m_points[i];
+
+    auto stack = std::array< index_type, 8 * (max_depth + 1) > {};
+    auto top = size_type(0);
+    stack[top++] = 0;
+
+    while (top != 0)
+    {
+        const auto& n = m_nodes[stack[--top]];
+
+        if (n.leaf)
+        {
+            for (auto o = n.first; o != n.last; ++o)
+            {
+                const auto j = m_order[o];
+                if (j == i)
+                    continue;
+
+                auto delta = p - m_points[j];
+                auto d2 = dot(delta, delta);
+                if (d2 < min_distance * min_distance)
+                {
+                    delta = { i < j ? -min_distance : min_distance, 0, 0 };
+                    d2 = min_distance * min_distance;
+                }
+
+                res = res + delta * (k2 / d2);
+            }
+
+            continue;
+        }
+
+        const auto delta = p - n.mass_center;
+        const auto d2 = dot(delta, delta);
+        const auto width = 2 * n.half_width;
+
+        if (!contains(n, p) and width * width < theta * theta * d2)
+        {
+            res = res + delta * (n.mass * k2 / d2);
+            continue;
+        }
+
+        for (auto child : n.children)
+            if (child != none)
+                stack[top++] = child;
+    }
+
+    return res;
+}
+
+} // namespace layout::detail
+
+#endif // LAYOUT_DETAIL_BARNES_HUT_HPP
@@ -0,0 +1,239 @@
+// Contains a private module for the force directed layouts.
+// Soultatos Stefanos 2022
+
+#ifndef LAYOUT_DETAIL_FORCE_DIRECTED_HPP
+#define LAYOUT_DETAIL_FORCE_DIRECTED_HPP
+
+#include "barnes_hut.hpp"      // for octree, vector3
+#include "layout/topology.hpp" // for topology
+#include "misc/parallel.hpp"   // for parallel_for
+
+#include <algorithm>                      // for min, max
+#include <boost/graph/adjacency_list.hpp> // for edges, source, target
+#include <cassert>                        // for assert
+#include <cmath>                          // for sqrt, cbrt
+#include <cstddef>                        // for size_t
+#include <iterator>                       // for prev
+#include <span>                           // for span
+#include <vector>                         // for vector
+
+namespace layout::detail
+{
+
+struct weighted_edge
+{
+    std::size_t source;
+    std::size_t target;
+    double weight; // in [0, 1]
+};
+
+using weighted_edges = std::vector< weighted_edge >;
+
+// Collects the (non loop) edges of a graph, with their weights normalized to
+// [0, 1], so that heavy edges don't dominate a layout.
+template < typename Graph, typename WeightMap >
+auto make_weighted_edges(const Graph& g, WeightMap edge_weight)
+    -> weighted_edges
+{
+    auto res = weighted_edges();
+    res.reserve(boost::num_edges(g));
+
+    auto max_weight = 0.0;
+    for (auto e : boost::make_iterator_range(boost::edges(g)))
+    {
+        const auto u = boost::source(e, g);
+        const auto v = boost::target(e, g);
+        if (u == v)
+            continue;
+
+        const auto w = std::max(double(boost::get(edge_weight, e)), 0.0);
+        max_weight = std::max(max_weight, w);
+        res.push_back({ .source = static_cast< std::size_t >(u),
+                        .target = static_cast< std::size_t >(v),
+                        .weight = w });
+    }
+
+    if (max_weight > 0)
+        for (auto& e : res)
+            e.weight /= max_weight;
+
+    return res;
+}
+
+// Undirected adjacency of weighted edges, in compressed sparse row format.
+struct weighted_adjacency
+{
+    struct neighbour
+    {
+        std::size_t vertex;
+        double weight;
+    };
+
+    std::vector< std::size_t > offsets;
+    std::vector< neighbour > neighbours;
+
+    auto num_vertices() const -> std::size_t { return offsets.size() - 1; }
+
+    auto neighbours_of(std::size_t v) const -> std::span< const neighbour >
+    {
+        assert(v < num_vertices());
+        return { neighbours.data() + offsets[v], offsets[v + 1] - offsets[v] };
+    }
+};
+
+// Builds the undirected adjacency of a set of edges, in O(V + E).
+inline auto make_weighted_adjacency(
+    std::size_t num_vertices,
+    std::span< const weighted_edge > edges) -> weighted_adjacency
+{
+    auto res = weighted_adjacency();
+
+    res.offsets.assign(num_vertices + 1, 0);
+    for (const auto& e : edges)
+    {
+        ++res.offsets[e.source + 1];
+        ++res.offsets[e.target + 1];
+    }
+
+    for (std::size_t v = 0; v < num_vertices; ++v)
+        res.offsets[v + 1] += res.offsets[v];
+
+    res.neighbours.resize(res.offsets.back());
+    auto next = std::vector< std::size_t >(
+        std::begin(res.offsets), std::prev(std::end(res.offsets)));
+
+    for (const auto& e : edges)
+    {
+        res.neighbours[next[e.source]++] = { e.target, e.weight };
+        res.neighbours[next[e.target]++] = { e.source, e.weight };
+    }
+
+    return res;
+}
+
+// Returns the closest position to p, that lies within the space.
+template < typename Topology >
+inline auto bound(const Topology& space, const vector3& p) -> vector3
+{
+    auto point = typename Topology::point_type();
+    point[0] = p[0];
+    point[1] = p[1];
+    point[2] = p[2];
+
+    point = space.bound(point);
+    return { point[0], point[1], point[2] };
+}
+
+// Returns a random offset, symmetric about the origin, regardless of the space.
+// NOTE: The difference of two draws, since e.g. the cube draws its random
+// points from [0, scale]^3 only.
+inline auto random_offset(const topology& space) -> vector3
+{
+    const auto a = space.random_point();
+    const auto b = space.random_point();
+    return { a[0] - b[0], a[1] - b[1], a[2] - b[2] };
+}
+
+// Copies a set of (initial) positions, bounded within a space.
+inline auto bounded_positions(
+    std::span< const vector3 > initial,
+    const topology& space) -> std::vector< vector3 >
+{
+    auto res = std::vector< vector3 >();
+    res.reserve(initial.size());
+
+    for (const auto& p : initial)
+        res.push_back(bound(space, p));
+
+    return res;
+}
+
+// Ideal edge length, so that n vertices fill a space.
+inline auto ideal_edge_length(std::size_t n, const topology& space) -> double
+{
+    return 2 * space.scale() / std::cbrt(double(std::max(n, std::size_t(1))));
+}
+
+// Moves each position once, in respect to the Fruchterman-Reingold repulsive
+// and attractive forces, by a displacement of at most temperature.
+// The repulsive forces are approximated with a Barnes-Hut octree, and computed
+// on all hardware threads.
+// NOTE: Instantiated per (concrete) topology, see visit_topology.
+template < typename Topology >
+inline auto force_directed_step(
+    std::span< vector3 > positions,
+    std::span< vector3 > displacements,
+    std::span< const weighted_edge > edges,
+    const Topology& space,
+    double k,
+    double temperature,
+    double theta) -> void
+{
+    assert(positions.size() == displacements.size());
+
+    const auto n = positions.size();
+    const auto k2 = k * k;
+    const auto tree = octree(positions);
+
+    misc::parallel_for(
+        std::size_t(0),
+        n,
+        [&tree, displacements, k2, theta](auto v)
+        { displacements[v] = tree.repulsion(v, k2, theta); });
+
+    for (const auto& e : edges)
+    {
+        const auto delta = positions[e.source] - positions[e.target];
+        const auto d = std::sqrt(dot(delta, delta));
+        const auto force = delta * (e.weight * d / k);
+
+        displacements[e.source] = displacements[e.source] - force;
+        displacements[e.target] = displacements[e.target] + force;
+    }
+
+    misc::parallel_for(
+        std::size_t(0),
+        n,
+        [positions, displacements, &space, temperature](auto v)
+        {
+            const auto& disp = displacements[v];
+            const auto len = std::sqrt(dot(disp, disp));
+            if (len == 0)
+                return;
+
+            positions[v] = bound(
+                space,
+                positions[v] + disp * (std::min(len, temperature) / len));
+        });
+}
+
+// Runs a number of force directed steps, with a linearly cooling temperature.
+// Calls the checkpoint with the index of each iteration, before running it.
+template < typename Topology, typename Checkpoint >
+inline auto force_directed_steps(
+    std::span< vector3 > positions,
+    std::span< const weighted_edge > edges,
+    const Topology& space,
+    int iterations,
+    double initial_temperature,
+    double theta,
+    Checkpoint checkpoint) -> void
+{
+    auto displacements = std::vector< vector3 >(positions.size());
+    const auto k = ideal_edge_length(positions.size(), space);
+
+    for (auto iteration = 0; iteration < iterations; ++iteration)
+    {
+        checkpoint(iteration);
+
+        const auto temperature
+            = initial_temperature * (1 - double(iteration) / iterations);
+
+        force_directed_step(
+            positions, displacements, edges, space, k, temperature, theta);
+    }
+}
+
+} // namespace layout::detail
+
+#endif // LAYOUT_DETAIL_FORCE_DIRECTED_HPP
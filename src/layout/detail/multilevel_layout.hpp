@@ -0,0 +1,172 @@
+// Contains a private module for the multilevel_layout header.
+// Soultatos Stefanos 2022
+
+#ifndef LAYOUT_DETAIL_MULTILEVEL_LAYOUT_HPP
+#define LAYOUT_DETAIL_MULTILEVEL_LAYOUT_HPP
+
+#include "force_directed.hpp" // for weighted_edges, make_weighted_adjacency
+
+#include <algorithm> // for sort, max, max_element, minmax
+#include <cstddef>   // for size_t
+#include <limits>    // for numeric_limits
+#include <span>      // for span
+#include <vector>    // for vector
+
+namespace layout::detail
+{
+
+// Maps each vertex to its coarse vertex.
+using coarse_map = std::vector< std::size_t >;
+
+// Matches each vertex with its (unmatched) neighbour through the heaviest
+// edge, if any, in O(V + E).
+// The vertices left unmatched, (e.g. the leaves of a hub, or the isolated
+// vertices), are then paired with each other, when they share their heaviest
+// neighbour, or when they are both isolated, so that these are coarsened too.
+// Returns the mapping of each vertex to its coarse vertex, (one per match).
+inline auto match_heavy_edges(
+    std::size_t num_vertices,
+    std::span< const weighted_edge > edges) -> coarse_map
+{
+    const auto adjacency = make_weighted_adjacency(num_vertices, edges);
+
+    constexpr auto unmatched = std::numeric_limits< std::size_t >::max();
+
+    // Returns the heaviest neighbour of a vertex, among the ones that satisfy
+    // a predicate, if any.
+    const auto heaviest_neighbour = [&adjacency](auto u, auto pred)
+    {
+        auto best = unmatched;
+        auto best_weight = -1.0;
+
+        for (const auto& [v, w] : adjacency.neighbours_of(u))
+        {
+            if (v != u and pred(v) and w > best_weight)
+            {
+                best = v;
+                best_weight = w;
+            }
+        }
+
+        return best;
+    };
+
+    auto mate = std::vector< std::size_t >(num_vertices, unmatched);
+
+    for (std::size_t u = 0; u < num_vertices; ++u)
+    {
+        if (mate[u] != unmatched)
+            continue;
+
+        const auto best = heaviest_neighbour(
+            u, [&mate](auto v) { return mate[v] == unmatched; });
+
+        if (best != unmatched)
+        {
+            mate[u] = best;
+            mate[best] = u;
+        }
+    }
+
+    // The last left over vertex per hub, (or per none, if isolated).
+    auto waiting = std::vector< std::size_t >(num_vertices, unmatched);
+    auto waiting_isolated = unmatched;
+
+    for (std::size_t u = 0; u < num_vertices; ++u)
+    {
+        if (mate[u] != unmatched)
+            continue;
+
+        const auto hub = heaviest_neighbour(u, [](auto) { return true; });
+        auto& other = hub != unmatched ? waiting[hub] : waiting_isolated;
+
+        if (other != unmatched)
+        {
+            mate[u] = other;
+            mate[other] = u;
+            other = unmatched;
+        }
+        else
+        {
+            other = u;
+        }
+    }
+
+    auto res = coarse_map(num_vertices, unmatched);
+    auto num_coarse = std::size_t(0);
+
+    for (std::size_t u = 0; u < num_vertices; ++u)
+    {
+        if (res[u] != unmatched)
+            continue;
+
+        res[u] = num_coarse;
+        if (mate[u] != unmatched)
+            res[mate[u]] = num_coarse;
+
+        ++num_coarse;
+    }
+
+    return res;
+}
+
+// Returns the number of coarse vertices of a mapping.
+inline auto num_coarse_vertices(const coarse_map& parent) -> std::size_t
+{
+    return parent.empty()
+        ? 0
+        : *std::max_element(std::begin(parent), std::end(parent)) + 1;
+}
+
+// Contracts the edges onto their coarse vertices, in O(E log E).
+// Parallel edges are merged, their weights are summed and then re-normalized
+// to [0, 1].
+inline auto contract_edges(
+    std::span< const weighted_edge > edges,
+    const coarse_map& parent) -> weighted_edges
+{
+    auto res = weighted_edges();
+    res.reserve(edges.size());
+
+    for (const auto& e : edges)
+    {
+        const auto [u, v] = std::minmax(parent[e.source], parent[e.target]);
+        if (u != v)
+            res.push_back({ .source = u, .target = v, .weight = e.weight });
+    }
+
+    std::sort(
+        std::begin(res),
+        std::end(res),
+        [](const auto& lhs, const auto& rhs)
+        {
+            return lhs.source != rhs.source ? lhs.source < rhs.source
+                                            : lhs.target < rhs.target;
+        });
+
+    auto merged = std::size_t(0);
+    auto max_weight = 0.0;
+
+    for (std::size_t i = 0; i < res.size(); ++i)
+    {
+        if (merged != 0 and res[merged - 1].source == res[i].source
+            and res[merged - 1].target == res[i].target)
+            res[merged - 1].weight += res[i].weight;
+        else
+            res[merged++] = res[i];
+
+        max_weight = std::max(max_weight, res[merged - 1].weight);
+    }
+
+    res.resize(merged);
+
+    if (max_weight > 0)
+        for (auto& e : res)
+            e.weight /= max_weight;
+
+    return res;
+}
+
+} // namespace layout::detail
+
+#endif // LAYOUT_DETAIL_MULTILEVEL_LAYOUT_HPP
@@ -0,0 +1,701 @@
+// Contains a private module for the pivot_mds_layout header.
+// Soultatos Stefanos 2022
+
+#ifndef LAYOUT_DETAIL_PIVOT_MDS_HPP
+#define LAYOUT_DETAIL_PIVOT_MDS_HPP
+
+#include "barnes_hut.hpp"     // for vector3
+#include "force_directed.hpp" // for weighted_adjacency, bound
+#include "misc/parallel.hpp"  // for parallel_for
+
+#include <algorithm>  // for max, max_element, fill, copy, stable_sort
+#include <array>      // for array
+#include <cassert>    // for assert
+#include <cmath>      // for sqrt, isinf, cbrt
+#include <cstddef>    // for size_t
+#include <functional> // for greater
+#include <iterator>   // for distance
+#include <limits>     // for numeric_limits
+#include <numeric>    // for iota
+#include <queue>      // for priority_queue
+#include <span>       // for span
+#include <utility>    // for pair
+#include <vector>     // for vector
+
+namespace layout::detail
+{
+
+constexpr auto infinite_distance = std::numeric_limits< double >::infinity();
+
+// Checkpoint that ignores its calls.
+struct no_checkpoint
+{
+    template < typename T >
+    auto operator()(T) const -> void
+    {
+    }
+};
+
+// The length of a (normalized) weighted edge, heavier edges are shorter.
+// Edges without weight are ignored.
+inline auto edge_length(double weight) -> double
+{
+    return weight > 0 ? 1 / weight : infinite_distance;
+}
+
+// Single source shortest path distances, over the edge lengths, in
+// O((V + E) log V).
+// Unreachable vertices are placed just beyond the farthest reachable one.
+inline auto shortest_distances(
+    const weighted_adjacency& adjacency,
+    std::size_t source,
+    std::span< double > distances) -> void
+{
+    using entry = std::pair< double, std::size_t >;
+
+    assert(distances.size() == adjacency.num_vertices());
+
+    std::fill(std::begin(distances), std::end(distances), infinite_distance);
+
+    auto queue = std::priority_queue<
+        entry,
+        std::vector< entry >,
+        std::greater< entry > >();
+
+    distances[source] = 0;
+    queue.emplace(0, source);
+
+    auto farthest = 0.0;
+
+    while (!queue.empty())
+    {
+        const auto [d, u] = queue.top();
+        queue.pop();
+
+        if (d > distances[u])
+            continue;
+
+        farthest = std::max(farthest, d);
+
+        for (const auto& [v, w] : adjacency.neighbours_of(u))
+        {
+            const auto dv = d + edge_length(w);
+            if (dv < distances[v])
+            {
+                distances[v] = dv;
+                queue.emplace(dv, v);
+            }
+        }
+    }
+
+    for (auto& d : distances)
+        if (std::isinf(d))
+            d = farthest + 1;
+}
+
+// Vertex by pivot distance matrix, (row per pivot).
+struct pivot_distances
+{
+    std::vector< std::size_t > pivots;
+    std::vector< double > data;
+    std::size_t num_vertices;
+
+    auto at(std::size_t pivot, std::size_t v) const -> double
+    {
+        return data[pivot * num_vertices + v];
+    }
+};
+
+// Picks (at most) num_pivots pivots, each one farthest from all of the
+// previous ones (max-min), starting from the first vertex, in
+// O(num_pivots * (V + E) log V).
+// Calls the checkpoint with the index of each pivot, before its distances.
+template < typename Checkpoint = no_checkpoint >
+inline auto make_pivot_distances(
+    const weighted_adjacency& adjacency,
+    std::size_t num_pivots,
+    Checkpoint checkpoint = {}) -> pivot_distances
+{
+    const auto n = adjacency.num_vertices();
+    num_pivots = std::min(num_pivots, n);
+
+    auto res = pivot_distances { .pivots = {},
+                                 .data = std::vector< double >(num_pivots * n),
+                                 .num_vertices = n };
+
+    auto min_distances = std::vector< double >(n, infinite_distance);
+    auto next = std::size_t(0);
+
+    for (std::size_t p = 0; p < num_pivots; ++p)
+    {
+        checkpoint(p);
+
+        res.pivots.push_back(next);
+
+        const auto row = std::span(res.data).subspan(p * n, n);
+        shortest_distances(adjacency, next, row);
+
+        for (std::size_t v = 0; v < n; ++v)
+            min_distances[v] = std::min(min_distances[v], row[v]);
+
+        next = static_cast< std::size_t >(std::distance(
+            std::begin(min_distances),
+            std::max_element(
+                std::begin(min_distances), std::end(min_distances))));
+    }
+
+    return res;
+}
+
+// Classical (pivot) multidimensional scaling of the pivot distances into 3D,
+// in O(V * pivots^2).
+// Uses the top eigenvectors of C^T C, where C is the double centered matrix
+// of the squared distances.
+inline auto pivot_mds(const pivot_distances& dists) -> std::vector< vector3 >
+{
+    const auto n = dists.num_vertices;
+    const auto k = dists.pivots.size();
+
+    auto res = std::vector< vector3 >(n, vector3 { 0, 0, 0 });
+    if (k == 0)
+        return res;
+
+    // Double centering terms.
+
+    auto vertex_means = std::vector< double >(n, 0);
+    auto pivot_means = std::vector< double >(k, 0);
+    auto grand_mean = 0.0;
+
+    for (std::size_t p = 0; p < k; ++p)
+        for (std::size_t v = 0; v < n; ++v)
+        {
+            const auto d = dists.at(p, v);
+            vertex_means[v] += d * d / k;
+            pivot_means[p] += d * d / n;
+            grand_mean += d * d / (double(n) * k);
+        }
+
+    const auto centered = [&](std::size_t p, std::size_t v)
+    {
+        const auto d = dists.at(p, v);
+        return -0.5 * (d * d - vertex_means[v] - pivot_means[p] + grand_mean);
+    };
+
+    // B = C^T C, (k x k).
+
+    auto b = std::vector< double >(k * k, 0);
+    auto column = std::vector< double >(k);
+
+    for (std::size_t v = 0; v < n; ++v)
+    {
+        for (std::size_t p = 0; p < k; ++p)
+            column[p] = centered(p, v);
+
+        for (std::size_t i = 0; i < k; ++i)
+            for (std::size_t j = i; j < k; ++j)
+                b[i * k + j] += column[i] * column[j];
+    }
+
+    for (std::size_t i = 0; i < k; ++i)
+        for (std::size_t j = 0; j < i; ++j)
+            b[i * k + j] = b[j * k + i];
+
+    // Top 3 eigenvectors of B, through power iteration with deflation.
+
+    constexpr auto max_iterations = 200;
+    constexpr auto tolerance = 1e-9;
+
+    auto eigenvectors = std::array< std::vector< double >, 3 > {};
+
+    for (std::size_t axis = 0; axis < 3; ++axis)
+    {
+        auto& x = eigenvectors[axis];
+        x.resize(k);
+
+        // Deterministic, and not orthogonal to any of the eigenvectors.
+        for (std::size_t i = 0; i < k; ++i)
+            x[i] = 1.0 + double((i * (axis + 1)) % k) / double(k);
+
+        auto y = std::vector< double >(k);
+
+        for (auto iteration = 0; iteration < max_iterations; ++iteration)
+        {
+            for (std::size_t prev = 0; prev < axis; ++prev)
+            {
+                const auto& e = eigenvectors[prev];
+                auto proj = 0.0;
+                for (std::size_t i = 0; i < k; ++i)
+                    proj += x[i] * e[i];
+                for (std::size_t i = 0; i < k; ++i)
+                    x[i] -= proj * e[i];
+            }
+
+            for (std::size_t i = 0; i < k; ++i)
+            {
+                y[i] = 0;
+                for (std::size_t j = 0; j < k; ++j)
+                    y[i] += b[i * k + j] * x[j];
+            }
+
+            auto norm = 0.0;
+            for (auto yi : y)
+                norm += yi * yi;
+            norm = std::sqrt(norm);
+
+            if (norm == 0)
+            {
+                std::fill(std::begin(x), std::end(x), 0);
+                break;
+            }
+
+            auto change = 0.0;
+            for (std::size_t i = 0; i < k; ++i)
+            {
+                const auto xi = y[i] / norm;
+                change += (xi - x[i]) * (xi - x[i]);
+                x[i] = xi;
+            }
+
+            if (change < tolerance)
+                break;
+        }
+    }
+
+    // X = C V, (n x 3).
+
+    misc::parallel_for(
+        std::size_t(0),
+        n,
+        [&](auto v)
+        {
+            for (std::size_t p = 0; p < k; ++p)
+            {
+                const auto c = centered(p, v);
+                for (std::size_t axis = 0; axis < 3; ++axis)
+                    res[v][axis] += c * eigenvectors[axis][p];
+            }
+        });
+
+    return res;
+}
+
+// Sparse stress majorization, in respect to the adjacent and the pivot
+// distances, in O(V * pivots + E) per iteration.
+// Calls the checkpoint with the number of iterations run, after each one.
+template < typename Checkpoint = no_checkpoint >
+inline auto sparse_stress_majorization(
+    std::span< vector3 > positions,
+    const weighted_adjacency& adjacency,
+    const pivot_distances& dists,
+    int iterations,
+    Checkpoint checkpoint = {}) -> void
+{
+    const auto n = positions.size();
+    auto next = std::vector< vector3 >(n);
+
+    const auto attract = [](const vector3& xi,
+                            const vector3& xj,
+                            double d,
+                            vector3& sum,
+                            double& weights)
+    {
+        const auto w = 1 / (d * d);
+        const auto delta = xi - xj;
+        const auto norm = std::sqrt(dot(delta, delta));
+        const auto target = norm > 0 ? xj + delta * (d / norm) : xj;
+
+        sum = sum + target * w;
+        weights += w;
+    };
+
+    for (auto iteration = 0; iteration < iterations; ++iteration)
+    {
+        misc::parallel_for(
+            std::size_t(0),
+            n,
+            [&](auto v)
+            {
+                auto sum = vector3 { 0, 0, 0 };
+                auto weights = 0.0;
+
+                for (const auto& [u, w] : adjacency.neighbours_of(v))
+                    if (u != v and w > 0)
+                        attract(
+                            positions[v],
+                            positions[u],
+                            edge_length(w),
+                            sum,
+                            weights);
+
+                for (std::size_t p = 0; p < dists.pivots.size(); ++p)
+                {
+                    const auto u = dists.pivots[p];
+                    const auto d = dists.at(p, v);
+                    if (u != v and d > 0)
+                        attract(positions[v], positions[u], d, sum, weights);
+                }
+
+                next[v] = weights > 0 ? sum * (1 / weights) : positions[v];
+            });
+
+        std::copy(std::begin(next), std::end(next), std::begin(positions));
+
+        checkpoint(iteration + 1);
+    }
+}
+
+// A connected component, with its own (local) adjacency.
+struct component
+{
+    std::vector< std::size_t > vertices; // ascending, local to global ids
+    weighted_adjacency adjacency;        // over the local ids
+
+    auto size() const -> std::size_t { return vertices.size(); }
+};
+
+// The connected components of an adjacency, over its weighted edges only, (as
+// these are the only ones with a length), in O(V + E).
+// Ordered by their first vertex.
+inline auto make_components(const weighted_adjacency& adjacency)
+    -> std::vector< component >
+{
+    constexpr auto unvisited = std::numeric_limits< std::size_t >::max();
+
+    const auto n = adjacency.num_vertices();
+
+    auto component_of = std::vector< std::size_t >(n, unvisited);
+    auto local = std::vector< std::size_t >(n);
+    auto res = std::vector< component >();
+    auto stack = std::vector< std::size_t >();
+
+    for (std::size_t root = 0; root < n; ++root)
+    {
+        if (component_of[root] != unvisited)
+            continue;
+
+        component_of[root] = res.size();
+        stack.push_back(root);
+
+        while (!stack.empty())
+        {
+            const auto u = stack.back();
+            stack.pop_back();
+
+            for (const auto& [v, w] : adjacency.neighbours_of(u))
+                if (w > 0 and component_of[v] == unvisited)
+                {
+                    component_of[v] = component_of[root];
+                    stack.push_back(v);
+                }
+        }
+
+        res.emplace_back();
+    }
+
+    for (std::size_t v = 0; v < n; ++v)
+    {
+        auto& c = res[component_of[v]];
+        local[v] = c.vertices.size();
+        c.vertices.push_back(v);
+    }
+
+    for (auto& c : res)
+    {
+        auto& adj = c.adjacency;
+        adj.offsets.reserve(c.size() + 1);
+        adj.offsets.push_back(0);
+
+        for (auto u : c.vertices)
+        {
+            for (const auto& [v, w] : adjacency.neighbours_of(u))
+                if (w > 0)
+                    adj.neighbours.push_back({ local[v], w });
+
+            adj.offsets.push_back(adj.neighbours.size());
+        }
+    }
+
+    return res;
+}
+
+// Uniformly scales a set of positions, so that the pivot distances of each
+// component fit its graph (pivot) distances, in the least squares sense, in
+// O(V * pivots).
+inline auto fit_to_distances(
+    std::span< vector3 > positions,
+    std::span< const component > components,
+    std::span< const pivot_distances > dists) -> void
+{
+    assert(components.size() == dists.size());
+
+    auto products = 0.0;
+    auto squares = 0.0;
+
+    for (std::size_t c = 0; c < components.size(); ++c)
+    {
+        const auto& vertices = components[c].vertices;
+
+        for (std::size_t p = 0; p < dists[c].pivots.size(); ++p)
+        {
+            const auto& pivot = positions[vertices[dists[c].pivots[p]]];
+
+            for (std::size_t v = 0; v < vertices.size(); ++v)
+            {
+                const auto delta = positions[vertices[v]] - pivot;
+                const auto d = std::sqrt(dot(delta, delta));
+                products += d * dists[c].at(p, v);
+                squares += d * d;
+            }
+        }
+    }
+
+    if (squares == 0)
+        return;
+
+    for (auto& pos : positions)
+        pos = pos * (products / squares);
+}
+
+// Packs a set of component layouts, (in graph distance units), next to each
+// other so that they do not overlap, at least gap apart.
+// Each component is bounded by a cube, and the cubes are placed, largest
+// first, in rows, rows in layers, and layers on top of each other, within a
+// roughly cubic volume, in O(C log C + V).
+inline auto pack_components(
+    std::span< const component > components,
+    std::span< const std::vector< vector3 > > layouts,
+    std::size_t num_vertices,
+    double gap) -> std::vector< vector3 >
+{
+    assert(components.size() == layouts.size());
+
+    const auto num_components = components.size();
+
+    auto centers = std::vector< vector3 >(num_components, vector3 { 0, 0, 0 });
+    auto sides = std::vector< double >(num_components);
+
+    for (std::size_t c = 0; c < num_components; ++c)
+    {
+        const auto& lay = layouts[c];
+
+        for (const auto& p : lay)
+            centers[c] = centers[c] + p * (1 / double(lay.size()));
+
+        auto radius = 0.0;
+        for (const auto& p : lay)
+        {
+            const auto delta = p - centers[c];
+            radius = std::max(radius, std::sqrt(dot(delta, delta)));
+        }
+
+        sides[c] = 2 * radius + gap;
+    }
+
+    auto order = std::vector< std::size_t >(num_components);
+    std::iota(std::begin(order), std::end(order), 0);
+    std::stable_sort(
+        std::begin(order),
+        std::end(order),
+        [&sides](auto lhs, auto rhs) { return sides[lhs] > sides[rhs]; });
+
+    auto volume = 0.0;
+    for (auto side : sides)
+        volume += side * side * side;
+
+    const auto width = std::max(
+        num_components > 0 ? sides[order.front()] : 0, std::cbrt(volume));
+
+    auto res = std::vector< vector3 >(num_vertices, vector3 { 0, 0, 0 });
+
+    auto x = 0.0, y = 0.0, z = 0.0;
+    auto row_depth = 0.0, layer_height = 0.0;
+
+    for (auto c : order)
+    {
+        const auto side = sides[c];
+
+        if (x > 0 and x + side > width) // next row
+        {
+            x = 0;
+            y += row_depth;
+            row_depth = 0;
+        }
+
+        if (y > 0 and y + side > width) // next layer
+        {
+            y = 0;
+            z += layer_height;
+            layer_height = 0;
+        }
+
+        const auto offset
+            = vector3 { x + side / 2, y + side / 2, z + side / 2 } - centers[c];
+
+        for (std::size_t v = 0; v < components[c].size(); ++v)
+            res[components[c].vertices[v]] = layouts[c][v] + offset;
+
+        x += side;
+        row_depth = std::max(row_depth, side);
+        layer_height = std::max(layer_height, side);
+    }
+
+    return res;
+}
+
+// Lays out each connected component on its own, through pivot mds and sparse
+// stress majorization, and packs the results, in graph distance units, in
+// O(pivots * (V + E) log V + V * pivots^2 + iterations * (V * pivots + E)).
+// Calls the checkpoint with the (approximate) fraction of the work done,
+// within each stage.
+// NOTE: Unreachable vertices share their distances from every pivot, and
+// would otherwise collapse to a single point.
+template < typename Checkpoint = no_checkpoint >
+inline auto pivot_mds_components(
+    const weighted_adjacency& adjacency,
+    std::size_t num_pivots,
+    int stress_iterations,
+    Checkpoint checkpoint = {}) -> std::vector< vector3 >
+{
+    constexpr auto gap = 1.0; // the length of the heaviest edge
+
+    const auto n = adjacency.num_vertices();
+    const auto components = make_components(adjacency);
+
+    auto layouts = std::vector< std::vector< vector3 > >();
+    layouts.reserve(components.size());
+
+    auto done = 0.0;
+
+    for (const auto& c : components)
+    {
+        const auto progress = [&](double fraction)
+        { checkpoint((done + fraction * c.size()) / n); };
+
+        if (c.size() == 1)
+        {
+            layouts.push_back({ vector3 { 0, 0, 0 } });
+        }
+        else
+        {
+            const auto dists = make_pivot_distances(
+                c.adjacency,
+                num_pivots,
+                [&](auto p)
+                { progress(0.5 * p / std::min(num_pivots, c.size())); });
+
+            auto& lay = layouts.emplace_back(pivot_mds(dists));
+
+            sparse_stress_majorization(
+                lay,
+                c.adjacency,
+                dists,
+                stress_iterations,
+                [&](auto iteration)
+                { progress(0.5 + 0.5 * iteration / stress_iterations); });
+        }
+
+        done += c.size();
+        checkpoint(done / n);
+    }
+
+    return pack_components(components, layouts, n, gap);
+}
+
+// Refines a set of positions through sparse stress majorization, over each
+// connected component, in O(pivots * (V + E) log V + iterations * (V * pivots
+// + E)).
+// The positions are scaled to graph distance units.
+// Calls the checkpoint with the (approximate) fraction of the work done.
+template < typename Checkpoint = no_checkpoint >
+inline auto refine_components(
+    std::span< vector3 > positions,
+    const weighted_adjacency& adjacency,
+    std::size_t num_pivots,
+    int iterations,
+    Checkpoint checkpoint = {}) -> void
+{
+    assert(positions.size() == adjacency.num_vertices());
+
+    const auto n = adjacency.num_vertices();
+    const auto components = make_components(adjacency);
+
+    auto dists = std::vector< pivot_distances >();
+    dists.reserve(components.size());
+
+    auto done = 0.0;
+
+    for (const auto& c : components)
+    {
+        dists.push_back(make_pivot_distances(
+            c.adjacency,
+            num_pivots,
+            [&](auto p) {
+                checkpoint(
+                    (done + 0.5 * c.size() * p / std::min(num_pivots, c.size()))
+                    / n);
+            }));
+
+        done += 0.5 * c.size();
+    }
+
+    fit_to_distances(positions, components, dists);
+
+    auto local = std::vector< vector3 >();
+
+    for (std::size_t c = 0; c < components.size(); ++c)
+    {
+        const auto& vertices = components[c].vertices;
+
+        if (vertices.size() > 1)
+        {
+            local.clear();
+            for (auto v : vertices)
+                local.push_back(positions[v]);
+
+            sparse_stress_majorization(
+                local,
+                components[c].adjacency,
+                dists[c],
+                iterations,
+                [&](auto iteration) {
+                    checkpoint(
+                        (done + 0.5 * vertices.size() * iteration / iterations)
+                        / n);
+                });
+
+            for (std::size_t v = 0; v < vertices.size(); ++v)
+                positions[vertices[v]] = local[v];
+        }
+
+        done += 0.5 * vertices.size();
+    }
+}
+
+// Centers a set of positions at the space, and scales them so that the
+// farthest one lies at the space boundary, in O(V).
+inline auto fit_to_space(std::span< vector3 > positions, const topology& space)
+    -> void
+{
+    const auto n = positions.size();
+
+    auto center = vector3 { 0, 0, 0 };
+    for (const auto& p : positions)
+        for (auto axis = 0; axis < 3; ++axis)
+            center[axis] += p[axis] / double(n);
+
+    auto radius = 0.0;
+    for (const auto& p : positions)
+    {
+        const auto delta = p - center;
+        radius = std::max(radius, std::sqrt(dot(delta, delta)));
+    }
+
+    const auto factor = radius > 0 ? space.scale() / radius : 0;
+
+    for (auto& p : positions)
+        p = bound(space, (p - center) * factor);
+}
+
+} // namespace layout::detail
+
+#endif // LAYOUT_DETAIL_PIVOT_MDS_HPP
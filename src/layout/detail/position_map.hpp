@@ -4,6 +4,7 @@
 #ifndef LAYOUT_DETAIL_POSITION_MAP_HPP
 #define LAYOUT_DETAIL_POSITION_MAP_HPP
 
+#include <cassert>  // for assert
 #include <concepts> // for floating_point
 
 namespace layout::detail
@@ -28,8 +29,8 @@ public:
 
     auto operator()(vertex_type v) const -> position_type
     {
-        const auto& l = m_backend->get_layout();
-        return { .x = l.x(v), .y = l.y(v), .z = l.z(v) };
+        const auto& p = m_backend->get_layout().positions()[v];
+        return { .x = p[0], .y = p[1], .z = p[2] };
     }
 
 private:
@@ -50,7 +51,8 @@ public:
     auto operator()(Vertex v) const -> position_type
     {
         assert(m_lay);
-        return { .x = m_lay->x(v), .y = m_lay->y(v), .z = m_lay->z(v) };
+        const auto& p = m_lay->positions()[v];
+        return { .x = p[0], .y = p[1], .z = p[2] };
     }
 
 private:
@@ -4,81 +4,81 @@
 #ifndef LAYOUT_DETAIL_UNTANGLE_LAYOUT_HPP
 #define LAYOUT_DETAIL_UNTANGLE_LAYOUT_HPP
 
-#include "layout/layout.hpp"  // for layout
-#include "misc/algorithm.hpp" // for find_assoc_index
+#include "layout/layout.hpp" // for layout
+#include "misc/parallel.hpp" // for parallel_for
 
-#include <array>                          // for array
 #include <boost/graph/adjacency_list.hpp> // for vertices, edges, etc
 #include <boost/graph/graph_traits.hpp>   // for graph_traits
 #include <cassert>                        // for assert
+#include <cstddef>                        // for size_t
 #include <memory>                         // for unique_ptr
-#include <type_traits>   // for is_convertible_v, is_default_constructible_v
-#include <unordered_map> // for unordered_map
-#include <unordered_set> // for unordered_set
+#include <span>                           // for span
+#include <unordered_map>                  // for unordered_map
+#include <vector>                         // for vector
 
 namespace layout::detail
 {
 
-template < typename Set >
-inline auto cardinality(const Set& set, const typename Set::key_type& key)
+// Dense cluster indices, in [0, num_clusters), in order of first appearance.
+struct cluster_indices
 {
-    return misc::find_assoc_index(set, key);
-}
+    std::vector< std::size_t > of_vertex; // vertex indexed
+    std::size_t num_clusters;
+};
 
+// Maps each vertex cluster to a dense index, in O(V).
 template < typename Graph, typename ClusterMap >
-inline auto make_clusters_set(const Graph& g, ClusterMap vertex_cluster)
+auto make_cluster_indices(const Graph& g, ClusterMap vertex_cluster)
+    -> cluster_indices
 {
     using property_traits = boost::property_traits< ClusterMap >;
     using cluster_type = typename property_traits::value_type;
-    using set_type = std::unordered_set< cluster_type >;
+    using index_type = std::unordered_map< cluster_type, std::size_t >;
+
+    auto res = cluster_indices { .of_vertex = std::vector< std::size_t >(
+                                     boost::num_vertices(g)),
+                                 .num_clusters = 0 };
 
-    set_type clusters;
+    auto index = index_type();
     for (auto v : boost::make_iterator_range(boost::vertices(g)))
-        clusters.insert(boost::get(vertex_cluster, v));
+    {
+        assert(static_cast< std::size_t >(v) < res.of_vertex.size());
 
-    return clusters;
+        const auto [iter, inserted] = index.try_emplace(
+            boost::get(vertex_cluster, v), index.size());
+        res.of_vertex[v] = iter->second;
+    }
+
+    res.num_clusters = index.size();
+    return res;
 }
 
-template < typename Graph, typename ClusterMap, typename ClusterSet >
-auto make_induced_graph(
-    const Graph& g,
-    ClusterMap vertex_cluster,
-    const ClusterSet& clusters)
+// The graph of the clusters, where each cluster index is a vertex, in O(V + E).
+template < typename Graph >
+auto make_induced_graph(const Graph& g, const cluster_indices& indices)
 {
-    using graph_traits = boost::graph_traits< Graph >;
-    using vertex_type [[maybe_unused]] =
-        typename graph_traits::vertex_descriptor;
-    using property_traits = boost::property_traits< ClusterMap >;
-    using cluster_type = typename property_traits::value_type;
-
-    static_assert(std::is_convertible_v< cluster_type, vertex_type >);
-    static_assert(std::is_convertible_v< vertex_type, cluster_type >);
-
     Graph induced;
 
     // Build vertices.
-    for (auto c [[maybe_unused]] : clusters)
+    for (std::size_t c = 0; c < indices.num_clusters; ++c)
     {
         [[maybe_unused]] const auto v = boost::add_vertex(induced);
-        assert(cardinality(clusters, c) == v); // our invariant
+        assert(static_cast< std::size_t >(v) == c); // our invariant
     }
 
     // Build edges.
     // Really only adding these for the layout algorithm later.
     for (auto e : boost::make_iterator_range(boost::edges(g)))
     {
-        const auto src_c = boost::get(vertex_cluster, boost::source(e, g));
-        const auto trgt_c = boost::get(vertex_cluster, boost::target(e, g));
+        const auto src_c = indices.of_vertex[boost::source(e, g)];
+        const auto trgt_c = indices.of_vertex[boost::target(e, g)];
 
         const bool between_clusters = (src_c != trgt_c);
         if (between_clusters)
-            boost::add_edge(
-                cardinality(clusters, src_c),
-                cardinality(clusters, trgt_c),
-                induced);
+            boost::add_edge(src_c, trgt_c, induced);
     }
 
-    assert(boost::num_vertices(induced) == clusters.size());
+    assert(boost::num_vertices(induced) == indices.num_clusters);
     return induced;
 }
 
@@ -94,8 +94,13 @@ public:
     using graph_type = typename base::graph_type;
     using vertex_type = typename base::vertex_type;
     using coord_type = typename base::coord_type;
+    using point_type = typename base::position_type;
+
+    explicit mutable_layout(std::size_t num_vertices = 0)
+    {
+        this->mutable_positions().resize(num_vertices);
+    }
 
-    mutable_layout() = default;
     ~mutable_layout() override = default;
 
     auto id() const -> id_type override
@@ -104,30 +109,20 @@ public:
         return "";
     }
 
-    auto x(vertex_type v) const -> coord_type override
-    {
-        assert(m_map.contains(v));
-        return m_map.at(v)[0];
-    }
-
-    auto x(vertex_type v) -> coord_type& { return m_map[v][0]; }
-
-    auto y(vertex_type v) const -> coord_type override
-    {
-        assert(m_map.contains(v));
-        return m_map.at(v)[1];
-    }
+    using base::x;
+    using base::y;
+    using base::z;
 
-    auto y(vertex_type v) -> coord_type& { return m_map[v][1]; }
+    auto x(vertex_type v) -> coord_type& { return position(v)[0]; }
+    auto y(vertex_type v) -> coord_type& { return position(v)[1]; }
+    auto z(vertex_type v) -> coord_type& { return position(v)[2]; }
 
-    auto z(vertex_type v) const -> coord_type override
+    // One (mutable) position per vertex.
+    auto positions_span() -> std::span< point_type >
     {
-        assert(m_map.contains(v));
-        return m_map.at(v)[2];
+        return this->mutable_positions();
     }
 
-    auto z(vertex_type v) -> coord_type& { return m_map[v][2]; }
-
     auto clone() const -> std::unique_ptr< base > override
     {
         assert(false && "don't treat this as a plugged in type");
@@ -135,46 +130,44 @@ public:
     }
 
 private:
-    using point_type = std::array< coord_type, 3 >;
-    using storage = std::unordered_map< vertex_type, point_type >;
-
-    storage m_map;
+    auto position(vertex_type v) -> point_type&
+    {
+        assert(v < this->mutable_positions().size());
+        return this->mutable_positions()[v];
+    }
 };
 
-template < typename Graph, typename ClusterMap, typename ClusterSet >
+// Offsets each vertex position by the position of its cluster, in O(V),
+// computed on all hardware threads.
+// Reads & writes the (contiguous) positions in a single linear pass.
+template < typename Graph >
 auto make_offsetted_layout(
     const Graph& g,
-    ClusterMap vertex_cluster,
-    const ClusterSet& set,
+    const cluster_indices& indices,
     const layout< Graph >& induced,
     const layout< Graph >& initial) -> std::unique_ptr< layout< Graph > >
 {
-    using graph_traits = boost::graph_traits< Graph >;
-    using vertex_type [[maybe_unused]] =
-        typename graph_traits::vertex_descriptor;
-    using property_traits = boost::property_traits< ClusterMap >;
-    using cluster_type = typename property_traits::value_type;
     using derived_type = mutable_layout< Graph >;
 
-    static_assert(std::is_convertible_v< cluster_type, vertex_type >);
-    static_assert(std::is_convertible_v< vertex_type, cluster_type >);
-    static_assert(std::is_default_constructible_v< derived_type >);
+    const auto n = boost::num_vertices(g);
+    const auto centers = induced.positions();
+    const auto in = initial.positions();
 
-    auto res = std::make_unique< derived_type >();
-    for (auto v : boost::make_iterator_range(boost::vertices(g)))
-    {
-        // NOTE: we use the cardinality of a cluster on the set to find the
-        // cluster's vertex descriptor in the induced graph.
-        const auto c = boost::get(vertex_cluster, v);
-        const auto vc = cardinality(set, c);
+    assert(centers.size() == indices.num_clusters);
+    assert(in.size() == n);
 
-        static_assert(std::is_convertible_v< decltype(vc), vertex_type >);
-        static_assert(std::is_convertible_v< vertex_type, decltype(vc) >);
+    auto res = std::make_unique< derived_type >(n);
 
-        res->x(v) = initial.x(v) + induced.x(vc);
-        res->y(v) = initial.y(v) + induced.y(vc);
-        res->z(v) = initial.z(v) + induced.z(vc);
-    }
+    misc::parallel_for(
+        std::size_t(0),
+        n,
+        [&indices, centers, in, out = res->positions_span()](auto i)
+        {
+            const auto& p = in[i];
+            const auto& center = centers[indices.of_vertex[i]];
+
+            out[i] = { p[0] + center[0], p[1] + center[1], p[2] + center[2] };
+        });
 
     return res;
 }
@@ -0,0 +1,195 @@
+// Contains a 3D force directed layout class, in Fruchterman-Reingold style.
+// Soultatos Stefanos 2022
+
+#ifndef LAYOUT_FRUCHTERMAN_REINGOLD_LAYOUT_HPP
+#define LAYOUT_FRUCHTERMAN_REINGOLD_LAYOUT_HPP
+
+#include "detail/force_directed.hpp" // for force_directed_step
+#include "layout.hpp"                // for layout
+#include "misc/job.hpp"              // for job_token, foreground_job
+#include "plugin.hpp"                // for fruchterman_reingold_id
+#include "topology.hpp"              // for topology
+#include "visit_topology.hpp"        // for visit_topology
+
+#include <boost/graph/adjacency_list.hpp> // for num_vertices
+#include <cassert>                        // for assert
+
+namespace layout
+{
+
+/***********************************************************
+ * Fruchterman Reingold Layout                             *
+ ***********************************************************/
+
+// Assigns a position, at a 3d space, to each graph vertex.
+// Models the graph as a physical system, where all vertices repel each
+// other, while the edges attract their endpoints, in respect to their weight.
+//
+// Implementation details: Uses the Fruchterman-Reingold force directed
+// algorithm, with a Barnes-Hut octree approximation for the repulsive forces,
+// (O((V log V + E) * iterations)), computed on all hardware threads.
+// see
+// https://en.wikipedia.org/wiki/Force-directed_graph_drawing
+//
+// Can be warm started from a set of initial positions, in which case only a
+// few, low temperature, iterations are run, so that the layout is refined
+// rather than recomputed.
+//
+// NOTE: Reports its progress, and can be cancelled in between iterations
+// (throws misc::job_cancelled).
+
+template < typename Graph >
+class fruchterman_reingold_layout : public layout< Graph >
+{
+    BOOST_CONCEPT_ASSERT((boost::GraphConcept< Graph >));
+
+    using base = layout< Graph >;
+    using self = fruchterman_reingold_layout< Graph >;
+
+public:
+    using id_type = typename base::id_type;
+    using graph_type = typename base::graph_type;
+    using vertex_type = typename base::vertex_type;
+    using coord_type = typename base::coord_type;
+    using positions_view = typename base::positions_view;
+
+    using job_token = misc::job_token;
+
+    static constexpr auto num_iterations = 100;
+    static constexpr auto theta = 1.0; // Barnes-Hut accuracy
+
+    template < typename WeightMap >
+    fruchterman_reingold_layout(
+        const graph_type& g,
+        const topology& space,
+        WeightMap edge_weight,
+        job_token& token = misc::foreground_job());
+
+    // Refines a set of initial positions, (one per vertex).
+    template < typename WeightMap >
+    fruchterman_reingold_layout(
+        const graph_type& g,
+        const topology& space,
+        WeightMap edge_weight,
+        positions_view initial,
+        int iterations,
+        job_token& token = misc::foreground_job());
+
+    ~fruchterman_reingold_layout() override = default;
+
+    auto id() const -> id_type override { return fruchterman_reingold_id; }
+
+    auto clone() const -> std::unique_ptr< base > override;
+
+private:
+    template < typename WeightMap >
+    auto iterate(
+        const graph_type& g,
+        const topology& space,
+        WeightMap edge_weight,
+        int iterations,
+        double initial_temperature,
+        job_token& token) -> void;
+};
+
+/***********************************************************
+ * Definitions                                             *
+ ***********************************************************/
+
+template < typename Graph >
+template < typename WeightMap >
+inline fruchterman_reingold_layout< Graph >::fruchterman_reingold_layout(
+    const graph_type& g,
+    const topology& space,
+    WeightMap edge_weight,
+    job_token& token)
+{
+    BOOST_CONCEPT_ASSERT(
+        (boost::ReadablePropertyMapConcept<
+            WeightMap,
+            typename boost::graph_traits< graph_type >::edge_descriptor >));
+
+    auto& positions = this->mutable_positions();
+    positions.resize(boost::num_vertices(g));
+
+    for (auto& p : positions)
+    {
+        const auto point = space.random_point();
+        p = { point[0], point[1], point[2] };
+    }
+
+    iterate(g, space, edge_weight, num_iterations, space.scale() / 10, token);
+}
+
+template < typename Graph >
+template < typename WeightMap >
+inline fruchterman_reingold_layout< Graph >::fruchterman_reingold_layout(
+    const graph_type& g,
+    const topology& space,
+    WeightMap edge_weight,
+    positions_view initial,
+    int iterations,
+    job_token& token)
+{
+    BOOST_CONCEPT_ASSERT(
+        (boost::ReadablePropertyMapConcept<
+            WeightMap,
+            typename boost::graph_traits< graph_type >::edge_descriptor >));
+
+    assert(initial.size() == boost::num_vertices(g));
+    assert(iterations >= 0);
+
+    this->mutable_positions() = detail::bounded_positions(initial, space);
+
+    const auto k = detail::ideal_edge_length(boost::num_vertices(g), space);
+    iterate(g, space, edge_weight, iterations, k, token);
+}
+
+template < typename Graph >
+template < typename WeightMap >
+inline auto fruchterman_reingold_layout< Graph >::iterate(
+    const graph_type& g,
+    const topology& space,
+    WeightMap edge_weight,
+    int iterations,
+    double initial_temperature,
+    job_token& token) -> void
+{
+    auto& positions = this->mutable_positions();
+
+    if (positions.empty() or space.scale() <= 0)
+    {
+        token.checkpoint(1);
+        return;
+    }
+
+    const auto edges = detail::make_weighted_edges(g, edge_weight);
+
+    visit_topology(
+        space,
+        [&](const auto& concrete_space)
+        {
+            detail::force_directed_steps(
+                positions,
+                edges,
+                concrete_space,
+                iterations,
+                initial_temperature,
+                theta,
+                [&token, iterations](auto iteration)
+                { token.checkpoint(double(iteration) / iterations); });
+        });
+
+    token.checkpoint(1);
+}
+
+template < typename Graph >
+inline auto fruchterman_reingold_layout< Graph >::clone() const
+    -> std::unique_ptr< base >
+{
+    return std::make_unique< self >(*this);
+}
+
+} // namespace layout
+
+#endif // LAYOUT_FRUCHTERMAN_REINGOLD_LAYOUT_HPP
@@ -4,13 +4,18 @@
 #ifndef LAYOUT_GURSOY_ATUN_LAYOUT_HPP
 #define LAYOUT_GURSOY_ATUN_LAYOUT_HPP
 
-#include "layout.hpp"   // for layout
-#include "plugin.hpp"   // for gursoy_atun_id
-#include "topology.hpp" // for topology
-
-#include <boost/graph/adjacency_list.hpp>     // for vertices
-#include <boost/graph/gursoy_atun_layout.hpp> // for gursoy_atun_layout
-#include <cassert>                            // for assert
+#include "layout.hpp"         // for layout
+#include "misc/job.hpp"       // for job_token, foreground_job
+#include "plugin.hpp"         // for gursoy_atun_id
+#include "topology.hpp"       // for topology
+#include "visit_topology.hpp" // for visit_topology
+
+#include <boost/graph/adjacency_list.hpp>      // for vertices
+#include <boost/graph/gursoy_atun_layout.hpp>  // for gursoy_atun_step
+#include <boost/property_map/property_map.hpp> // for iterator_property_map
+#include <cassert>                             // for assert
+#include <cmath>                               // for sqrt, pow
+#include <vector>                              // for vector
 
 namespace layout
 {
@@ -28,6 +33,14 @@ namespace layout
 // https://www.boost.org/doc/libs/1_79_0/libs/graph_type/doc/gursoy_atun_layout.html
 //
 // Convenience boost adaptor for our architecture, in 3D space.
+//
+// Can be warm started from a set of initial positions, in which case only a
+// few, fine grained, steps are run.
+//
+// Instantiated per (concrete) topology, see visit_topology.
+//
+// NOTE: Runs the algorithm step by step, in order to report its progress, and
+// to be cancelled in between steps (throws misc::job_cancelled).
 
 template < typename Graph >
 class gursoy_atun_layout : public layout< Graph >
@@ -42,25 +55,32 @@ public:
     using graph_type = typename base::graph_type;
     using vertex_type = typename base::vertex_type;
     using coord_type = typename base::coord_type;
+    using positions_view = typename base::positions_view;
+
+    using job_token = misc::job_token;
 
     template < typename WeightMap >
-    gursoy_atun_layout(const graph_type& g, const topology& space, WeightMap);
+    gursoy_atun_layout(
+        const graph_type& g,
+        const topology& space,
+        WeightMap,
+        job_token& token = misc::foreground_job());
+
+    // Refines a set of initial positions, (one per vertex).
+    template < typename WeightMap >
+    gursoy_atun_layout(
+        const graph_type& g,
+        const topology& space,
+        WeightMap edge_weight,
+        positions_view initial,
+        int iterations,
+        job_token& token = misc::foreground_job());
 
     ~gursoy_atun_layout() override = default;
 
     auto id() const -> id_type override { return gursoy_atun_id; }
 
-    auto x(vertex_type v) const -> coord_type override;
-    auto y(vertex_type v) const -> coord_type override;
-    auto z(vertex_type v) const -> coord_type override;
-
     auto clone() const -> std::unique_ptr< base > override;
-
-private:
-    using position = topology::point_type;
-    using position_map = std::unordered_map< vertex_type, position >;
-
-    position_map m_map;
 };
 
 /***********************************************************
@@ -72,44 +92,124 @@ template < typename WeightMap >
 inline gursoy_atun_layout< Graph >::gursoy_atun_layout(
     const graph_type& g,
     const topology& space,
-    WeightMap edge_weight)
+    WeightMap edge_weight,
+    job_token& token)
 {
     BOOST_CONCEPT_ASSERT(
         (boost::ReadablePropertyMapConcept<
             WeightMap,
             typename boost::graph_traits< graph_type >::edge_descriptor >));
 
-    boost::gursoy_atun_layout(
-        g,
-        space,
-        boost::make_assoc_property_map(m_map),
-        boost::weight_map(edge_weight));
+    // Same parameters as the boost::gursoy_atun_layout defaults.
+    const auto nsteps = static_cast< int >(boost::num_vertices(g));
+    const auto diameter_initial = std::sqrt(double(boost::num_vertices(g)));
+    const auto diameter_final = 1.0;
+    const auto learning_constant_initial = 0.8;
+    const auto learning_constant_final = 0.2;
 
-    assert(std::all_of(
-        boost::vertices(g).first,
-        boost::vertices(g).second,
-        [this](auto v) { return m_map.contains(v); }));
-}
+    const auto diameter_ratio = diameter_final / diameter_initial;
+    const auto learning_constant_ratio
+        = learning_constant_final / learning_constant_initial;
 
-template < typename Graph >
-inline auto gursoy_atun_layout< Graph >::x(vertex_type v) const -> coord_type
-{
-    assert(m_map.contains(v));
-    return m_map.at(v)[0];
-}
+    using point_type = topology::point_type;
 
-template < typename Graph >
-inline auto gursoy_atun_layout< Graph >::y(vertex_type v) const -> coord_type
-{
-    assert(m_map.contains(v));
-    return m_map.at(v)[1];
+    auto points = std::vector< point_type >(boost::num_vertices(g));
+    auto position = boost::make_iterator_property_map(
+        std::begin(points), boost::get(boost::vertex_index, g));
+
+    for (auto v : boost::make_iterator_range(boost::vertices(g)))
+        boost::put(position, v, space.random_point());
+
+    visit_topology(
+        space,
+        [&](const auto& concrete_space)
+        {
+            for (auto round = 0; round < nsteps; ++round)
+            {
+                token.checkpoint(double(round) / nsteps);
+
+                const auto part_done
+                    = nsteps > 1 ? double(round) / (nsteps - 1) : 0.0;
+                const auto diameter = static_cast< int >(
+                    diameter_initial * std::pow(diameter_ratio, part_done));
+                const auto learning_constant = learning_constant_initial
+                    * std::pow(learning_constant_ratio, part_done);
+
+                boost::gursoy_atun_step(
+                    g,
+                    concrete_space,
+                    position,
+                    diameter,
+                    learning_constant,
+                    boost::get(boost::vertex_index, g),
+                    edge_weight);
+            }
+        });
+
+    token.checkpoint(1);
+
+    this->set_positions(points);
 }
 
 template < typename Graph >
-inline auto gursoy_atun_layout< Graph >::z(vertex_type v) const -> coord_type
+template < typename WeightMap >
+inline gursoy_atun_layout< Graph >::gursoy_atun_layout(
+    const graph_type& g,
+    const topology& space,
+    WeightMap edge_weight,
+    positions_view initial,
+    int iterations,
+    job_token& token)
 {
-    assert(m_map.contains(v));
-    return m_map.at(v)[2];
+    BOOST_CONCEPT_ASSERT(
+        (boost::ReadablePropertyMapConcept<
+            WeightMap,
+            typename boost::graph_traits< graph_type >::edge_descriptor >));
+
+    assert(initial.size() == boost::num_vertices(g));
+    assert(iterations >= 0);
+
+    // Same as the final parameters of the boost::gursoy_atun_layout defaults.
+    const auto diameter = 1;
+    const auto learning_constant = 0.2;
+
+    using point_type = topology::point_type;
+
+    auto points = std::vector< point_type >(boost::num_vertices(g));
+    auto position = boost::make_iterator_property_map(
+        std::begin(points), boost::get(boost::vertex_index, g));
+
+    for (auto v : boost::make_iterator_range(boost::vertices(g)))
+    {
+        auto point = point_type();
+        point[0] = initial[v][0];
+        point[1] = initial[v][1];
+        point[2] = initial[v][2];
+        boost::put(position, v, space.bound(point));
+    }
+
+    visit_topology(
+        space,
+        [&](const auto& concrete_space)
+        {
+            for (auto round = 0; round < iterations; ++round)
+            {
+                token.checkpoint(double(round) / iterations);
+
+                boost::gursoy_atun_step(
+                    g,
+                    concrete_space,
+                    position,
+                    diameter,
+                    learning_constant,
+                    boost::get(boost::vertex_index, g),
+                    edge_weight);
+            }
+        });
+
+    token.checkpoint(1);
+
+    this->set_positions(points);
 }
 
 template < typename Graph >
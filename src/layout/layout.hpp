@@ -4,14 +4,21 @@
 #ifndef LAYOUT_LAYOUT_HPP
 #define LAYOUT_LAYOUT_HPP
 
+#include <array>                          // for array
 #include <boost/graph/graph_concepts.hpp> // for GraphConcept
+#include <cassert>                        // for assert
 #include <memory>                         // for unique_ptr
+#include <span>                           // for span
 #include <string_view>                    // for string_view
+#include <type_traits>                    // for is_integral_v
+#include <vector>                         // for vector
 
 namespace layout
 {
 
 // In 3D space.
+// Stores the vertex positions contiguously, indexed by vertex descriptor, for
+// bulk (linear) access.
 template < typename Graph >
 class layout
 {
@@ -24,6 +31,12 @@ public:
     using graph_type = Graph;
     using vertex_type = typename graph_type::vertex_descriptor;
     using coord_type = double;
+    using position_type = std::array< coord_type, 3 >;
+    using positions_view = std::span< const position_type >;
+
+    static_assert(
+        std::is_integral_v< vertex_type >,
+        "vertex descriptors must be usable as indices");
 
     layout() = default;
     layout(const layout&) = default;
@@ -35,11 +48,39 @@ public:
 
     virtual auto id() const -> id_type = 0;
 
-    virtual auto x(vertex_type v) const -> coord_type = 0;
-    virtual auto y(vertex_type v) const -> coord_type = 0;
-    virtual auto z(vertex_type v) const -> coord_type = 0;
+    virtual auto x(vertex_type v) const -> coord_type { return at(v)[0]; }
+    virtual auto y(vertex_type v) const -> coord_type { return at(v)[1]; }
+    virtual auto z(vertex_type v) const -> coord_type { return at(v)[2]; }
+
+    // Non virtual, one position per vertex.
+    auto positions() const -> positions_view { return m_positions; }
 
     virtual auto clone() const -> std::unique_ptr< self > = 0;
+
+protected:
+    using position_vector = std::vector< position_type >;
+
+    auto at(vertex_type v) const -> const position_type&
+    {
+        assert(static_cast< std::size_t >(v) < m_positions.size());
+        return m_positions[v];
+    }
+
+    auto mutable_positions() -> position_vector& { return m_positions; }
+
+    // Copies a vertex-indexed range of (indexable) 3D points.
+    template < typename Points >
+    auto set_positions(const Points& points) -> void
+    {
+        m_positions.clear();
+        m_positions.reserve(std::size(points));
+
+        for (const auto& p : points)
+            m_positions.push_back({ p[0], p[1], p[2] });
+    }
+
+private:
+    position_vector m_positions;
 };
 
 } // namespace layout
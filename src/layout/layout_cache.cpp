@@ -0,0 +1,103 @@
+#include "layout_cache.hpp"
+
+#include <boost/functional/hash.hpp>
+#include <boost/log/trivial.hpp>
+#include <cassert>
+
+namespace layout
+{
+
+auto hash_value(const layout_cache_key& key) -> std::size_t
+{
+    auto seed = std::size_t(0);
+    boost::hash_combine(seed, key.layout);
+    boost::hash_combine(seed, key.topology);
+    boost::hash_combine(seed, key.scale);
+    boost::hash_combine(seed, key.weights);
+    boost::hash_combine(seed, key.seed);
+    return seed;
+}
+
+layout_cache::layout_cache(budget_type budget) : m_budget { budget }
+{
+}
+
+auto layout_cache::find(const key_type& key) -> const positions_type*
+{
+    const auto iter = m_index.find(key);
+    if (iter == std::end(m_index))
+        return nullptr;
+
+    m_entries.splice(std::begin(m_entries), m_entries, iter->second);
+    assert(iter->second == std::begin(m_entries));
+
+    return &iter->second->second;
+}
+
+auto layout_cache::insert(const key_type& key, positions_type positions)
+    -> void
+{
+    erase(key);
+
+    const auto bytes = footprint(positions);
+    if (bytes > budget())
+    {
+        BOOST_LOG_TRIVIAL(debug) << "layout too large to be cached";
+        return;
+    }
+
+    m_entries.emplace_front(key, std::move(positions));
+    m_index.emplace(key, std::begin(m_entries));
+    m_usage += bytes;
+
+    evict();
+
+    assert(m_entries.size() == m_index.size());
+    assert(usage() <= budget());
+}
+
+auto layout_cache::erase(const key_type& key) -> void
+{
+    const auto iter = m_index.find(key);
+    if (iter == std::end(m_index))
+        return;
+
+    m_usage -= footprint(iter->second->second);
+    m_entries.erase(iter->second);
+    m_index.erase(iter);
+}
+
+auto layout_cache::clear() -> void
+{
+    m_entries.clear();
+    m_index.clear();
+    m_usage = 0;
+}
+
+auto layout_cache::set_budget(budget_type budget) -> void
+{
+    m_budget = budget;
+    evict();
+}
+
+auto layout_cache::footprint(const positions_type& positions) -> budget_type
+{
+    return positions.size() * sizeof(position_type);
+}
+
+auto layout_cache::evict() -> void
+{
+    while (usage() > budget())
+    {
+        assert(!m_entries.empty());
+
+        const auto& [key, positions] = m_entries.back();
+        m_usage -= footprint(positions);
+        m_index.erase(key);
+        m_entries.pop_back();
+
+        BOOST_LOG_TRIVIAL(debug) << "evicted cached layout";
+    }
+}
+
+} // namespace layout
@@ -0,0 +1,107 @@
+// Contains a bounded, least recently used, cache of computed layouts.
+// Soultatos Stefanos 2022
+
+#ifndef LAYOUT_LAYOUT_CACHE_HPP
+#define LAYOUT_LAYOUT_CACHE_HPP
+
+#include "misc/random.hpp" // for seed_type
+
+#include <array>         // for array
+#include <cstddef>       // for size_t
+#include <list>          // for list
+#include <string_view>   // for string_view
+#include <unordered_map> // for unordered_map
+#include <utility>       // for pair
+#include <vector>        // for vector
+
+namespace layout
+{
+
+/***********************************************************
+ * Layout Cache Key                                        *
+ ***********************************************************/
+
+// The inputs of a layout computation.
+// NOTE: Refers to the (static) plugin ids.
+struct layout_cache_key
+{
+    using id_type = std::string_view;
+    using scale_type = double;
+    using hash_type = std::size_t;
+    using seed_type = misc::seed_type;
+
+    id_type layout;
+    id_type topology;
+    scale_type scale;
+    hash_type weights; // hash of the edge weights
+    seed_type seed { misc::default_seed };
+
+    auto operator==(const layout_cache_key&) const -> bool = default;
+    auto operator!=(const layout_cache_key&) const -> bool = default;
+};
+
+auto hash_value(const layout_cache_key& key) -> std::size_t;
+
+/***********************************************************
+ * Layout Cache                                            *
+ ***********************************************************/
+
+// Maps layout computation inputs to their computed (vertex-indexed) positions.
+// Evicts the least recently used positions, in order to stay within a memory
+// budget, (only the positions are accounted for).
+class layout_cache
+{
+public:
+    using key_type = layout_cache_key;
+    using position_type = std::array< double, 3 >;
+    using positions_type = std::vector< position_type >;
+    using budget_type = std::size_t; // in bytes
+    using size_type = std::size_t;
+
+    explicit layout_cache(budget_type budget = 0);
+
+    auto budget() const -> budget_type { return m_budget; }
+    auto usage() const -> budget_type { return m_usage; }
+    auto size() const -> size_type { return m_entries.size(); }
+    auto empty() const -> bool { return m_entries.empty(); }
+
+    // Marks the found positions as the most recently used ones.
+    // Returns nullptr if the positions are not cached.
+    auto find(const key_type& key) -> const positions_type*;
+
+    // Replaces any previously cached positions of the key.
+    // NOTE: Positions larger than the budget are not cached.
+    auto insert(const key_type& key, positions_type positions) -> void;
+
+    auto erase(const key_type& key) -> void;
+    auto clear() -> void;
+
+    auto set_budget(budget_type budget) -> void;
+
+private:
+    struct key_hash
+    {
+        auto operator()(const key_type& key) const -> std::size_t
+        {
+            return hash_value(key);
+        }
+    };
+
+    using entry = std::pair< key_type, positions_type >;
+    using entries = std::list< entry >; // from most to least recently used
+    using index = std::unordered_map< key_type, entries::iterator, key_hash >;
+
+    static auto footprint(const positions_type& positions) -> budget_type;
+
+    auto evict() -> void;
+
+    budget_type m_budget;
+    budget_type m_usage { 0 };
+
+    entries m_entries;
+    index m_index;
+};
+
+} // namespace layout
+
+#endif // LAYOUT_LAYOUT_CACHE_HPP
@@ -4,11 +4,15 @@
 #ifndef LAYOUT_LAYOUT_FACTORY_HPP
 #define LAYOUT_LAYOUT_FACTORY_HPP
 
-#include "gursoy_atun_layout.hpp" // for gursoy_atun_layout
-#include "layout.hpp"             // for layout
-#include "plugin.hpp"             // for id_t
-#include "random_layout.hpp"      // for random_layout
-#include "topology.hpp"           // for topology
+#include "fruchterman_reingold_layout.hpp" // for fruchterman_reingold_layout
+#include "gursoy_atun_layout.hpp"          // for gursoy_atun_layout
+#include "layout.hpp"                      // for layout
+#include "misc/job.hpp"                    // for job_token, foreground_job
+#include "multilevel_layout.hpp"           // for multilevel_layout
+#include "pivot_mds_layout.hpp"            // for pivot_mds_layout
+#include "plugin.hpp"                      // for id_t
+#include "random_layout.hpp"               // for random_layout
+#include "topology.hpp"                    // for topology
 
 #include <boost/log/trivial.hpp> // for BOOST_LOG_TRIVIAL
 #include <cassert>               // for assert
@@ -28,6 +32,8 @@ public:
     using graph_type = Graph;
     using id_type = id_t;
     using pointer = std::unique_ptr< layout< graph_type > >;
+    using positions_view = typename layout< graph_type >::positions_view;
+    using job_token = misc::job_token;
 
     layout_factory(const layout_factory&) = default;
     layout_factory(layout_factory&&) = default;
@@ -40,7 +46,20 @@ public:
         id_type id,
         const graph_type& g,
         const topology& space,
-        WeightMap edge_weight) -> pointer;
+        WeightMap edge_weight,
+        job_token& token = misc::foreground_job()) -> pointer;
+
+    // Warm started, refines a set of initial positions, (one per vertex), for
+    // a number of iterations.
+    template < typename WeightMap >
+    static auto make_layout(
+        id_type id,
+        const graph_type& g,
+        const topology& space,
+        WeightMap edge_weight,
+        positions_view initial,
+        int iterations,
+        job_token& token = misc::foreground_job()) -> pointer;
 
 private:
     layout_factory() = default;
@@ -57,19 +76,89 @@ inline auto layout_factory< Graph >::make_layout(
     id_type id,
     const graph_type& g,
     const topology& space,
-    WeightMap edge_weight) -> pointer
+    WeightMap edge_weight,
+    job_token& token) -> pointer
 {
     using gursoy_atun_type = gursoy_atun_layout< graph_type >;
     using random_type = random_layout< graph_type >;
+    using fruchterman_reingold_type = fruchterman_reingold_layout< graph_type >;
+    using multilevel_type = multilevel_layout< graph_type >;
+    using pivot_mds_type = pivot_mds_layout< graph_type >;
 
     if (id == gursoy_atun_id)
     {
-        return std::make_unique< gursoy_atun_type >(g, space, edge_weight);
+        return std::make_unique< gursoy_atun_type >(
+            g, space, edge_weight, token);
     }
     else if (id == random_id)
     {
         return std::make_unique< random_type >(g, space);
     }
+    else if (id == fruchterman_reingold_id)
+    {
+        return std::make_unique< fruchterman_reingold_type >(
+            g, space, edge_weight, token);
+    }
+    else if (id == multilevel_id)
+    {
+        return std::make_unique< multilevel_type >(
+            g, space, edge_weight, token);
+    }
+    else if (id == pivot_mds_id)
+    {
+        return std::make_unique< pivot_mds_type >(
+            g, space, edge_weight, token);
+    }
+    else
+    {
+        assert(!is_layout_plugged_in(id));
+        BOOST_LOG_TRIVIAL(fatal) << "invalid layout id: " << id;
+        assert(false);
+        return nullptr;
+    }
+}
+
+template < typename Graph >
+template < typename WeightMap >
+inline auto layout_factory< Graph >::make_layout(
+    id_type id,
+    const graph_type& g,
+    const topology& space,
+    WeightMap edge_weight,
+    positions_view initial,
+    int iterations,
+    job_token& token) -> pointer
+{
+    using gursoy_atun_type = gursoy_atun_layout< graph_type >;
+    using random_type = random_layout< graph_type >;
+    using fruchterman_reingold_type = fruchterman_reingold_layout< graph_type >;
+    using multilevel_type = multilevel_layout< graph_type >;
+    using pivot_mds_type = pivot_mds_layout< graph_type >;
+
+    if (id == gursoy_atun_id)
+    {
+        return std::make_unique< gursoy_atun_type >(
+            g, space, edge_weight, initial, iterations, token);
+    }
+    else if (id == random_id)
+    {
+        return std::make_unique< random_type >(g, space, initial);
+    }
+    else if (id == fruchterman_reingold_id)
+    {
+        return std::make_unique< fruchterman_reingold_type >(
+            g, space, edge_weight, initial, iterations, token);
+    }
+    else if (id == multilevel_id)
+    {
+        return std::make_unique< multilevel_type >(
+            g, space, edge_weight, initial, iterations, token);
+    }
+    else if (id == pivot_mds_id)
+    {
+        return std::make_unique< pivot_mds_type >(
+            g, space, edge_weight, initial, iterations, token);
+    }
     else
     {
         assert(!is_layout_plugged_in(id));
@@ -0,0 +1,281 @@
+// Contains a 3D multilevel layout class, for very large graphs.
+// Soultatos Stefanos 2022
+
+#ifndef LAYOUT_MULTILEVEL_LAYOUT_HPP
+#define LAYOUT_MULTILEVEL_LAYOUT_HPP
+
+#include "detail/force_directed.hpp"    // for force_directed_step, bound, etc
+#include "detail/multilevel_layout.hpp" // for match_heavy_edges
+#include "layout.hpp"                   // for layout
+#include "misc/job.hpp"                 // for job_token, foreground_job
+#include "plugin.hpp"                   // for multilevel_id
+#include "topology.hpp"                 // for topology
+#include "visit_topology.hpp"           // for visit_topology
+
+#include <boost/graph/adjacency_list.hpp> // for num_vertices
+#include <cassert>                        // for assert
+#include <cstddef>                        // for size_t
+#include <vector>                         // for vector
+
+namespace layout
+{
+
+/***********************************************************
+ * Multilevel Layout                                       *
+ ***********************************************************/
+
+// Assigns a position, at a 3d space, to each graph vertex.
+// Repeatedly coarsens the graph, by contracting a heavy edge matching, lays
+// out the coarsest graph, and then interpolates and refines the positions
+// back up the hierarchy.
+//
+// Implementation details: Each level is (at most) about half the size of the
+// previous one, (the leaves of hubs and the isolated vertices are paired up
+// too, as these are left out of a matching), and is refined with a few
+// Fruchterman-Reingold (Barnes-Hut) iterations, so the total cost is close to
+// that of a few iterations on the original graph.
+// see
+// https://en.wikipedia.org/wiki/Force-directed_graph_drawing
+//
+// Can be warm started from a set of initial positions, in which case only the
+// original graph is refined, with a few low temperature iterations.
+//
+// NOTE: Reports its progress, and can be cancelled in between iterations
+// (throws misc::job_cancelled).
+
+template < typename Graph >
+class multilevel_layout : public layout< Graph >
+{
+    BOOST_CONCEPT_ASSERT((boost::GraphConcept< Graph >));
+
+    using base = layout< Graph >;
+    using self = multilevel_layout< Graph >;
+
+public:
+    using id_type = typename base::id_type;
+    using graph_type = typename base::graph_type;
+    using vertex_type = typename base::vertex_type;
+    using coord_type = typename base::coord_type;
+    using positions_view = typename base::positions_view;
+
+    using job_token = misc::job_token;
+
+    static constexpr std::size_t coarsest_size = 64;
+    static constexpr auto min_reduction = 0.1; // stop coarsening otherwise
+    static constexpr auto coarsest_iterations = 100;
+    static constexpr auto refinement_iterations = 10;
+    static constexpr auto theta = 1.0; // Barnes-Hut accuracy
+
+    template < typename WeightMap >
+    multilevel_layout(
+        const graph_type& g,
+        const topology& space,
+        WeightMap edge_weight,
+        job_token& token = misc::foreground_job());
+
+    // Refines a set of initial positions, (one per vertex).
+    template < typename WeightMap >
+    multilevel_layout(
+        const graph_type& g,
+        const topology& space,
+        WeightMap edge_weight,
+        positions_view initial,
+        int iterations,
+        job_token& token = misc::foreground_job());
+
+    ~multilevel_layout() override = default;
+
+    auto id() const -> id_type override { return multilevel_id; }
+
+    auto clone() const -> std::unique_ptr< base > override;
+};
+
+/***********************************************************
+ * Definitions                                             *
+ ***********************************************************/
+
+template < typename Graph >
+template < typename WeightMap >
+inline multilevel_layout< Graph >::multilevel_layout(
+    const graph_type& g,
+    const topology& space,
+    WeightMap edge_weight,
+    job_token& token)
+{
+    BOOST_CONCEPT_ASSERT(
+        (boost::ReadablePropertyMapConcept<
+            WeightMap,
+            typename boost::graph_traits< graph_type >::edge_descriptor >));
+
+    using detail::vector3;
+    using detail::operator+;
+    using detail::operator*;
+    using size_type = std::size_t;
+
+    struct level
+    {
+        size_type num_vertices;
+        detail::weighted_edges edges;
+        detail::coarse_map parent; // to the next (coarser) level
+    };
+
+    const auto n = boost::num_vertices(g);
+
+    if (n == 0 or space.scale() <= 0)
+    {
+        base::set_positions(std::vector< vector3 >(n, { 0, 0, 0 }));
+        token.checkpoint(1);
+        return;
+    }
+
+    // Coarsen.
+
+    auto levels = std::vector< level >();
+    levels.push_back({ .num_vertices = n,
+                       .edges = detail::make_weighted_edges(g, edge_weight),
+                       .parent = {} });
+
+    while (levels.back().num_vertices > coarsest_size)
+    {
+        auto& fine = levels.back();
+        auto parent = detail::match_heavy_edges(fine.num_vertices, fine.edges);
+        const auto num_coarse = detail::num_coarse_vertices(parent);
+
+        if (num_coarse > (1 - min_reduction) * fine.num_vertices)
+            break;
+
+        auto edges = detail::contract_edges(fine.edges, parent);
+        fine.parent = std::move(parent);
+        levels.push_back({ .num_vertices = num_coarse,
+                           .edges = std::move(edges),
+                           .parent = {} });
+    }
+
+    // Progress in respect to the work done, (vertices * iterations).
+
+    auto total_work = 0.0;
+    for (const auto& l : levels)
+        total_work += double(l.num_vertices)
+            * (&l == &levels.back() ? coarsest_iterations
+                                    : refinement_iterations);
+
+    auto work_done = 0.0;
+
+    const auto iterate = [&](auto& positions,
+                             const level& l,
+                             int iterations,
+                             double initial_temperature)
+    {
+        visit_topology(
+            space,
+            [&](const auto& concrete_space)
+            {
+                detail::force_directed_steps(
+                    positions,
+                    l.edges,
+                    concrete_space,
+                    iterations,
+                    initial_temperature,
+                    theta,
+                    [&](auto)
+                    {
+                        token.checkpoint(work_done / total_work);
+                        work_done += double(l.num_vertices);
+                    });
+            });
+    };
+
+    // Lay out the coarsest level.
+
+    auto positions = std::vector< vector3 >(levels.back().num_vertices);
+    for (auto& p : positions)
+        p = detail::bound(space, detail::random_offset(space));
+
+    iterate(positions, levels.back(), coarsest_iterations, space.scale() / 10);
+
+    // Interpolate and refine.
+
+    for (auto l = levels.size() - 1; l-- > 0;)
+    {
+        const auto& fine = levels[l];
+        const auto k = detail::ideal_edge_length(fine.num_vertices, space);
+
+        // NOTE: Drawn from the space, so that it is reproducible from its seed.
+        const auto jitter_scale
+            = space.scale() > 0 ? k / 10 / space.scale() : 0;
+
+        auto fine_positions = std::vector< vector3 >(fine.num_vertices);
+        for (size_type v = 0; v < fine.num_vertices; ++v)
+        {
+            // Jitter, so that matched vertices don't start coincident.
+            const auto jitter = detail::random_offset(space);
+
+            fine_positions[v] = detail::bound(
+                space, positions[fine.parent[v]] + jitter * jitter_scale);
+        }
+
+        positions = std::move(fine_positions);
+        iterate(positions, fine, refinement_iterations, k);
+    }
+
+    token.checkpoint(1);
+
+    base::set_positions(positions);
+}
+
+template < typename Graph >
+template < typename WeightMap >
+inline multilevel_layout< Graph >::multilevel_layout(
+    const graph_type& g,
+    const topology& space,
+    WeightMap edge_weight,
+    positions_view initial,
+    int iterations,
+    job_token& token)
+{
+    BOOST_CONCEPT_ASSERT(
+        (boost::ReadablePropertyMapConcept<
+            WeightMap,
+            typename boost::graph_traits< graph_type >::edge_descriptor >));
+
+    assert(initial.size() == boost::num_vertices(g));
+    assert(iterations >= 0);
+
+    auto positions = detail::bounded_positions(initial, space);
+
+    if (!positions.empty() and space.scale() > 0)
+    {
+        const auto edges = detail::make_weighted_edges(g, edge_weight);
+        const auto k = detail::ideal_edge_length(positions.size(), space);
+
+        visit_topology(
+            space,
+            [&](const auto& concrete_space)
+            {
+                detail::force_directed_steps(
+                    positions,
+                    edges,
+                    concrete_space,
+                    iterations,
+                    k,
+                    theta,
+                    [&token, iterations](auto iteration)
+                    { token.checkpoint(double(iteration) / iterations); });
+            });
+    }
+
+    token.checkpoint(1);
+
+    base::set_positions(positions);
+}
+
+template < typename Graph >
+inline auto multilevel_layout< Graph >::clone() const
+    -> std::unique_ptr< base >
+{
+    return std::make_unique< self >(*this);
+}
+
+} // namespace layout
+
+#endif // LAYOUT_MULTILEVEL_LAYOUT_HPP
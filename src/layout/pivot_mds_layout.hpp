@@ -0,0 +1,180 @@
+// Contains a 3D distance preserving layout class, using pivot mds.
+// Soultatos Stefanos 2022
+
+#ifndef LAYOUT_PIVOT_MDS_LAYOUT_HPP
+#define LAYOUT_PIVOT_MDS_LAYOUT_HPP
+
+#include "detail/force_directed.hpp" // for make_weighted_edges
+#include "detail/pivot_mds.hpp"      // for pivot_mds_components
+#include "layout.hpp"                // for layout
+#include "misc/job.hpp"              // for job_token, foreground_job
+#include "plugin.hpp"                // for pivot_mds_id
+#include "topology.hpp"              // for topology
+
+#include <boost/graph/adjacency_list.hpp> // for num_vertices
+#include <cassert>                        // for assert
+#include <cstddef>                        // for size_t
+
+namespace layout
+{
+
+/***********************************************************
+ * Pivot MDS Layout                                        *
+ ***********************************************************/
+
+// Assigns a position, at a 3d space, to each graph vertex.
+// Places the vertices so that their distances in space follow their
+// (shortest path) distances in the graph, where heavier edges are shorter.
+// Deterministic, the same graph is always placed the same way.
+//
+// Implementation details: Computes the distances from a few max-min pivots,
+// embeds them in 3D through classical multidimensional scaling, and refines
+// the result with a few rounds of sparse stress majorization.
+// (O(pivots * (V + E) log V + V * pivots^2)).
+// Each connected component is laid out on its own, and the components are
+// then packed next to each other.
+// see
+// https://doi.org/10.1007/978-3-540-70904-6_6
+//
+// Can be warm started from a set of initial positions, in which case these are
+// only refined through stress majorization, (skipping the mds).
+//
+// NOTE: Reports its progress, and can be cancelled in between pivots and
+// stress iterations (throws misc::job_cancelled).
+
+template < typename Graph >
+class pivot_mds_layout : public layout< Graph >
+{
+    BOOST_CONCEPT_ASSERT((boost::GraphConcept< Graph >));
+
+    using base = layout< Graph >;
+    using self = pivot_mds_layout< Graph >;
+
+public:
+    using id_type = typename base::id_type;
+    using graph_type = typename base::graph_type;
+    using vertex_type = typename base::vertex_type;
+    using coord_type = typename base::coord_type;
+    using positions_view = typename base::positions_view;
+
+    using job_token = misc::job_token;
+
+    static constexpr std::size_t num_pivots = 50;
+    static constexpr auto default_stress_iterations = 10;
+
+    template < typename WeightMap >
+    pivot_mds_layout(
+        const graph_type& g,
+        const topology& space,
+        WeightMap edge_weight,
+        job_token& token = misc::foreground_job(),
+        int stress_iterations = default_stress_iterations);
+
+    // Refines a set of initial positions, (one per vertex).
+    template < typename WeightMap >
+    pivot_mds_layout(
+        const graph_type& g,
+        const topology& space,
+        WeightMap edge_weight,
+        positions_view initial,
+        int iterations,
+        job_token& token = misc::foreground_job());
+
+    ~pivot_mds_layout() override = default;
+
+    auto id() const -> id_type override { return pivot_mds_id; }
+
+    auto clone() const -> std::unique_ptr< base > override;
+};
+
+/***********************************************************
+ * Definitions                                             *
+ ***********************************************************/
+
+template < typename Graph >
+template < typename WeightMap >
+inline pivot_mds_layout< Graph >::pivot_mds_layout(
+    const graph_type& g,
+    const topology& space,
+    WeightMap edge_weight,
+    job_token& token,
+    int stress_iterations)
+{
+    BOOST_CONCEPT_ASSERT(
+        (boost::ReadablePropertyMapConcept<
+            WeightMap,
+            typename boost::graph_traits< graph_type >::edge_descriptor >));
+
+    const auto n = boost::num_vertices(g);
+
+    token.checkpoint(0);
+
+    const auto edges = detail::make_weighted_edges(g, edge_weight);
+    const auto adjacency = detail::make_weighted_adjacency(n, edges);
+
+    auto positions = detail::pivot_mds_components(
+        adjacency,
+        num_pivots,
+        stress_iterations,
+        [&token](auto progress) { token.checkpoint(0.9 * progress); });
+
+    detail::fit_to_space(positions, space);
+
+    token.checkpoint(1);
+
+    base::set_positions(positions);
+}
+
+template < typename Graph >
+template < typename WeightMap >
+inline pivot_mds_layout< Graph >::pivot_mds_layout(
+    const graph_type& g,
+    const topology& space,
+    WeightMap edge_weight,
+    positions_view initial,
+    int iterations,
+    job_token& token)
+{
+    BOOST_CONCEPT_ASSERT(
+        (boost::ReadablePropertyMapConcept<
+            WeightMap,
+            typename boost::graph_traits< graph_type >::edge_descriptor >));
+
+    assert(initial.size() == boost::num_vertices(g));
+    assert(iterations >= 0);
+
+    const auto n = boost::num_vertices(g);
+
+    auto positions = detail::bounded_positions(initial, space);
+
+    if (iterations > 0 and n > 0)
+    {
+        token.checkpoint(0);
+
+        const auto edges = detail::make_weighted_edges(g, edge_weight);
+        const auto adjacency = detail::make_weighted_adjacency(n, edges);
+
+        // From space to graph distance units, and back.
+        detail::refine_components(
+            positions,
+            adjacency,
+            num_pivots,
+            iterations,
+            [&token](auto progress) { token.checkpoint(0.9 * progress); });
+        detail::fit_to_space(positions, space);
+    }
+
+    token.checkpoint(1);
+
+    base::set_positions(positions);
+}
+
+template < typename Graph >
+inline auto pivot_mds_layout< Graph >::clone() const -> std::unique_ptr< base >
+{
+    return std::make_unique< self >(*this);
+}
+
+} // namespace layout
+
+#endif // LAYOUT_PIVOT_MDS_LAYOUT_HPP
@@ -20,8 +20,15 @@ using id_t = std::string_view;
 
 constexpr id_t gursoy_atun_id = "Gursoy Atun";
 constexpr id_t random_id = "Random";
+constexpr id_t fruchterman_reingold_id = "Fruchterman Reingold";
+constexpr id_t multilevel_id = "Multilevel";
+constexpr id_t pivot_mds_id = "Pivot MDS";
 
-constexpr auto layout_ids = std::array { gursoy_atun_id, random_id };
+constexpr auto layout_ids = std::array { gursoy_atun_id,
+                                         random_id,
+                                         fruchterman_reingold_id,
+                                         multilevel_id,
+                                         pivot_mds_id };
 
 constexpr auto is_layout_plugged_in(id_t id) -> bool
 {
@@ -30,6 +37,9 @@ constexpr auto is_layout_plugged_in(id_t id) -> bool
 
 static_assert(is_layout_plugged_in(gursoy_atun_id));
 static_assert(is_layout_plugged_in(random_id));
+static_assert(is_layout_plugged_in(fruchterman_reingold_id));
+static_assert(is_layout_plugged_in(multilevel_id));
+static_assert(is_layout_plugged_in(pivot_mds_id));
 
 /***********************************************************
  * Topologies                                              *
@@ -8,9 +8,11 @@
 #include "plugin.hpp"   // for random_id
 #include "topology.hpp" // for topology
 
-#include <boost/graph/adjacency_list.hpp> // for vertices
-#include <boost/graph/random_layout.hpp>  // for random_layout
-#include <cassert>                        // for assert
+#include <boost/graph/adjacency_list.hpp>      // for vertices
+#include <boost/graph/random_layout.hpp>       // for random_layout
+#include <boost/property_map/property_map.hpp> // for iterator_property_map
+#include <cassert>                             // for assert
+#include <vector>                              // for vector
 
 namespace layout
 {
@@ -26,6 +28,9 @@ namespace layout
 // https://www.boost.org/doc/libs/1_52_0/libs/graph/doc/random_layout.html
 //
 // Wrapper over the boost implementation, for type erasure.
+//
+// Can be (trivially) warm started from a set of initial positions, which are
+// kept as they are.
 
 template < typename Graph >
 class random_layout : public layout< Graph >
@@ -40,23 +45,20 @@ public:
     using graph_type = typename base::graph_type;
     using vertex_type = typename base::vertex_type;
     using coord_type = typename base::coord_type;
+    using positions_view = typename base::positions_view;
 
     random_layout(const graph_type& g, const topology& space);
+
+    // Keeps a set of initial positions, (one per vertex).
+    random_layout(
+        const graph_type& g,
+        const topology& space,
+        positions_view initial);
     ~random_layout() override = default;
 
     auto id() const -> id_type override { return random_id; }
 
-    auto x(vertex_type v) const -> coord_type override;
-    auto y(vertex_type v) const -> coord_type override;
-    auto z(vertex_type v) const -> coord_type override;
-
     auto clone() const -> std::unique_ptr< base > override;
-
-private:
-    using position = topology::point_type;
-    using position_map = std::unordered_map< vertex_type, position >;
-
-    position_map m_map;
 };
 
 /***********************************************************
@@ -68,33 +70,42 @@ inline random_layout< Graph >::random_layout(
     const graph_type& g,
     const topology& space)
 {
-    boost::random_graph_layout(g, boost::make_assoc_property_map(m_map), space);
+    using point_type = topology::point_type;
 
-    assert(std::all_of(
-        boost::vertices(g).first,
-        boost::vertices(g).second,
-        [this](auto v) { return m_map.contains(v); }));
-}
+    auto points = std::vector< point_type >(boost::num_vertices(g));
 
-template < typename Graph >
-inline auto random_layout< Graph >::x(vertex_type v) const -> coord_type
-{
-    assert(m_map.contains(v));
-    return m_map.at(v)[0];
-}
+    boost::random_graph_layout(
+        g,
+        boost::make_iterator_property_map(
+            std::begin(points), boost::get(boost::vertex_index, g)),
+        space);
 
-template < typename Graph >
-inline auto random_layout< Graph >::y(vertex_type v) const -> coord_type
-{
-    assert(m_map.contains(v));
-    return m_map.at(v)[1];
+    this->set_positions(points);
 }
 
 template < typename Graph >
-inline auto random_layout< Graph >::z(vertex_type v) const -> coord_type
+inline random_layout< Graph >::random_layout(
+    const graph_type& g,
+    const topology& space,
+    positions_view initial)
 {
-    assert(m_map.contains(v));
-    return m_map.at(v)[2];
+    using point_type = topology::point_type;
+
+    assert(initial.size() == boost::num_vertices(g));
+
+    auto points = std::vector< point_type >();
+    points.reserve(initial.size());
+
+    for (const auto& p : initial)
+    {
+        auto point = point_type();
+        point[0] = p[0];
+        point[1] = p[1];
+        point[2] = p[2];
+        points.push_back(space.bound(point));
+    }
+
+    this->set_positions(points);
 }
 
 template < typename Graph >
@@ -5,7 +5,8 @@
 namespace layout
 {
 
-sphere::sphere(scale_type scale) : m_sphere { scale }, m_scale { scale }
+sphere::sphere(scale_type scale, seed_type seed)
+: m_sphere { make_data(scale, seed) }, m_scale { scale }, m_seed { seed }
 {
 }
 
@@ -14,28 +15,16 @@ auto sphere::id() const -> id_type
     return sphere_id;
 }
 
-auto sphere::random_point() const -> point_type
-{
-    return data().random_point();
-}
-
-auto sphere::distance(const point_type& p1, const point_type& p2) const
-    -> distance_type
-{
-    return data().distance(p1, p2);
-}
-
-auto sphere::move_position_toward(
-    const point_type& p1,
-    fraction_type fraction,
-    const point_type& p2) const -> point_type
+auto sphere::clone() const -> std::unique_ptr< topology >
 {
-    return data().move_position_toward(p1, fraction, p2);
+    return std::make_unique< sphere >(scale(), seed());
 }
 
-auto sphere::clone() const -> std::unique_ptr< topology >
+auto sphere::make_data(scale_type scale, seed_type seed) -> data_type
 {
-    return std::make_unique< sphere >(*this);
+    // NOTE: The boost topology copies the generator.
+    auto gen = std::minstd_rand(seed);
+    return data_type(gen, scale);
 }
 
 } // namespace layout
\ No newline at end of file
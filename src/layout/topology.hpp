@@ -4,6 +4,8 @@
 #ifndef LAYOUT_TOPOLOGY_HPP
 #define LAYOUT_TOPOLOGY_HPP
 
+#include "misc/random.hpp" // for seed_type
+
 #include <boost/graph/topology.hpp>       // for topology
 #include <boost/smart_ptr/shared_ptr.hpp> // for shared_ptr
 #include <memory>                         // for unique_ptr
@@ -28,6 +30,7 @@ public:
     using distance_type = double;
     using fraction_type = double;
     using scale_type = double;
+    using seed_type = misc::seed_type;
 
     topology() = default;
     topology(const topology&) = default;
@@ -52,6 +55,9 @@ public:
         const point_type& p2) const -> point_type
         = 0;
 
+    // Returns the closest point to p, that lies within the topology.
+    virtual auto bound(const point_type& p) const -> point_type = 0;
+
     virtual auto clone() const -> std::unique_ptr< topology > = 0;
 };
 
@@ -10,15 +10,18 @@
 namespace layout
 {
 
-auto topology_factory::make_topology(id_type id, scale_type scale) -> pointer
+auto topology_factory::make_topology(
+    id_type id,
+    scale_type scale,
+    seed_type seed) -> pointer
 {
     if (id == cube_id)
     {
-        return std::make_unique< cube >(scale);
+        return std::make_unique< cube >(scale, seed);
     }
     else if (id == sphere_id)
     {
-        return std::make_unique< sphere >(scale);
+        return std::make_unique< sphere >(scale, seed);
     }
     else
     {
@@ -18,6 +18,7 @@ public:
     using pointer = std::unique_ptr< topology >;
     using id_type = id_t;
     using scale_type = topology::scale_type;
+    using seed_type = topology::seed_type;
 
     topology_factory(const topology_factory&) = delete;
     topology_factory(topology_factory&&) = delete;
@@ -25,7 +26,10 @@ public:
     auto operator=(const topology_factory&) -> topology_factory& = delete;
     auto operator=(topology_factory&&) -> topology_factory& = delete;
 
-    static auto make_topology(id_type id, scale_type s) -> pointer;
+    static auto make_topology(
+        id_type id,
+        scale_type s,
+        seed_type seed = misc::default_seed) -> pointer;
 
 private:
     topology_factory() = default;
@@ -4,7 +4,7 @@
 #ifndef LAYOUT_UNTANGLE_LAYOUT_HPP
 #define LAYOUT_UNTANGLE_LAYOUT_HPP
 
-#include "detail/untangle_layout.hpp" // for make_induced_graph, make_offsetted_layout
+#include "detail/untangle_layout.hpp" // for make_cluster_indices, make_offsetted_layout
 #include "layout.hpp"                 // for layout
 
 #include <boost/graph/graph_concepts.hpp> // for GraphConcept, ReadablePropertyMapConcept
@@ -20,6 +20,7 @@ namespace layout
 // Attempts to showcase the adjacency of a graph's clusters on a layout.
 // "Untangles" neighbour vertices in a cluster by placing them together, while
 // still somewhat following the original layout.
+// Linear to the graph size, (besides the layout of the clusters graph).
 template <
     typename Graph,
     typename ClusterMap,
@@ -48,12 +49,11 @@ inline auto untangle_layout(
                   const Graph&,
                   Scale >);
 
-    const auto clusters = detail::make_clusters_set(g, vertex_cluster);
-    const auto g2 = detail::make_induced_graph(g, vertex_cluster, clusters);
+    const auto indices = detail::make_cluster_indices(g, vertex_cluster);
+    const auto g2 = detail::make_induced_graph(g, indices);
     const auto g2_lay = layout_factory(g2, scale);
     assert(g2_lay);
-    return detail::make_offsetted_layout(
-        g, vertex_cluster, clusters, *g2_lay, initial);
+    return detail::make_offsetted_layout(g, indices, *g2_lay, initial);
 }
 
 // Attempts to showcase the adjacency of a graph's clusters on a layout.
@@ -80,9 +80,9 @@ inline auto untangle_layout(
         g,
         vertex_cluster,
         b.get_layout(),
-        [layout_id = get_layout_id(b),                                       //
-         space = topology_factory::make_topology(get_topology_id(b), scale)] //
-        (const auto& g, auto scale)
+        [layout_id = get_layout_id(b),
+         space = topology_factory::make_topology(
+             get_topology_id(b), scale, b.seed())](const auto& g, auto scale)
         {
             assert(space);
             return layout_factory::make_layout(
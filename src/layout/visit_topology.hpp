@@ -0,0 +1,36 @@
+// Contains a static dispatcher of the layout topologies.
+// Soultatos Stefanos 2022
+
+#ifndef LAYOUT_VISIT_TOPOLOGY_HPP
+#define LAYOUT_VISIT_TOPOLOGY_HPP
+
+#include "cube.hpp"     // for cube
+#include "sphere.hpp"   // for sphere
+#include "topology.hpp" // for topology
+
+#include <concepts> // for invocable
+
+namespace layout
+{
+
+// Invokes f with the concrete (final) type of a topology, so that an algorithm
+// is instantiated per topology, and its inner loops are statically dispatched
+// (and inlined).
+// Falls back to the polymorphic topology, for any other (e.g. mock) type.
+template < typename Visitor >
+requires std::invocable< Visitor, const cube& >
+    && std::invocable< Visitor, const sphere& >
+    && std::invocable< Visitor, const topology& >
+inline decltype(auto) visit_topology(const topology& space, Visitor&& f)
+{
+    if (const auto* c = dynamic_cast< const cube* >(&space))
+        return f(*c);
+    else if (const auto* s = dynamic_cast< const sphere* >(&space))
+        return f(*s);
+    else
+        return f(space);
+}
+
+} // namespace layout
+
+#endif // LAYOUT_VISIT_TOPOLOGY_HPP
@@ -5,9 +5,14 @@
 #define MISC_ALL_HPP
 
 #include "algorithm.hpp"
+#include "array_map.hpp"
 #include "concepts.hpp"
 #include "deserialization.hpp"
 #include "heterogeneous.hpp"
+#include "interning.hpp"
+#include "job.hpp"
+#include "json_stream.hpp"
+#include "parallel.hpp"
 #include "random.hpp"
 #include "source.hpp"
 
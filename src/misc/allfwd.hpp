@@ -13,6 +13,17 @@
 namespace misc
 {
 
+class string_interner;
+
+template < typename Tag >
+class basic_interned_string;
+
+struct default_intern_tag;
+struct dependency_intern_tag;
+
+using interned_string = basic_interned_string< default_intern_tag >;
+using interned_dependency = basic_interned_string< dependency_intern_tag >;
+
 } // namespace misc
 
 #endif // MISC_ALLFWD_HPP
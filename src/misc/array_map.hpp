@@ -0,0 +1,86 @@
+// Contains utilities for materializing (dynamic) property maps into contiguous
+// arrays, before running graph algorithms.
+// Soultatos Stefanos 2022
+
+#ifndef MISC_ARRAY_MAP_HPP
+#define MISC_ARRAY_MAP_HPP
+
+#include <boost/graph/adjacency_list.hpp>                   // for edges, etc
+#include <boost/property_map/property_map.hpp>              // for get, put
+#include <boost/property_map/shared_array_property_map.hpp> // for shared_array_property_map
+#include <boost/range/iterator_range.hpp>                   // for make_iterator_range
+
+namespace misc
+{
+
+// A contiguous snapshot of a property map, keyed by a dense index map.
+// NOTE: Copies share the same array.
+template < typename PropertyMap, typename IndexMap >
+using array_map = boost::shared_array_property_map<
+    typename boost::property_traits< PropertyMap >::value_type,
+    IndexMap >;
+
+// Copies the edge property map values into its (existing) array snapshot.
+// O(E), visible to all of the snapshot copies.
+template < typename Graph, typename PropertyMap, typename IndexMap >
+inline auto rematerialize_edges(
+    const Graph& g,
+    PropertyMap edge_property,
+    array_map< PropertyMap, IndexMap >& snapshot) -> void
+{
+    BOOST_CONCEPT_ASSERT(
+        (boost::ReadablePropertyMapConcept<
+            PropertyMap,
+            typename boost::graph_traits< Graph >::edge_descriptor >));
+
+    for (auto e : boost::make_iterator_range(boost::edges(g)))
+        boost::put(snapshot, e, boost::get(edge_property, e));
+}
+
+// Materializes an edge property map into a contiguous array, indexed by a
+// dense edge index map.
+// O(E)
+template < typename Graph, typename PropertyMap, typename IndexMap >
+inline auto materialize_edges(
+    const Graph& g,
+    PropertyMap edge_property,
+    IndexMap edge_index) -> array_map< PropertyMap, IndexMap >
+{
+    auto snapshot = array_map< PropertyMap, IndexMap >(
+        boost::num_edges(g), edge_index);
+
+    rematerialize_edges(g, edge_property, snapshot);
+    return snapshot;
+}
+
+// Copies an edge property map, as is, (e.g. a constant or a function map).
+template < typename Graph, typename PropertyMap >
+inline auto copy_edges(const Graph&, PropertyMap edge_property) -> PropertyMap
+{
+    return edge_property;
+}
+
+// Deep copies an array snapshot, so that the copy is unaffected by any later
+// rematerialization of the original.
+// NOTE: Keyed by a default constructed index map, (as boost does too), which
+// holds for the interior edge index maps.
+// O(E)
+template < typename Graph, typename T, typename IndexMap >
+inline auto copy_edges(
+    const Graph& g,
+    const boost::shared_array_property_map< T, IndexMap >& snapshot,
+    const IndexMap& edge_index = IndexMap())
+    -> boost::shared_array_property_map< T, IndexMap >
+{
+    auto copy = boost::shared_array_property_map< T, IndexMap >(
+        boost::num_edges(g), edge_index);
+
+    for (auto e : boost::make_iterator_range(boost::edges(g)))
+        boost::put(copy, e, boost::get(snapshot, e));
+
+    return copy;
+}
+
+} // namespace misc
+
+#endif // MISC_ARRAY_MAP_HPP
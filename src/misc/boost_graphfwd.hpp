@@ -12,6 +12,9 @@ struct bidirectionalS;
 struct listS;
 struct no_property;
 
+template < typename Tag, typename T, typename Base >
+struct property;
+
 template <
     typename OutEdgeListS,
     typename VertexListS,
@@ -22,6 +25,12 @@ template <
     typename EdgeListS >
 class adjacency_list;
 
+namespace detail
+{
+    template < typename Vertex, typename EdgeIndex >
+    class csr_edge_descriptor;
+} // namespace detail
+
 } // namespace boost
 
 #endif // MISC_BOOST_GRAPHFWD_HPP
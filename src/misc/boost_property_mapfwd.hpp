@@ -10,6 +10,9 @@ namespace boost
 template < typename Func, typename Key, typename Ret >
 class function_property_map;
 
+template < typename T, typename IndexMap >
+class shared_array_property_map;
+
 } // namespace boost
 
 #endif // MISC_BOOST_PROPERTY_MAPFWD_HPP
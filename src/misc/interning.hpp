@@ -0,0 +1,232 @@
+// Contains a global string intern table, and a compact interned string handle.
+// Soultatos Stefanos 2022
+
+#ifndef MISC_INTERNING_HPP
+#define MISC_INTERNING_HPP
+
+#include <array>         // for array
+#include <bit>           // for bit_width
+#include <cassert>       // for assert
+#include <compare>       // for strong_ordering
+#include <cstdint>       // for uint32_t
+#include <functional>    // for hash
+#include <memory>        // for unique_ptr
+#include <mutex>         // for unique_lock
+#include <optional>      // for optional
+#include <ostream>       // for ostream
+#include <shared_mutex>  // for shared_mutex, shared_lock
+#include <string>        // for string
+#include <string_view>   // for string_view
+#include <unordered_map> // for unordered_map
+
+namespace misc
+{
+
+/***********************************************************
+ * String Interner                                         *
+ ***********************************************************/
+
+// Append only string table, assigns dense integer handles to unique strings.
+// Interning/Finding is thread safe, retrieving a string from its handle is
+// lock free, in O(1) time.
+class string_interner
+{
+public:
+    using handle_type = std::uint32_t;
+    using string_type = std::string;
+    using size_type = std::size_t;
+
+    string_interner() = default;
+    string_interner(const string_interner&) = delete;
+    string_interner(string_interner&&) = delete;
+
+    auto operator=(const string_interner&) -> string_interner& = delete;
+    auto operator=(string_interner&&) -> string_interner& = delete;
+
+    auto intern(std::string_view str) -> handle_type;
+    auto find(std::string_view str) const -> std::optional< handle_type >;
+
+    auto str(handle_type h) const -> const string_type&;
+
+    auto size() const -> size_type;
+
+private:
+    // Strings are stored in buckets of doubling capacity, so that they never
+    // move, and handles can be resolved without locking.
+    static constexpr auto first_bucket_bits = 10;
+    static constexpr auto num_buckets = 32 - first_bucket_bits + 1;
+
+    using bucket = std::unique_ptr< string_type[] >;
+    using buckets = std::array< bucket, num_buckets >;
+    using index = std::unordered_map< std::string_view, handle_type >;
+
+    static constexpr auto bucket_of(handle_type h) -> std::size_t;
+    static constexpr auto bucket_offset(handle_type h) -> std::size_t;
+    static constexpr auto bucket_capacity(std::size_t b) -> std::size_t;
+
+    mutable std::shared_mutex m_mutex;
+    buckets m_buckets;
+    index m_index;
+};
+
+constexpr auto string_interner::bucket_of(handle_type h) -> std::size_t
+{
+    const auto x = std::uint64_t(h) + (std::uint64_t(1) << first_bucket_bits);
+    return std::bit_width(x) - 1 - first_bucket_bits;
+}
+
+constexpr auto string_interner::bucket_offset(handle_type h) -> std::size_t
+{
+    const auto x = std::uint64_t(h) + (std::uint64_t(1) << first_bucket_bits);
+    return x - (std::uint64_t(1) << (first_bucket_bits + bucket_of(h)));
+}
+
+constexpr auto string_interner::bucket_capacity(std::size_t b) -> std::size_t
+{
+    return std::size_t(1) << (first_bucket_bits + b);
+}
+
+inline auto string_interner::intern(std::string_view str) -> handle_type
+{
+    if (const auto h = find(str); h)
+        return *h;
+
+    auto lock = std::unique_lock(m_mutex);
+
+    if (auto iter = m_index.find(str); iter != std::end(m_index))
+        return iter->second; // interned meanwhile
+
+    const auto h = static_cast< handle_type >(m_index.size());
+    auto& b = m_buckets[bucket_of(h)];
+
+    if (!b)
+        b = std::make_unique< string_type[] >(bucket_capacity(bucket_of(h)));
+
+    auto& stored = b[bucket_offset(h)];
+    stored = str;
+    m_index.emplace(stored, h);
+
+    assert(this->str(h) == str);
+    return h;
+}
+
+inline auto string_interner::find(std::string_view str) const
+    -> std::optional< handle_type >
+{
+    auto lock = std::shared_lock(m_mutex);
+    const auto iter = m_index.find(str);
+    return iter != std::cend(m_index) ? std::optional(iter->second)
+                                      : std::nullopt;
+}
+
+inline auto string_interner::str(handle_type h) const -> const string_type&
+{
+    assert(m_buckets[bucket_of(h)]);
+    return m_buckets[bucket_of(h)][bucket_offset(h)];
+}
+
+inline auto string_interner::size() const -> size_type
+{
+    auto lock = std::shared_lock(m_mutex);
+    return m_index.size();
+}
+
+/***********************************************************
+ * Interned String                                         *
+ ***********************************************************/
+
+// A (4 byte) handle to a string of a global intern table, one per Tag.
+// Hashed and equality compared by handle, ordered lexicographically.
+template < typename Tag >
+class basic_interned_string
+{
+public:
+    using tag_type = Tag;
+    using handle_type = string_interner::handle_type;
+    using string_type = string_interner::string_type;
+
+    basic_interned_string() : basic_interned_string(std::string_view()) { }
+
+    // NOTE: Explicit, since each new string is interned for good.
+    explicit basic_interned_string(std::string_view str)
+    : m_handle { table().intern(str) }
+    {
+    }
+
+    explicit basic_interned_string(const string_type& str)
+    : basic_interned_string(std::string_view(str))
+    {
+    }
+
+    explicit basic_interned_string(const char* str)
+    : basic_interned_string(std::string_view(str))
+    {
+    }
+
+    // Yields the interned string, if any, without interning it.
+    static auto find(std::string_view str)
+        -> std::optional< basic_interned_string >
+    {
+        const auto h = table().find(str);
+        return h ? std::optional(basic_interned_string(*h)) : std::nullopt;
+    }
+
+    auto handle() const -> handle_type { return m_handle; }
+    auto str() const -> const string_type& { return table().str(m_handle); }
+
+    operator const string_type&() const { return str(); }
+
+    auto operator==(const basic_interned_string&) const -> bool = default;
+
+    auto operator<=>(const basic_interned_string& other) const
+    {
+        return str() <=> other.str();
+    }
+
+    static auto table() -> string_interner&
+    {
+        static string_interner instance;
+        return instance;
+    }
+
+private:
+    explicit basic_interned_string(handle_type h) : m_handle { h } { }
+
+    handle_type m_handle;
+};
+
+template < typename Tag >
+inline auto
+operator<<(std::ostream& os, const basic_interned_string< Tag >& str)
+    -> std::ostream&
+{
+    return os << str.str();
+}
+
+/***********************************************************
+ * Intern Tables                                           *
+ ***********************************************************/
+
+struct default_intern_tag;
+struct dependency_intern_tag;
+
+using interned_string = basic_interned_string< default_intern_tag >;
+
+// Dependency types (e.g "Inherit", "Friend") are few, and interned in their own
+// table, so that their handles can index dense per type tables.
+using interned_dependency = basic_interned_string< dependency_intern_tag >;
+
+} // namespace misc
+
+template < typename Tag >
+struct std::hash< misc::basic_interned_string< Tag > >
+{
+    using argument_type = misc::basic_interned_string< Tag >;
+
+    auto operator()(const argument_type& str) const noexcept -> std::size_t
+    {
+        return str.handle();
+    }
+};
+
+#endif // MISC_INTERNING_HPP
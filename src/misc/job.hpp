@@ -0,0 +1,133 @@
+// Contains utilities for running cancellable jobs on background workers.
+// Soultatos Stefanos 2022
+
+#ifndef MISC_JOB_HPP
+#define MISC_JOB_HPP
+
+#include <algorithm>               // for clamp
+#include <atomic>                  // for atomic
+#include <boost/exception/all.hpp> // for exception
+#include <chrono>                  // for seconds
+#include <exception>               // for exception
+#include <future>                  // for packaged_task, future
+#include <memory>                  // for shared_ptr
+#include <stop_token>              // for stop_source, stop_token
+#include <thread>                  // for jthread
+
+namespace misc
+{
+
+/***********************************************************
+ * Job Token                                               *
+ ***********************************************************/
+
+// Thrown from a job checkpoint, once a stop has been requested.
+struct job_cancelled : virtual std::exception, virtual boost::exception
+{
+};
+
+// Cooperative cancellation & progress reporting, shared between a (long
+// running) job and its requester.
+class job_token
+{
+public:
+    using progress_type = double; // in [0, 1]
+
+    job_token() = default;
+    explicit job_token(std::stop_token stop) : m_stop { std::move(stop) } { }
+
+    job_token(const job_token&) = delete;
+    job_token(job_token&&) = delete;
+
+    auto operator=(const job_token&) -> job_token& = delete;
+    auto operator=(job_token&&) -> job_token& = delete;
+
+    auto stop_requested() const -> bool { return m_stop.stop_requested(); }
+
+    auto progress() const -> progress_type
+    {
+        return m_progress.load(std::memory_order_relaxed);
+    }
+
+    // Reports the job progress.
+    // Throws job_cancelled if a stop has been requested.
+    auto checkpoint(progress_type progress) -> void
+    {
+        m_progress.store(
+            std::clamp(progress, progress_type(0), progress_type(1)),
+            std::memory_order_relaxed);
+
+        if (stop_requested())
+            BOOST_THROW_EXCEPTION(job_cancelled());
+    }
+
+private:
+    std::stop_token m_stop;
+    std::atomic< progress_type > m_progress { 0 };
+};
+
+// Thread local token, that is never stopped, for jobs run in the foreground.
+inline auto foreground_job() -> job_token&
+{
+    thread_local static job_token token;
+    return token;
+}
+
+/***********************************************************
+ * Async Job                                               *
+ ***********************************************************/
+
+// Runs a job, func(job_token&) -> Result, on its own background worker.
+// Destroying a job cancels it, and waits for it to return.
+template < typename Result >
+class async_job
+{
+public:
+    using result_type = Result;
+    using progress_type = job_token::progress_type;
+
+    template < typename Func >
+    explicit async_job(Func func)
+    : m_token { std::make_shared< job_token >(m_stop.get_token()) }
+    {
+        auto task = std::packaged_task< result_type() >(
+            [func = std::move(func), token = m_token]() mutable
+            { return func(*token); });
+
+        m_result = task.get_future();
+        m_worker = std::jthread(std::move(task));
+    }
+
+    async_job(const async_job&) = delete;
+    async_job(async_job&&) = delete;
+
+    ~async_job() { cancel(); }
+
+    auto operator=(const async_job&) -> async_job& = delete;
+    auto operator=(async_job&&) -> async_job& = delete;
+
+    auto progress() const -> progress_type { return m_token->progress(); }
+
+    auto ready() const -> bool
+    {
+        using namespace std::chrono_literals;
+        return m_result.wait_for(0s) == std::future_status::ready;
+    }
+
+    // Requests a (cooperative) stop.
+    auto cancel() -> void { m_stop.request_stop(); }
+
+    // Blocks until the job returns, rethrows its exception, if any.
+    // NOTE: Can be called only once.
+    auto get() -> result_type { return m_result.get(); }
+
+private:
+    std::stop_source m_stop;
+    std::shared_ptr< job_token > m_token;
+    std::future< result_type > m_result;
+    std::jthread m_worker; // joined first
+};
+
+} // namespace misc
+
+#endif // MISC_JOB_HPP
@@ -0,0 +1,387 @@
+// Contains a forward only, event driven json reader over a byte stream.
+// Soultatos Stefanos 2022
+
+#ifndef MISC_JSON_STREAM_HPP
+#define MISC_JSON_STREAM_HPP
+
+#include "deserialization.hpp" // for deserialization_error
+
+#include <boost/exception/all.hpp> // for error_info, exception
+#include <cassert>                 // for assert
+#include <cctype>                  // for isspace
+#include <concepts>                // for invocable
+#include <istream>                 // for istream, streambuf
+#include <jsoncpp/json/json.h>     // for Value, CharReader
+#include <memory>                  // for unique_ptr
+#include <string>                  // for string
+#include <string_view>             // for string_view
+
+namespace misc
+{
+
+/***********************************************************
+ * Errors                                                  *
+ ***********************************************************/
+
+struct syntax_error : virtual deserialization_error
+{
+};
+
+/***********************************************************
+ * Error Info                                              *
+ ***********************************************************/
+
+using offset_info = boost::error_info< struct tag_offset, std::size_t >;
+
+/***********************************************************
+ * Parsing                                                 *
+ ***********************************************************/
+
+// Parses a standalone json value, safe to call concurrently.
+// Throws syntax_error on malformed input.
+inline auto parse_json(std::string_view text) -> Json::Value
+{
+    thread_local const auto reader = std::unique_ptr< Json::CharReader >(
+        Json::CharReaderBuilder().newCharReader());
+
+    Json::Value val;
+    if (!reader->parse(text.data(), text.data() + text.size(), &val, nullptr))
+        BOOST_THROW_EXCEPTION(syntax_error());
+
+    return val;
+}
+
+/***********************************************************
+ * Json Stream                                             *
+ ***********************************************************/
+
+// Reads a json document token by token, without ever materializing it whole.
+// Values of interest can be read into (small) isolated jsoncpp trees.
+// Throws syntax_error on malformed input.
+class json_stream
+{
+public:
+    using value_type = Json::Value;
+    using string_type = std::string;
+    using size_type = std::size_t;
+
+    explicit json_stream(std::istream& is);
+
+    // Returns the next non whitespace character, without consuming it, or
+    // '\0' at the end of the stream.
+    auto peek() -> char;
+
+    // Consumes the given punctuator, or throws.
+    auto consume(char c) -> void;
+
+    // Consumes the trailing whitespace, or throws if any other input is left.
+    auto consume_end() -> void;
+
+    // Consumes a null literal, if next.
+    auto read_null() -> bool;
+
+    auto read_string() -> string_type;
+    auto read_value() -> value_type;
+    auto skip_value() -> void;
+
+    // Returns the next value unparsed, see parse_json.
+    auto read_raw() -> string_type;
+
+    // Consumes the object members, the visitor must consume each value.
+    template < typename UnaryOperation >
+    requires std::invocable< UnaryOperation, string_type >
+    auto for_each_member(UnaryOperation visitor) -> void;
+
+    // Consumes the array elements, the visitor must consume each value.
+    template < typename NullaryOperation >
+    requires std::invocable< NullaryOperation >
+    auto for_each_element(NullaryOperation visitor) -> void;
+
+    auto offset() const -> size_type { return m_offset; }
+
+private:
+    auto get() -> char;
+    [[noreturn]] auto fail() const -> void;
+    auto parse_scratch() const -> value_type;
+
+    auto scan_value(string_type* out) -> void;
+    auto scan_string(string_type* out) -> void;
+    auto scan_scalar(string_type* out) -> void;
+    auto scan_composite(char open, char close, string_type* out) -> void;
+
+    std::streambuf* m_buf { nullptr };
+    size_type m_offset { 0 };
+    string_type m_scratch;
+};
+
+/***********************************************************
+ * Definitions                                             *
+ ***********************************************************/
+
+inline json_stream::json_stream(std::istream& is) : m_buf { is.rdbuf() }
+{
+    assert(m_buf);
+}
+
+[[noreturn]] inline auto json_stream::fail() const -> void
+{
+    BOOST_THROW_EXCEPTION(syntax_error() << offset_info(m_offset));
+}
+
+inline auto json_stream::get() -> char
+{
+    const auto c = m_buf->sbumpc();
+    if (c == std::streambuf::traits_type::eof())
+        fail();
+
+    ++m_offset;
+    return std::streambuf::traits_type::to_char_type(c);
+}
+
+inline auto json_stream::peek() -> char
+{
+    for (;;)
+    {
+        const auto c = m_buf->sgetc();
+        if (c == std::streambuf::traits_type::eof())
+            return '\0';
+
+        if (!std::isspace(c))
+            return std::streambuf::traits_type::to_char_type(c);
+
+        m_buf->sbumpc();
+        ++m_offset;
+    }
+}
+
+inline auto json_stream::consume(char c) -> void
+{
+    if (peek() != c)
+        fail();
+
+    get();
+}
+
+inline auto json_stream::consume_end() -> void
+{
+    peek();
+
+    if (m_buf->sgetc() != std::streambuf::traits_type::eof())
+        fail();
+}
+
+inline auto json_stream::read_null() -> bool
+{
+    if (peek() != 'n')
+        return false;
+
+    m_scratch.clear();
+    scan_scalar(&m_scratch);
+    if (m_scratch != "null")
+        fail();
+
+    return true;
+}
+
+inline auto json_stream::parse_scratch() const -> value_type
+{
+    try
+    {
+        return parse_json(m_scratch);
+    }
+    catch (const syntax_error&)
+    {
+        fail();
+    }
+}
+
+inline auto json_stream::read_string() -> string_type
+{
+    m_scratch.clear();
+    scan_string(&m_scratch);
+    return parse_scratch().asString();
+}
+
+inline auto json_stream::read_value() -> value_type
+{
+    m_scratch.clear();
+    scan_value(&m_scratch);
+    return parse_scratch();
+}
+
+inline auto json_stream::skip_value() -> void
+{
+    scan_value(nullptr);
+}
+
+inline auto json_stream::read_raw() -> string_type
+{
+    auto raw = string_type();
+    scan_value(&raw);
+    return raw;
+}
+
+inline auto json_stream::scan_value(string_type* out) -> void
+{
+    switch (peek())
+    {
+    case '{':
+        scan_composite('{', '}', out);
+        break;
+    case '[':
+        scan_composite('[', ']', out);
+        break;
+    case '"':
+        scan_string(out);
+        break;
+    default:
+        scan_scalar(out);
+        break;
+    }
+}
+
+inline auto json_stream::scan_string(string_type* out) -> void
+{
+    if (peek() != '"')
+        fail();
+
+    auto escaped = false;
+    for (auto first = true;; first = false)
+    {
+        const auto c = get();
+        if (out)
+            out->push_back(c);
+
+        if (escaped)
+            escaped = false;
+        else if (c == '\\')
+            escaped = true;
+        else if (c == '"' && !first)
+            return;
+    }
+}
+
+inline auto json_stream::scan_scalar(string_type* out) -> void
+{
+    const auto is_scalar_char = [](int c)
+    {
+        return std::isalnum(c) || c == '-' || c == '+' || c == '.';
+    };
+
+    peek();
+
+    auto n = 0;
+    for (auto c = m_buf->sgetc();
+         c != std::streambuf::traits_type::eof() && is_scalar_char(c);
+         c = m_buf->sgetc(), ++n)
+    {
+        const auto ch = get();
+        if (out)
+            out->push_back(ch);
+    }
+
+    if (n == 0)
+        fail();
+}
+
+inline auto json_stream::scan_composite(char open, char close, string_type* out)
+    -> void
+{
+    consume(open);
+    if (out)
+        out->push_back(open);
+
+    auto closers = string_type(1, close);
+
+    while (!closers.empty())
+    {
+        const auto c = peek();
+        if (c == '"')
+        {
+            scan_string(out);
+            continue;
+        }
+
+        get();
+        if (out)
+            out->push_back(c);
+
+        if (c == '{')
+            closers.push_back('}');
+        else if (c == '[')
+            closers.push_back(']');
+        else if (c == '}' || c == ']')
+        {
+            if (c != closers.back())
+                fail();
+
+            closers.pop_back();
+        }
+    }
+}
+
+template < typename UnaryOperation >
+requires std::invocable< UnaryOperation, json_stream::string_type >
+inline auto json_stream::for_each_member(UnaryOperation visitor) -> void
+{
+    if (read_null())
+        return;
+
+    consume('{');
+
+    if (peek() == '}')
+    {
+        consume('}');
+        return;
+    }
+
+    for (;;)
+    {
+        auto key = read_string();
+        consume(':');
+        visitor(std::move(key));
+
+        if (peek() == ',')
+        {
+            consume(',');
+            continue;
+        }
+
+        consume('}');
+        return;
+    }
+}
+
+template < typename NullaryOperation >
+requires std::invocable< NullaryOperation >
+inline auto json_stream::for_each_element(NullaryOperation visitor) -> void
+{
+    if (read_null())
+        return;
+
+    consume('[');
+
+    if (peek() == ']')
+    {
+        consume(']');
+        return;
+    }
+
+    for (;;)
+    {
+        visitor();
+
+        if (peek() == ',')
+        {
+            consume(',');
+            continue;
+        }
+
+        consume(']');
+        return;
+    }
+}
+
+} // namespace misc
+
+#endif // MISC_JSON_STREAM_HPP
@@ -0,0 +1,101 @@
+// Contains some minimal fork-join parallelism utilities.
+// Soultatos Stefanos 2022
+
+#ifndef MISC_PARALLEL_HPP
+#define MISC_PARALLEL_HPP
+
+#include <algorithm> // for max, min
+#include <concepts>  // for integral, invocable
+#include <cstddef>   // for size_t
+#include <exception> // for exception_ptr, rethrow_exception
+#include <thread>    // for thread
+#include <vector>    // for vector
+
+namespace misc
+{
+
+// Returns the number of concurrent threads supported, (at least one).
+inline auto hardware_concurrency() -> unsigned
+{
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Splits [first, last) into (at most) num_threads contiguous chunks, and
+// invokes func(chunk_first, chunk_last) for each one on its own thread.
+// The first chunk runs on the calling thread.
+// Rethrows the exception of the lowest throwing chunk, if any.
+template < std::integral Index, typename BinaryFunction >
+requires std::invocable< BinaryFunction, Index, Index >
+inline auto parallel_for_each_chunk(
+    Index first,
+    Index last,
+    BinaryFunction func,
+    unsigned num_threads = hardware_concurrency()) -> void
+{
+    if (first >= last)
+        return;
+
+    const auto n = static_cast< std::size_t >(last - first);
+    const auto chunks = std::min< std::size_t >(std::max(1u, num_threads), n);
+
+    if (chunks == 1)
+    {
+        func(first, last);
+        return;
+    }
+
+    auto errors = std::vector< std::exception_ptr >(chunks);
+
+    auto run = [first, n, chunks, &func, &errors](std::size_t c)
+    {
+        try
+        {
+            func(
+                static_cast< Index >(first + n * c / chunks),
+                static_cast< Index >(first + n * (c + 1) / chunks));
+        }
+        catch (...)
+        {
+            errors[c] = std::current_exception();
+        }
+    };
+
+    auto threads = std::vector< std::thread >();
+    threads.reserve(chunks - 1);
+
+    for (std::size_t c = 1; c < chunks; ++c)
+        threads.emplace_back(run, c);
+
+    run(0);
+
+    for (auto& t : threads)
+        t.join();
+
+    for (const auto& error : errors)
+        if (error)
+            std::rethrow_exception(error);
+}
+
+// Invokes func(i) for each i in [first, last), see parallel_for_each_chunk.
+template < std::integral Index, typename UnaryFunction >
+requires std::invocable< UnaryFunction, Index >
+inline auto parallel_for(
+    Index first,
+    Index last,
+    UnaryFunction func,
+    unsigned num_threads = hardware_concurrency()) -> void
+{
+    parallel_for_each_chunk(
+        first,
+        last,
+        [&func](Index chunk_first, Index chunk_last)
+        {
+            for (auto i = chunk_first; i != chunk_last; ++i)
+                func(i);
+        },
+        num_threads);
+}
+
+} // namespace misc
+
+#endif // MISC_PARALLEL_HPP
@@ -6,21 +6,41 @@
 
 #include "concepts.hpp" // for arithmetic
 
+#include <cstdint>     // for uint64_t
 #include <limits>      // for numeric_limits
 #include <random>      // for uniform_int/real_distribution, random_device
+#include <string_view> // for string_view
 #include <type_traits> // for conditional_t
 
 namespace misc
 {
 
+using rng_type = std::mt19937;
+using seed_type = rng_type::result_type;
+
+constexpr seed_type default_seed = rng_type::default_seed;
+
 // Thread local static rng.
 template < typename Seed = std::random_device >
-auto rng() -> std::mt19937&
+auto rng() -> rng_type&
 {
-    thread_local static std::mt19937 generator { Seed()() };
+    thread_local static rng_type generator { Seed()() };
     return generator;
 }
 
+// Random arithmetic generator, using uniform distribution, from a given
+// generator.
+template < arithmetic T, typename Generator >
+inline auto urandom_from(Generator& gen, T min, T max) -> T
+{
+    using distribution_type = std::conditional_t<
+        std::is_integral_v< T >,
+        std::uniform_int_distribution< T >,
+        std::uniform_real_distribution< T > >;
+
+    return distribution_type(min, max)(gen);
+}
+
 // Random arithmetic generator, using uniform distribution.
 // Uses std::random_device & std::mt19937.
 template < arithmetic T, typename Seed = std::random_device >
@@ -28,12 +48,38 @@ inline auto urandom(
     T min = std::numeric_limits< T >::min(),
     T max = std::numeric_limits< T >::max()) -> T
 {
-    using distribution_type = std::conditional_t<
-        std::is_integral_v< T >,
-        std::uniform_int_distribution< T >,
-        std::uniform_real_distribution< T > >;
+    return urandom_from(rng< Seed >(), min, max);
+}
+
+// Derives the seed of a named random stream from a (root) seed, so that the
+// streams of a seed are independent from one another.
+// NOTE: Stable across runs, (FNV-1a).
+constexpr auto stream_seed(seed_type seed, std::string_view stream)
+    -> seed_type
+{
+    constexpr auto prime = std::uint64_t(1099511628211u);
+
+    auto hash = std::uint64_t(14695981039346656037u);
 
-    return distribution_type(min, max)(rng< Seed >());
+    for (auto i = 0; i < 4; ++i)
+    {
+        hash ^= (seed >> (8 * i)) & 0xff;
+        hash *= prime;
+    }
+
+    for (auto c : stream)
+    {
+        hash ^= static_cast< unsigned char >(c);
+        hash *= prime;
+    }
+
+    return static_cast< seed_type >(hash ^ (hash >> 32));
+}
+
+// Reproducible rng of a named random stream of a seed.
+inline auto make_rng(seed_type seed, std::string_view stream) -> rng_type
+{
+    return rng_type(stream_seed(seed, stream));
 }
 
 } // namespace misc
@@ -216,15 +216,16 @@ namespace
 
         auto execute() -> void override
         {
-            old_layout = layout::get_layout_id(backend);
-            old_topology = layout::get_topology_id(backend);
-            old_scale = layout::get_scale(backend);
-            layout::restore_defaults(backend);
+            old_layout = backend.requested_layout();
+            old_topology = backend.requested_topology();
+            old_scale = backend.requested_scale();
+            layout::request_defaults(backend);
         }
 
         auto undo() -> void override
         {
-            layout::update_layout(backend, old_layout, old_topology, old_scale);
+            layout::request_layout(
+                backend, old_layout, old_topology, old_scale);
         }
 
         auto redo() -> void override { execute(); }
@@ -239,8 +240,8 @@ auto update_layout(
 {
     cmds.execute(make_trivial(
         layout_id,
-        [&backend]() { return layout::get_layout_id(backend); },
-        [&backend](auto id) { layout::update_layout(backend, id); }));
+        [&backend]() { return backend.requested_layout(); },
+        [&backend](auto id) { layout::request_layout(backend, id); }));
 }
 
 auto update_layout_topology(
@@ -250,8 +251,8 @@ auto update_layout_topology(
 {
     cmds.execute(make_trivial(
         topology_id,
-        [&backend]() { return layout::get_topology_id(backend); },
-        [&backend](auto id) { layout::update_topology(backend, id); }));
+        [&backend]() { return backend.requested_topology(); },
+        [&backend](auto id) { layout::request_topology(backend, id); }));
 }
 
 auto update_layout_scale(
@@ -261,8 +262,8 @@ auto update_layout_scale(
 {
     cmds.execute(make_trivial(
         scale,
-        [&backend]() { return layout::get_scale(backend); },
-        [&backend](auto s) { layout::update_scale(backend, s); }));
+        [&backend]() { return backend.requested_scale(); },
+        [&backend](auto s) { layout::request_scale(backend, s); }));
 }
 
 auto restore_layout(command_history& cmds, layout_backend& backend) -> void
@@ -622,6 +623,11 @@ namespace
         using modularity_type = backend_type::modularity_type;
         using gamma_type = backend_type::gamma_type;
         using steps_type = backend_type::steps_type;
+        using resolution_type = backend_type::resolution_type;
+        using iterations_type = backend_type::iterations_type;
+        using clique_size_type = backend_type::clique_size_type;
+        using clique_count_type = backend_type::clique_count_type;
+        using seconds_type = backend_type::seconds_type;
 
         backend_type& backend;
         id_type clusterer_id;
@@ -632,6 +638,11 @@ namespace
         modularity_type q;
         gamma_type gamma;
         steps_type steps;
+        resolution_type resolution;
+        iterations_type iterations;
+        clique_size_type min_clique_size;
+        clique_count_type max_cliques;
+        seconds_type time_limit;
 
         explicit restore_clustering_command(backend_type& b) : backend { b } { }
         ~restore_clustering_command() override = default;
@@ -646,6 +657,11 @@ namespace
             q = clustering::get_min_modularity(backend);
             gamma = clustering::get_llp_gamma(backend);
             steps = clustering::get_llp_steps(backend);
+            resolution = clustering::get_leiden_resolution(backend);
+            iterations = clustering::get_leiden_iterations(backend);
+            min_clique_size = clustering::get_mce_min_clique_size(backend);
+            max_cliques = clustering::get_mce_max_cliques(backend);
+            time_limit = clustering::get_mce_time_limit(backend);
             clustering::restore_defaults(backend);
         }
 
@@ -659,6 +675,11 @@ namespace
             clustering::update_min_modularity(backend, q);
             clustering::update_llp_gamma(backend, gamma);
             clustering::update_llp_steps(backend, steps);
+            clustering::update_leiden_resolution(backend, resolution);
+            clustering::update_leiden_iterations(backend, iterations);
+            clustering::update_mce_min_clique_size(backend, min_clique_size);
+            clustering::update_mce_max_cliques(backend, max_cliques);
+            clustering::update_mce_time_limit(backend, time_limit);
         }
 
         auto redo() -> void override { execute(); }
@@ -798,6 +819,66 @@ auto update_clustering_llp_steps(
         [&backend](auto val) { clustering::update_llp_steps(backend, val); }));
 }
 
+auto update_clustering_leiden_resolution(
+    command_history& cmds,
+    clustering_backend& backend,
+    clustering_backend::resolution_type resolution) -> void
+{
+    cmds.execute(make_trivial(
+        resolution,
+        [&backend]() { return clustering::get_leiden_resolution(backend); },
+        [&backend](auto val)
+        { clustering::update_leiden_resolution(backend, val); }));
+}
+
+auto update_clustering_leiden_iterations(
+    command_history& cmds,
+    clustering_backend& backend,
+    clustering_backend::iterations_type iterations) -> void
+{
+    cmds.execute(make_trivial(
+        iterations,
+        [&backend]() { return clustering::get_leiden_iterations(backend); },
+        [&backend](auto val)
+        { clustering::update_leiden_iterations(backend, val); }));
+}
+
+auto update_clustering_mce_min_clique_size(
+    command_history& cmds,
+    clustering_backend& backend,
+    clustering_backend::clique_size_type n) -> void
+{
+    cmds.execute(make_trivial(
+        n,
+        [&backend]() { return clustering::get_mce_min_clique_size(backend); },
+        [&backend](auto val)
+        { clustering::update_mce_min_clique_size(backend, val); }));
+}
+
+auto update_clustering_mce_max_cliques(
+    command_history& cmds,
+    clustering_backend& backend,
+    clustering_backend::clique_count_type n) -> void
+{
+    cmds.execute(make_trivial(
+        n,
+        [&backend]() { return clustering::get_mce_max_cliques(backend); },
+        [&backend](auto val)
+        { clustering::update_mce_max_cliques(backend, val); }));
+}
+
+auto update_clustering_mce_time_limit(
+    command_history& cmds,
+    clustering_backend& backend,
+    clustering_backend::seconds_type secs) -> void
+{
+    cmds.execute(make_trivial(
+        secs,
+        [&backend]() { return clustering::get_mce_time_limit(backend); },
+        [&backend](auto val)
+        { clustering::update_mce_time_limit(backend, val); }));
+}
+
 auto restore_clustering(command_history& cmds, clustering_backend& backend)
     -> void
 {
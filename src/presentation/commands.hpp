@@ -200,6 +200,31 @@ auto update_clustering_llp_steps(
     clustering_backend& backend,
     clustering_backend::steps_type steps) -> void;
 
+auto update_clustering_leiden_resolution(
+    command_history& cmds,
+    clustering_backend& backend,
+    clustering_backend::resolution_type resolution) -> void;
+
+auto update_clustering_leiden_iterations(
+    command_history& cmds,
+    clustering_backend& backend,
+    clustering_backend::iterations_type iterations) -> void;
+
+auto update_clustering_mce_min_clique_size(
+    command_history& cmds,
+    clustering_backend& backend,
+    clustering_backend::clique_size_type n) -> void;
+
+auto update_clustering_mce_max_cliques(
+    command_history& cmds,
+    clustering_backend& backend,
+    clustering_backend::clique_count_type n) -> void;
+
+auto update_clustering_mce_time_limit(
+    command_history& cmds,
+    clustering_backend& backend,
+    clustering_backend::seconds_type secs) -> void;
+
 auto restore_clustering(command_history& cmds, clustering_backend& backend)
     -> void;
 
@@ -10,6 +10,7 @@
 #include "degrees/all.hpp"
 #include "gui/all.hpp"
 #include "layout/all.hpp"
+#include "misc/array_map.hpp"
 #include "rendering/all.hpp"
 #include "scaling/all.hpp"
 #include "undo_redo/all.hpp"
@@ -21,19 +22,23 @@ namespace presentation
 using graph = architecture::graph;
 using symbol_table = architecture::symbol_table;
 using vertex_marker = architecture::vertex_marker;
+using metadata_table = architecture::metadata_table;
 using metadata_counter = architecture::metadata_counter;
 
 using id_map = architecture::id_map;
 using dependency_map = architecture::dependency_map;
+using edge_index_map = architecture::edge_index_map;
 using weight_map = weights::weight_map< graph, dependency_map >;
+using weight_array_map
+    = boost::shared_array_property_map< int, edge_index_map >;
 using scale_map = scaling::scale_map< graph, metadata_counter >;
 using color_map = color_coding::color_map< graph, dependency_map >;
 
 using weights_backend = weights::backend;
-using layout_backend = layout::backend< graph, weight_map >;
+using layout_backend = layout::backend< graph, weight_array_map >;
 using scaling_backend = scaling::backend;
 using degrees_backend = degrees::backend;
-using clustering_backend = clustering::backend< graph, weight_map >;
+using clustering_backend = clustering::backend< graph, weight_array_map >;
 using color_coding_backend = color_coding::backend;
 
 using cluster_map = clustering::cluster_map< clustering_backend >;
@@ -92,6 +97,10 @@ static_assert(
 
 static_assert(std::is_same_v< weights_backend::weight_type, int >);
 
+static_assert(std::is_same_v<
+              weight_array_map,
+              misc::array_map< weight_map, edge_index_map > >);
+
 } // namespace presentation
 
 #endif // PRESENTATION_DEF_HPP
@@ -11,6 +11,7 @@
 #include "degrees/allfwd.hpp"
 #include "gui/allfwd.hpp"
 #include "layout/allfwd.hpp"
+#include "misc/boost_property_mapfwd.hpp"
 #include "rendering/allfwd.hpp"
 #include "scaling/allfwd.hpp"
 #include "undo_redo/allfwd.hpp"
@@ -22,19 +23,23 @@ namespace presentation
 using graph = architecture::graph;
 using symbol_table = architecture::symbol_table;
 using vertex_marker = architecture::vertex_marker;
+using metadata_table = architecture::metadata_table;
 using metadata_counter = architecture::metadata_counter;
 
 using id_map = architecture::id_map;
 using dependency_map = architecture::dependency_map;
+using edge_index_map = architecture::edge_index_map;
 using weight_map = weights::weight_map< graph, dependency_map >;
+using weight_array_map
+    = boost::shared_array_property_map< int, edge_index_map >;
 using scale_map = scaling::scale_map< graph, metadata_counter >;
 using color_map = color_coding::color_map< graph, dependency_map >;
 
 using weights_backend = weights::backend;
-using layout_backend = layout::backend< graph, weight_map >;
+using layout_backend = layout::backend< graph, weight_array_map >;
 using scaling_backend = scaling::backend;
 using degrees_backend = degrees::backend;
-using clustering_backend = clustering::backend< graph, weight_map >;
+using clustering_backend = clustering::backend< graph, weight_array_map >;
 using color_coding_backend = color_coding::backend;
 
 using cluster_map = clustering::cluster_map< clustering_backend >;
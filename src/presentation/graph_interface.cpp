@@ -1,5 +1,7 @@
 #include "graph_interface.hpp"
 
+#include "misc/array_map.hpp"
+
 namespace presentation
 {
 
@@ -16,13 +18,24 @@ graph_interface::graph_interface(
 : m_st { std::move(st) }
 , m_g { std::move(g) }
 , m_marker { std::move(m) }
+, m_metadata { m_st, m_g }
 , m_weights { std::move(w_cfg) }
-, m_layout { m_g, edge_weight(*this), std::move(l_cfg) }
+, m_weight_array { misc::materialize_edges(
+      m_g, edge_weight(*this), edge_index(*this)) }
+, m_layout { m_g, m_weight_array, std::move(l_cfg) }
 , m_scaling { std::move(scaling_cfg) }
-, m_clustering { m_g, edge_weight(*this), std::move(clus_cfg) }
+, m_clustering { m_g, m_weight_array, std::move(clus_cfg) }
 , m_cols { std::move(col_cfg) }
 , m_degrees { std::move(deg_cfg) }
 {
+    // NOTE: Connected first, so that the snapshot is refreshed before any
+    // other observer reacts to the weight update.
+    m_weights.connect(
+        [this](auto, auto)
+        {
+            misc::rematerialize_edges(
+                m_g, edge_weight(*this), m_weight_array);
+        });
 }
 
 auto vertex_id(const graph_interface& g) -> id_map
@@ -39,7 +52,7 @@ auto vertex_scale(const graph_interface& g) -> scale_map
 {
     return scaling::make_scale_map< graph >(
         g.get_scaling_backend(),
-        metadata_counter(g.get_symbol_table(), g.get_graph()));
+        metadata_counter(g.get_metadata_table()));
 }
 
 auto vertex_cluster(const graph_interface& g) -> cluster_map
@@ -52,6 +65,11 @@ auto edge_dependency(const graph_interface& g) -> dependency_map
     return boost::get(boost::edge_bundle, g.get_graph());
 }
 
+auto edge_index(const graph_interface& g) -> edge_index_map
+{
+    return boost::get(architecture::edge_index_t(), g.get_graph());
+}
+
 auto edge_weight(const graph_interface& g) -> weight_map
 {
     return weights::make_weight_map< graph >(
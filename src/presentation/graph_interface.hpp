@@ -32,9 +32,15 @@ public:
     auto get_graph() const -> const auto& { return m_g; }
     auto get_vertex_marker() const -> const auto& { return m_marker; }
 
+    // Per vertex symbol metrics, computed once.
+    auto get_metadata_table() const -> const auto& { return m_metadata; }
+
     auto get_weights_backend() const -> const auto& { return m_weights; }
     auto get_weights_backend() -> auto& { return m_weights; }
 
+    // Contiguous snapshot of the edge weights, kept in sync with the backend.
+    auto get_weight_array() const -> const auto& { return m_weight_array; }
+
     auto get_layout_backend() const -> const auto& { return m_layout; }
     auto get_layout_backend() -> auto& { return m_layout; }
 
@@ -54,7 +60,9 @@ private:
     symbol_table m_st;
     graph m_g;
     vertex_marker m_marker;
+    metadata_table m_metadata;
     weights_backend m_weights;
+    weight_array_map m_weight_array; // materialized for the algorithms
     layout_backend m_layout;
     scaling_backend m_scaling;
     clustering_backend m_clustering;
@@ -72,6 +80,7 @@ auto vertex_scale(const graph_interface& g) -> scale_map;
 auto vertex_cluster(const graph_interface& g) -> cluster_map;
 
 auto edge_dependency(const graph_interface&) -> dependency_map;
+auto edge_index(const graph_interface& g) -> edge_index_map;
 auto edge_weight(const graph_interface& g) -> weight_map;
 auto edge_color(const graph_interface& g) -> color_map;
 
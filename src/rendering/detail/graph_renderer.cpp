@@ -27,7 +27,7 @@ using namespace Ogre;
 // Common architecture graph vertex rendering properties.
 struct vertex_properties
 {
-    using id_type = std::string;
+    using id_type = vertex_renderer::id_type;
     using position_type = Ogre::Vector3;
     using name_type = std::string;
     using scale_type = Ogre::Vector3;
@@ -98,7 +98,7 @@ namespace
 {
     inline auto make_vertex_txt_name(const vertex_renderer::id_type& id)
     {
-        return id + " txt";
+        return id.str() + " txt";
     }
 
     inline auto make_vertex_indegree_effect_name(
@@ -106,7 +106,7 @@ namespace
         const std::optional< vertex_renderer::name_type >& particle_system)
     {
         const auto to_str = particle_system ? *particle_system : "";
-        return id + " indegree " + to_str;
+        return id.str() + " indegree " + to_str;
     }
 
     inline auto make_vertex_outdegree_effect_name(
@@ -114,7 +114,7 @@ namespace
         const std::optional< vertex_renderer::name_type >& particle_system)
     {
         const auto to_str = particle_system ? *particle_system : "";
-        return id + " outdegree " + to_str;
+        return id.str() + " outdegree " + to_str;
     }
 
     inline auto make_vertex_properties(
@@ -215,7 +215,7 @@ auto vertex_renderer::setup_text(const vertex_type& v) -> void
 
     auto txt = std::make_unique< MovableText >(
         v.txt_name,
-        v.id,
+        v.id.str(),
         m_cfg->vertex_id_font_name,
         m_cfg->vertex_id_char_height,
         m_cfg->vertex_id_color,
@@ -577,7 +577,7 @@ auto vertex_renderer::vertex_txt(const id_type& id) -> vertex_txt_type&
 // Common architecture graph edge rendering properties.
 struct edge_properties
 {
-    using vertex_id_type = std::string;
+    using vertex_id_type = edge_renderer::vertex_id_type;
     using dependency_type = std::string;
     using name_type = std::string;
     using weight_type = int;
@@ -598,8 +598,11 @@ struct edge_properties
     auto operator!=(const edge_properties&) const -> bool = default;
 };
 
-edge_renderer::edge_renderer(scene_type& scene, const config_data_type& cfg)
-: m_scene { scene }, m_cfg { &cfg }
+edge_renderer::edge_renderer(
+    scene_type& scene,
+    const config_data_type& cfg,
+    seed_type seed)
+: m_scene { scene }, m_cfg { &cfg }, m_seed { misc::stream_seed(seed, "edges") }
 {
     assert(m_cfg);
 }
@@ -614,7 +617,7 @@ namespace
         const edge_renderer::vertex_id_type& target,
         const edge_renderer::dependency_type& dependency)
     {
-        return source + " -> " + target + " " + dependency;
+        return source.str() + " -> " + target.str() + " " + dependency;
     }
 
     inline auto make_edge_tip_name(const edge_properties::name_type& name)
@@ -701,8 +704,9 @@ namespace
     //          |
     // (inter1) *---* (begin)
     inline auto calculate_edge_path(
-        const edge_properties& e, //
-        const SceneManager& scene)
+        const edge_properties& e,
+        const SceneManager& scene,
+        misc::seed_type seed)
     {
         assert(scene.hasSceneNode(e.source));
         assert(scene.hasSceneNode(e.target));
@@ -710,9 +714,12 @@ namespace
         // Generate a random Bezier curve from source to target.
         // We generate random curves in order to handle parallel edges.
         // This is done by computing 4 control points (2 random).
+        // NOTE: Seeded from the edge name, so that each edge is curved alike
+        // across (re)renders and runs of the same seed.
         const auto& begin = scene.getSceneNode(e.source)->getPosition();
         const auto end = calculate_edge_end(e, scene);
-        const auto dist = misc::urandom< Real >(-20, 20);
+        auto rng = misc::make_rng(seed, e.name);
+        const auto dist = misc::urandom_from< Real >(rng, -20, 20);
         const auto inter1 = across_line(begin, begin.perpendicular(), dist);
         const auto inter2 = across_line(end, end.perpendicular(), dist);
 
@@ -768,7 +775,7 @@ auto edge_renderer::setup(
     m_edges[name] = std::move(e);
     m_parallels.insert(&edge(name));
 
-    const auto path = calculate_edge_path(edge(name), m_scene);
+    const auto path = calculate_edge_path(edge(name), m_scene, m_seed);
     setup_model(edge(name), path);
     setup_tip(edge(name), path);
     setup_text(edge(name), path);
@@ -923,7 +930,7 @@ auto edge_renderer::render_position(
     const dependency_type& dependency) -> void
 {
     const auto name = make_edge_name(source, target, dependency);
-    const auto path = calculate_edge_path(edge(name), m_scene);
+    const auto path = calculate_edge_path(edge(name), m_scene, m_seed);
     render_model_pos(edge(name), path);
     render_tip_pos(edge(name), path);
     render_text_pos(edge(name), path);
@@ -1093,7 +1100,7 @@ auto edge_renderer::draw(
 {
     m_cfg = &cfg;
     const auto name = make_edge_name(source, target, dependency);
-    const auto path = calculate_edge_path(edge(name), m_scene);
+    const auto path = calculate_edge_path(edge(name), m_scene, m_seed);
     draw_model(edge(name), path);
     draw_tip(edge(name), path);
     draw_text(edge(name), path);
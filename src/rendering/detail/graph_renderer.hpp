@@ -4,6 +4,9 @@
 #ifndef RENDERING_DETAIL_GRAPH_RENDERER_HPP
 #define RENDERING_DETAIL_GRAPH_RENDERER_HPP
 
+#include "misc/interning.hpp" // for interned_string
+#include "misc/random.hpp"    // for seed_type
+
 #include <OGRE/OgrePrerequisites.h> // for SceneManager
 #include <memory>                   // for memory
 #include <optional>                 // for optional
@@ -60,7 +63,7 @@ public:
     using scene_type = Ogre::SceneManager;
     using config_data_type = graph_config;
 
-    using id_type = std::string;
+    using id_type = misc::interned_string;
     using position_type = Ogre::Vector3;
     using scale_type = Ogre::Vector3;
     using degree_type = int;
@@ -161,13 +164,18 @@ public:
     using scene_type = Ogre::SceneManager;
     using config_data_type = graph_config;
 
-    using vertex_id_type = std::string;
+    using vertex_id_type = misc::interned_string;
     using dependency_type = std::string;
     using weight_type = int;
 
     using rgba_type = Ogre::ColourValue;
+    using seed_type = misc::seed_type;
 
-    edge_renderer(scene_type& scene, const config_data_type& cfg);
+    // NOTE: The edge curves are drawn from their own stream of the seed.
+    edge_renderer(
+        scene_type& scene,
+        const config_data_type& cfg,
+        seed_type seed = misc::default_seed);
 
     edge_renderer(const edge_renderer&) = default;
     edge_renderer(edge_renderer&&) = default;
@@ -276,6 +284,7 @@ private:
 
     scene_type& m_scene;
     const config_data_type* m_cfg { nullptr };
+    seed_type m_seed { misc::default_seed };
 
     edge_map m_edges;
     edge_text_map m_edge_texts;
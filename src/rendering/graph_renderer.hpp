@@ -58,7 +58,8 @@ public:
     using degrees_evaluator_type = DegreesEvaluator;
     using cluster_color_coder_type = ClusterColorCoder;
 
-    using id_type = std::string;
+    using id_type = detail::vertex_renderer::id_type;
+    using seed_type = detail::edge_renderer::seed_type;
 
     static_assert(std::is_convertible_v<
                   typename degrees_evaluator_type::particles_type,
@@ -69,6 +70,7 @@ public:
                   typename degrees_evaluator_type::degree_type >);
 
     // Renders the graph with its layout.
+    // NOTE: The seed reproduces the (random) edge curves across runs.
     template < typename PositionMap >
     graph_renderer(
         const graph_type& g,
@@ -78,7 +80,8 @@ public:
         scene_type& scene,
         config_data_type cfg,
         degrees_evaluator_type degrees_eval,
-        cluster_color_coder_type color_coder);
+        cluster_color_coder_type color_coder,
+        seed_type seed = misc::default_seed);
 
     graph_renderer(const graph_renderer&) = default;
     graph_renderer(graph_renderer&&) = default;
@@ -191,7 +194,8 @@ inline graph_renderer<
         scene_type& scene,
         config_data_type cfg,
         degrees_evaluator_type degrees_eval,
-        cluster_color_coder_type color_coder)
+        cluster_color_coder_type color_coder,
+        seed_type seed)
 : m_g { g }
 , m_vertex_id { vertex_id }
 , m_edge_dependency { edge_dependency }
@@ -200,7 +204,7 @@ inline graph_renderer<
 , m_defaults { cfg }
 , m_cfg_api { std::move(cfg) }
 , m_vertex_renderer { scene, config_data() }
-, m_edge_renderer { scene, config_data() }
+, m_edge_renderer { scene, config_data(), seed }
 , m_degrees_eval { std::move(degrees_eval) }
 , m_cluster_coder { std::move(color_coder) }
 {
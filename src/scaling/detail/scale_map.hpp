@@ -8,12 +8,23 @@
 #include "scaling/scale.hpp"
 
 #include <boost/graph/graph_concepts.hpp>
-#include <cassert>
 #include <numeric>
+#include <utility>
+#include <vector>
 
 namespace scaling::detail
 {
 
+// Resolves a factor tag to the key of a factor counter, if it can do so.
+template < typename FactorCounter >
+inline auto resolve_tag(const FactorCounter& f, factor_repo::tag_type tag)
+{
+    if constexpr (requires { f.resolve(tag); })
+        return f.resolve(tag);
+    else
+        return tag;
+}
+
 template < typename Graph, typename FactorCounter >
 class scale_dispatcher
 {
@@ -24,23 +35,24 @@ public:
     using vertex_type = typename graph_traits::vertex_descriptor;
     using factor_counter_type = FactorCounter;
 
+    // NOTE: The factor tags are resolved once, here.
     scale_dispatcher(const backend& b, factor_counter_type f)
-    : m_backend { &b }, m_count_factors { std::move(f) }
+    : m_count_factors { std::move(f) }
     {
-        assert(m_backend);
+        for (const auto& [tag, factor] : b.get_factor_repo())
+            m_factors.emplace_back(&factor, resolve_tag(m_count_factors, tag));
     }
 
     auto operator()(vertex_type v) const -> scale_vector
     {
         return std::accumulate(
-            std::cbegin(m_backend->get_factor_repo()),
-            std::cend(m_backend->get_factor_repo()),
+            std::cbegin(m_factors),
+            std::cend(m_factors),
             make_neutral_scale(),
             [this, v](const auto& lhs, const auto& rhs)
             {
-                const auto& tag = rhs.first;
-                const auto& factor = rhs.second;
-                const auto num = m_count_factors(v, tag);
+                const auto& factor = *rhs.first;
+                const auto num = m_count_factors(v, rhs.second);
 
                 static_assert(std::is_integral_v< decltype(num) >);
 
@@ -49,7 +61,14 @@ public:
     }
 
 private:
-    const backend* m_backend { nullptr };
+    using key_type = decltype(resolve_tag(
+        std::declval< const factor_counter_type& >(),
+        std::declval< factor_repo::tag_type >()));
+
+    // NOTE: The factors of a backend are updated in place, never moved.
+    using factor_vector = std::vector< std::pair< const factor*, key_type > >;
+
+    factor_vector m_factors;
     factor_counter_type m_count_factors;
 };
 
@@ -4,9 +4,11 @@
 #ifndef WEIGHTS_DETAIL_WEIGHT_MAP_HPP
 #define WEIGHTS_DETAIL_WEIGHT_MAP_HPP
 
+#include "misc/interning.hpp"
 #include "weights/backend.hpp"
 
 #include <boost/graph/graph_concepts.hpp>
+#include <type_traits>
 
 namespace weights::detail
 {
@@ -19,6 +21,8 @@ public:
     using dependency_map = DependencyMap;
     using edge_type = typename graph_type ::edge_descriptor;
     using weight_type = backend::weight_type;
+    using dependency_type
+        = typename boost::property_traits< dependency_map >::value_type;
 
     weight_dispatcher(const backend& b, dependency_map edge_dependency)
     : m_backend { &b }, m_edge_dependency { edge_dependency }
@@ -29,8 +33,15 @@ public:
     {
         assert(m_backend);
         const auto& repo = m_backend->get_weight_repo();
-        const auto dependency = boost::get(m_edge_dependency, e);
-        return repo.get_weight(dependency);
+        const auto& dependency = boost::get(m_edge_dependency, e);
+
+        // Interned dependencies are resolved by index, not by name.
+        if constexpr (std::is_same_v<
+                          std::decay_t< dependency_type >,
+                          misc::interned_dependency >)
+            return repo.get_weight(dependency.handle());
+        else
+            return repo.get_weight(dependency);
     }
 
 private:
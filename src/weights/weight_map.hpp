@@ -6,6 +6,7 @@
 
 #include "backend.hpp"           // for backend
 #include "detail/weight_map.hpp" // for weight_dispatcher
+#include "misc/interning.hpp"    // for interned_dependency
 
 #include <boost/graph/graph_concepts.hpp>               // for GraphConcept
 #include <boost/property_map/function_property_map.hpp> // for function_property_map
@@ -31,9 +32,12 @@ inline auto make_weight_map(const backend& b, DependencyMap edge_dependency)
             DependencyMap,
             typename boost::graph_traits< Graph >::edge_descriptor >));
 
-    static_assert(std::is_convertible_v<
-                  typename boost::property_traits< DependencyMap >::value_type,
-                  backend::dependency_type >);
+    using dependency_type
+        = typename boost::property_traits< DependencyMap >::value_type;
+
+    static_assert(
+        std::is_convertible_v< dependency_type, backend::dependency_type >
+        || std::is_same_v< dependency_type, misc::interned_dependency >);
 
     return weight_map< Graph, DependencyMap >(
         detail::weight_dispatcher< Graph, DependencyMap >(b, edge_dependency));
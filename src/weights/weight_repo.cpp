@@ -5,8 +5,26 @@
 namespace weights
 {
 
+namespace
+{
+    inline auto id_of(weight_repo::dependency_type dependency)
+    {
+        return misc::interned_dependency(dependency).handle();
+    }
+
+} // namespace
+
 weight_repo::weight_repo(hash_table table) : m_map { std::move(table) }
 {
+    for (const auto& [dependency, weight] : m_map)
+    {
+        const auto id = id_of(dependency);
+
+        if (id >= m_dense.size())
+            m_dense.resize(id + 1);
+
+        m_dense[id] = weight;
+    }
 }
 
 auto weight_repo::get_weight(dependency_type dependency) const -> weight_type
@@ -16,12 +34,22 @@ auto weight_repo::get_weight(dependency_type dependency) const -> weight_type
     return (*iter).second;
 }
 
+auto weight_repo::get_weight(dependency_id_type dependency) const
+    -> weight_type
+{
+    assert(dependency < m_dense.size());
+    assert(m_dense[dependency]);
+    return *m_dense[dependency];
+}
+
 auto weight_repo::set_weight(dependency_type dependency, weight_type w) -> void
 {
     auto iter = m_map.find(dependency);
     assert(iter != std::cend(m_map));
     (*iter).second = w; // heterogeneous, no allocations
+    m_dense[id_of(dependency)] = w;
     assert(get_weight(dependency) == w);
+    assert(get_weight(id_of(dependency)) == w);
 }
 
-} // namespace weights
\ No newline at end of file
+} // namespace weights
@@ -5,24 +5,31 @@
 #define WEIGHTS_WEIGHT_REPO_HPP
 
 #include "misc/heterogeneous.hpp" // for unordered_string_map
+#include "misc/interning.hpp"     // for interned_dependency
 
+#include <optional>    // for optional
 #include <string>      // for string
 #include <string_view> // for string_view
+#include <vector>      // for vector
 
 namespace weights
 {
 
 // Manages a table of strings, provides an interface of string views.
+// Weights are also indexed by interned dependency handles, in O(1) time,
+// without any hashing.
 class weight_repo
 {
 public:
     using dependency_type = std::string_view;
+    using dependency_id_type = misc::interned_dependency::handle_type;
     using weight_type = int;
     using hash_table = misc::unordered_string_map< weight_type >;
 
     explicit weight_repo(hash_table table = hash_table());
 
     auto get_weight(dependency_type dependency) const -> weight_type;
+    auto get_weight(dependency_id_type dependency) const -> weight_type;
 
     // Precondition: the dependency must have been assigned on construction.
     auto set_weight(dependency_type dependency, weight_type score) -> void;
@@ -35,11 +42,21 @@ public:
     auto end() const -> auto { return std::end(m_map); }
     auto cend() const -> auto { return std::cend(m_map); }
 
-    auto operator==(const weight_repo&) const -> bool = default;
-    auto operator!=(const weight_repo&) const -> bool = default;
+    auto operator==(const weight_repo& other) const -> bool
+    {
+        return m_map == other.m_map;
+    }
+
+    auto operator!=(const weight_repo& other) const -> bool
+    {
+        return !(*this == other);
+    }
 
 private:
+    using dense_table = std::vector< std::optional< weight_type > >;
+
     hash_table m_map;
+    dense_table m_dense;
 };
 
 } // namespace weights
@@ -3,11 +3,17 @@
 #include "architecture/graph.hpp"
 #include "architecture/symbol_table.hpp"
 #include "architecture/vertex_marker.hpp"
+#include "misc/json_stream.hpp"
+#include "misc/source.hpp"
 
+#include <array>
 #include <boost/graph/isomorphism.hpp>
+#include <fstream>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <jsoncpp/json/json.h>
+#include <sstream>
+#include <string>
 
 using namespace testing;
 using namespace architecture;
@@ -150,22 +156,22 @@ auto build_sample_graph_2(const symbol_table& st)
     for (const auto& [id, _] : st)
         cache.mark(id, boost::add_vertex(id, g));
 
-    boost::add_edge(
+    add_dependency(
         cache.vertex("CS::CS_1::class_A"),
         cache.vertex("CS::CS_1::class_B"),
-        "ClassField",
+        dependency_type("ClassField"),
         g);
 
-    boost::add_edge(
+    add_dependency(
         cache.vertex("CS::CS_1::class_X"),
         cache.vertex("CS::CS_1::class_B"),
-        "Inherit",
+        dependency_type("Inherit"),
         g);
 
-    boost::add_edge(
+    add_dependency(
         cache.vertex("CS::CS_1::class_X"),
         cache.vertex("CS::CS_1::class_A"),
-        "Inherit",
+        dependency_type("Inherit"),
         g);
 
     return g;
@@ -185,4 +191,233 @@ TEST(arch_generation, sample_graph_2)
     ASSERT_TRUE(boost::isomorphism(actual_g, expected_g));
 }
 
-} // namespace
\ No newline at end of file
+auto open_json_stream(std::string_view to) -> std::ifstream
+{
+    const auto abs_path = misc::resolve_source_path(to);
+    assert(std::filesystem::exists(abs_path));
+    return std::ifstream { abs_path };
+}
+
+// See sample_graph_0.json
+TEST(arch_streaming_generation, sample_graph_0)
+{
+    auto is = open_json_stream("../../data/testfiles/sample_graph_0.json");
+
+    const auto [st, g, props] = deserialize(is);
+
+    ASSERT_EQ(st, symbol_table());
+    ASSERT_EQ(boost::num_vertices(g), 0);
+}
+
+// See sample_graph_1.json
+TEST(arch_streaming_generation, sample_graph_1)
+{
+    auto is = open_json_stream("../../data/testfiles/sample_graph_1.json");
+    const auto expected = build_sample_st_1();
+
+    const auto [actual, g, props] = deserialize(is);
+
+    ASSERT_EQ(actual, expected);
+}
+
+// See sample_graph_2.json
+TEST(arch_streaming_generation, sample_graph_2)
+{
+    auto is = open_json_stream("../../data/testfiles/sample_graph_2.json");
+    const auto expected_st = build_sample_st_2();
+    const auto expected_g = build_sample_graph_2(expected_st);
+
+    const auto [actual_st, actual_g, _] = deserialize(is);
+
+    ASSERT_EQ(actual_st, expected_st);
+    ASSERT_TRUE(boost::isomorphism(actual_g, expected_g));
+}
+
+TEST(arch_streaming_generation, dependencies_after_structures)
+{
+    auto is = std::istringstream(R"({
+        "structures" : {
+            "a" : {
+                "name" : "a", "namespace" : "", "structure_type" : "Class",
+                "src_info" : { "file" : "a.cpp", "line" : 1, "col" : 2 },
+                "fields" : null, "methods" : null, "contains" : null,
+                "bases" : null, "friends" : null, "template_args" : null
+            },
+            "b" : {
+                "name" : "b", "namespace" : "", "structure_type" : "Class",
+                "src_info" : { "file" : "b.cpp", "line" : 3, "col" : 4 },
+                "fields" : null, "methods" : null, "contains" : null,
+                "bases" : null, "friends" : null, "template_args" : null
+            }
+        },
+        "dependencies" : [
+            {
+                "from" : "a",
+                "to" : "b",
+                "types" : { "Inherit" : 1, "Friend" : 1 }
+            }
+        ]
+    })");
+
+    const auto [st, g, m] = deserialize(is);
+
+    ASSERT_EQ(boost::num_vertices(g), 2);
+    ASSERT_EQ(boost::num_edges(g), 2);
+    EXPECT_EQ(boost::out_degree(m.vertex("a"), g), 2);
+    EXPECT_EQ(boost::in_degree(m.vertex("b"), g), 2);
+}
+
+TEST(arch_generation, edge_indices_are_dense_in_insertion_order)
+{
+    const auto root
+        = read_json_root("../../data/testfiles/sample_graph_2.json");
+
+    const auto [st, g, m] = deserialize(root);
+    const auto edge_index = boost::get(edge_index_t(), g);
+
+    auto i = edge_index_type(0);
+    for (auto e : boost::make_iterator_range(boost::edges(g)))
+        EXPECT_EQ(boost::get(edge_index, e), i++);
+
+    ASSERT_EQ(i, boost::num_edges(g));
+}
+
+TEST(arch_streaming_generation, missing_structures_are_reported)
+{
+    auto is = std::istringstream(R"({ "dependencies" : null })");
+
+    ASSERT_THROW(deserialize(is), misc::key_not_found);
+}
+
+TEST(arch_streaming_generation, malformed_input_is_reported)
+{
+    auto is = std::istringstream(R"({ "structures" : { "a" : { )");
+
+    ASSERT_THROW(deserialize(is), misc::syntax_error);
+}
+
+TEST(arch_streaming_generation, trailing_input_is_reported)
+{
+    auto is = std::istringstream(
+        R"({ "structures" : null, "dependencies" : null } { })");
+
+    ASSERT_THROW(deserialize(is), misc::syntax_error);
+}
+
+auto make_structure_json(const std::string& id) -> Json::Value
+{
+    Json::Value val;
+    val["name"] = id;
+    val["namespace"] = "ns::";
+    val["structure_type"] = "Class";
+    val["src_info"]["file"] = id + ".cpp";
+    val["src_info"]["line"] = 1;
+    val["src_info"]["col"] = 1;
+    val["fields"][id + "::f"]["access"] = "private";
+    val["fields"][id + "::f"]["full_type"] = "int";
+    val["fields"][id + "::f"]["name"] = "f";
+    val["fields"][id + "::f"]["src_info"] = val["src_info"];
+    val["fields"][id + "::f"]["type"] = "int";
+    val["methods"] = Json::nullValue;
+    val["contains"] = Json::nullValue;
+    val["bases"].append("std::exception");
+    val["friends"] = Json::nullValue;
+    val["template_args"] = Json::nullValue;
+    return val;
+}
+
+// Builds a densely connected architecture with num_structures structures.
+auto make_architecture_json(int num_structures) -> Json::Value
+{
+    static constexpr auto types = std::array { "Inherit", "Friend", "Method" };
+
+    Json::Value root;
+
+    for (auto i = 0; i < num_structures; ++i)
+    {
+        const auto id = "s" + std::to_string(i);
+        root["structures"][id] = make_structure_json(id);
+    }
+
+    for (auto i = 0; i < num_structures; ++i)
+        for (auto j = 1; j <= i % 7; ++j)
+        {
+            Json::Value dep;
+            dep["from"] = "s" + std::to_string(i);
+            dep["to"] = "s" + std::to_string((i * 31 + j) % num_structures);
+            for (std::size_t k = 0; k <= j % types.size(); ++k)
+                dep["types"][types[k]] = 1;
+
+            root["dependencies"].append(dep);
+        }
+
+    return root;
+}
+
+auto expect_identical(const config_data& lhs, const config_data& rhs) -> void
+{
+    const auto& [lhs_st, lhs_g, lhs_m] = lhs;
+    const auto& [rhs_st, rhs_g, rhs_m] = rhs;
+
+    EXPECT_EQ(lhs_st, rhs_st);
+    ASSERT_EQ(boost::num_vertices(lhs_g), boost::num_vertices(rhs_g));
+    ASSERT_EQ(boost::num_edges(lhs_g), boost::num_edges(rhs_g));
+    EXPECT_EQ(lhs_m.num_marked(), rhs_m.num_marked());
+
+    for (auto v : boost::make_iterator_range(boost::vertices(lhs_g)))
+    {
+        EXPECT_EQ(lhs_g[v], rhs_g[v]);
+        EXPECT_EQ(lhs_m.vertex(lhs_g[v]), rhs_m.vertex(rhs_g[v]));
+
+        const auto [lhs_first, lhs_last] = boost::out_edges(v, lhs_g);
+        const auto [rhs_first, rhs_last] = boost::out_edges(v, rhs_g);
+        ASSERT_EQ(
+            std::distance(lhs_first, lhs_last),
+            std::distance(rhs_first, rhs_last));
+
+        for (auto l = lhs_first, r = rhs_first; l != lhs_last; ++l, ++r)
+        {
+            EXPECT_EQ(boost::target(*l, lhs_g), boost::target(*r, rhs_g));
+            EXPECT_EQ(lhs_g[*l], rhs_g[*r]);
+            EXPECT_EQ(
+                boost::get(edge_index_t(), lhs_g, *l),
+                boost::get(edge_index_t(), rhs_g, *r));
+        }
+    }
+}
+
+class given_a_large_architecture : public Test
+{
+protected:
+    const Json::Value root = make_architecture_json(600);
+};
+
+TEST_F(given_a_large_architecture, parallel_generation_is_identical_to_serial)
+{
+    const auto expected = deserialize(root);
+
+    expect_identical(deserialize(root, 1), expected);
+    expect_identical(deserialize(root, 4), expected);
+    expect_identical(deserialize(root, 13), expected);
+}
+
+TEST_F(given_a_large_architecture, streaming_generation_is_identical_to_serial)
+{
+    const auto expected = deserialize(root);
+
+    for (auto num_threads : { 1u, 4u, 13u })
+    {
+        auto is = std::istringstream(root.toStyledString());
+        expect_identical(deserialize(is, num_threads), expected);
+    }
+}
+
+TEST(arch_parallel_generation, errors_are_propagated)
+{
+    auto root = make_architecture_json(100);
+    root["structures"]["s42"].removeMember("name");
+
+    ASSERT_THROW(deserialize(root, 4), misc::key_not_found);
+}
+
+} // namespace
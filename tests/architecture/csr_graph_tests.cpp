@@ -0,0 +1,241 @@
+#include "architecture/csr_graph.hpp"
+#include "clustering/layered_label_propagation_clustering.hpp"
+#include "clustering/louvain_method_clustering.hpp"
+#include "clustering/shared_nearest_neighbour_clustering.hpp"
+#include "layout/cube.hpp"
+#include "layout/gursoy_atun_layout.hpp"
+
+#include <algorithm>
+#include <boost/graph/graph_concepts.hpp>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace testing;
+using namespace architecture;
+
+namespace
+{
+
+BOOST_CONCEPT_ASSERT((boost::VertexListGraphConcept< csr_graph >));
+BOOST_CONCEPT_ASSERT((boost::EdgeListGraphConcept< csr_graph >));
+BOOST_CONCEPT_ASSERT((boost::IncidenceGraphConcept< csr_graph >));
+BOOST_CONCEPT_ASSERT((boost::BidirectionalGraphConcept< csr_graph >));
+BOOST_CONCEPT_ASSERT((boost::AdjacencyGraphConcept< csr_graph >));
+
+auto build_sample_graph() -> graph
+{
+    auto g = graph();
+
+    const auto a = boost::add_vertex(symbol_type("a"), g);
+    const auto b = boost::add_vertex(symbol_type("b"), g);
+    const auto c = boost::add_vertex(symbol_type("c"), g);
+    const auto d = boost::add_vertex(symbol_type("d"), g);
+    const auto e = boost::add_vertex(symbol_type("e"), g);
+    const auto f = boost::add_vertex(symbol_type("f"), g);
+    boost::add_vertex(symbol_type("isolated"), g);
+
+    add_dependency(a, b, dependency_type("Inherit"), g);
+    add_dependency(b, c, dependency_type("Friend"), g);
+    add_dependency(c, a, dependency_type("MethodArg"), g);
+    add_dependency(a, c, dependency_type("Inherit"), g);
+    add_dependency(a, c, dependency_type("Friend"), g); // parallel
+    add_dependency(d, e, dependency_type("Inherit"), g);
+    add_dependency(e, f, dependency_type("ClassField"), g);
+    add_dependency(f, d, dependency_type("Inherit"), g);
+    add_dependency(c, d, dependency_type("MethodArg"), g);
+    add_dependency(f, f, dependency_type("Friend"), g); // self loop
+
+    return g;
+}
+
+TEST(csr_graph, empty_graph_yields_empty_view)
+{
+    const auto view = make_csr_graph(graph());
+
+    EXPECT_EQ(boost::num_vertices(view), 0);
+    ASSERT_EQ(boost::num_edges(view), 0);
+}
+
+TEST(csr_graph, view_shares_vertices_and_ids)
+{
+    const auto g = build_sample_graph();
+    const auto view = make_csr_graph(g);
+
+    ASSERT_EQ(boost::num_vertices(view), boost::num_vertices(g));
+    for (auto v : boost::make_iterator_range(boost::vertices(g)))
+        EXPECT_EQ(view[v], g[v]);
+}
+
+TEST(csr_graph, view_out_edges_follow_the_graph_out_edges)
+{
+    const auto g = build_sample_graph();
+    const auto view = make_csr_graph(g);
+    const auto dependency = boost::get(&csr_edge_properties::dependency, view);
+
+    ASSERT_EQ(boost::num_edges(view), boost::num_edges(g));
+    for (auto v : boost::make_iterator_range(boost::vertices(g)))
+    {
+        ASSERT_EQ(boost::out_degree(v, view), boost::out_degree(v, g));
+
+        auto [first, last] = boost::out_edges(v, view);
+        for (auto e : boost::make_iterator_range(boost::out_edges(v, g)))
+        {
+            ASSERT_NE(first, last);
+            EXPECT_EQ(boost::source(*first, view), v);
+            EXPECT_EQ(boost::target(*first, view), boost::target(e, g));
+            EXPECT_EQ(boost::get(dependency, *first), g[e]);
+            ++first;
+        }
+    }
+}
+
+TEST(csr_graph, view_in_edges_match_the_graph_in_edges)
+{
+    const auto g = build_sample_graph();
+    const auto view = make_csr_graph(g);
+
+    for (auto v : boost::make_iterator_range(boost::vertices(g)))
+    {
+        std::vector< graph::vertex_descriptor > expected, actual;
+
+        for (auto e : boost::make_iterator_range(boost::in_edges(v, g)))
+            expected.push_back(boost::source(e, g));
+
+        for (auto e : boost::make_iterator_range(boost::in_edges(v, view)))
+        {
+            EXPECT_EQ(boost::target(e, view), v);
+            actual.push_back(boost::source(e, view));
+        }
+
+        EXPECT_THAT(actual, UnorderedElementsAreArray(expected));
+    }
+}
+
+TEST(csr_graph, view_edges_map_to_the_graph_edge_indices)
+{
+    const auto g = build_sample_graph();
+    const auto view = make_csr_graph(g);
+    const auto index = boost::get(&csr_edge_properties::index, view);
+
+    auto by_index = std::unordered_map< edge_index_type, graph::edge_descriptor >();
+    for (auto e : boost::make_iterator_range(boost::edges(g)))
+        by_index.emplace(boost::get(edge_index_t(), g, e), e);
+
+    auto visited = std::vector< bool >(boost::num_edges(g), false);
+    for (auto e : boost::make_iterator_range(boost::edges(view)))
+    {
+        const auto i = boost::get(index, e);
+        ASSERT_TRUE(by_index.contains(i));
+        ASSERT_FALSE(visited[i]);
+        visited[i] = true;
+
+        const auto original = by_index.at(i);
+        EXPECT_EQ(boost::source(e, view), boost::source(original, g));
+        EXPECT_EQ(boost::target(e, view), boost::target(original, g));
+        EXPECT_EQ(view[e].dependency, g[original]);
+    }
+}
+
+TEST(csr_graph, louvain_clusters_the_view_as_the_graph)
+{
+    using cluster_map = std::unordered_map< graph::vertex_descriptor, int >;
+
+    const auto g = build_sample_graph();
+    const auto view = make_csr_graph(g);
+
+    auto expected = cluster_map();
+    auto rng = std::mt19937(42);
+    clustering::louvain_method_clustering(
+        g,
+        boost::make_constant_property< graph::edge_descriptor >(1),
+        boost::make_assoc_property_map(expected),
+        0.1f,
+        rng);
+
+    auto actual = cluster_map();
+    rng = std::mt19937(42);
+    clustering::louvain_method_clustering(
+        view,
+        boost::make_constant_property< csr_graph::edge_descriptor >(1),
+        boost::make_assoc_property_map(actual),
+        0.1f,
+        rng);
+
+    ASSERT_EQ(actual, expected);
+}
+
+TEST(csr_graph, shared_nearest_neighbour_clusters_the_view_as_the_graph)
+{
+    using cluster_map = std::unordered_map< graph::vertex_descriptor, int >;
+
+    const auto g = build_sample_graph();
+    const auto view = make_csr_graph(g);
+
+    auto expected = cluster_map();
+    clustering::shared_nearest_neighbour_clustering(
+        g, 1, boost::make_assoc_property_map(expected));
+
+    auto actual = cluster_map();
+    clustering::shared_nearest_neighbour_clustering(
+        view, 1, boost::make_assoc_property_map(actual));
+
+    ASSERT_EQ(actual, expected);
+}
+
+TEST(csr_graph, layered_label_propagation_clusters_the_view_as_the_graph)
+{
+    using cluster_map = std::unordered_map< graph::vertex_descriptor, int >;
+
+    const auto g = build_sample_graph();
+    const auto view = make_csr_graph(g);
+
+    auto rng = std::mt19937(42);
+    const auto gen = [&rng](std::size_t min, std::size_t max)
+    { return misc::urandom_from(rng, min, max); };
+
+    auto expected = cluster_map();
+    clustering::layered_label_propagation_clustering(
+        g,
+        boost::make_constant_property< graph::edge_descriptor >(1),
+        0.5f,
+        3,
+        boost::make_assoc_property_map(expected),
+        gen,
+        rng);
+
+    auto actual = cluster_map();
+    rng = std::mt19937(42);
+    clustering::layered_label_propagation_clustering(
+        view,
+        boost::make_constant_property< csr_graph::edge_descriptor >(1),
+        0.5f,
+        3,
+        boost::make_assoc_property_map(actual),
+        gen,
+        rng);
+
+    ASSERT_EQ(actual, expected);
+}
+
+TEST(csr_graph, gursoy_atun_lays_out_the_view_as_the_graph)
+{
+    const auto g = build_sample_graph();
+    const auto view = make_csr_graph(g);
+
+    const auto expected = layout::gursoy_atun_layout< graph >(
+        g,
+        layout::cube(100, 42),
+        boost::make_constant_property< graph::edge_descriptor >(1));
+
+    const auto actual = layout::gursoy_atun_layout< csr_graph >(
+        view,
+        layout::cube(100, 42),
+        boost::make_constant_property< csr_graph::edge_descriptor >(1));
+
+    ASSERT_TRUE(std::ranges::equal(actual.positions(), expected.positions()));
+}
+
+} // namespace
@@ -28,13 +28,15 @@ protected:
         st->insert(std::move(s));
 
         g = std::make_unique< graph >();
-        vertex = boost::add_vertex("id", *g);
+        vertex = boost::add_vertex(symbol_type("id"), *g);
 
-        counter = std::make_unique< metadata_counter >(*st, *g);
+        table = std::make_unique< metadata_table >(*st, *g);
+        counter = std::make_unique< metadata_counter >(*table);
     }
 
     std::unique_ptr< symbol_table > st;
     std::unique_ptr< graph > g;
+    std::unique_ptr< metadata_table > table;
     std::unique_ptr< metadata_counter > counter;
     graph::vertex_descriptor vertex;
 };
@@ -59,4 +61,69 @@ TEST_F(given_a_metadata_counter, invalid_tag_results_to_zero_count)
     ASSERT_EQ(std::invoke(*counter, vertex, "bob"), 0);
 }
 
+TEST(metadata_table, default_table_is_empty)
+{
+    const auto table = metadata_table();
+
+    EXPECT_EQ(table.num_vertices(), 0);
+    ASSERT_TRUE(table.column(metadata_table::metric::fields).empty());
+}
+
+TEST(metadata_table, columns_are_indexed_by_vertex)
+{
+    using metric = metadata_table::metric;
+
+    auto st = symbol_table();
+    auto g = graph();
+
+    structure a;
+    a.sym.id = "a";
+    a.fields = { definition() };
+    a.nested = { "b", "c" };
+
+    structure b;
+    b.sym.id = "b";
+    b.methods = { method(), method() };
+
+    structure c;
+    c.sym.id = "c";
+    c.fields = { definition(), definition(), definition() };
+
+    st.insert(std::move(a));
+    st.insert(std::move(b));
+    st.insert(std::move(c));
+
+    boost::add_vertex(symbol_type("c"), g);
+    boost::add_vertex(symbol_type("a"), g);
+    boost::add_vertex(symbol_type("b"), g);
+
+    const auto table = metadata_table(st, g);
+
+    ASSERT_EQ(table.num_vertices(), 3);
+    EXPECT_THAT(table.column(metric::fields), ElementsAre(3, 1, 0));
+    EXPECT_THAT(table.column(metric::methods), ElementsAre(0, 0, 2));
+    EXPECT_THAT(table.column(metric::nested), ElementsAre(0, 2, 0));
+    EXPECT_EQ(table.count(1, metric::nested), 2);
+}
+
+TEST(metadata_counter, tags_resolve_to_metrics)
+{
+    using metric = metadata_table::metric;
+    using counter = metadata_counter;
+
+    EXPECT_EQ(counter::metric(counter::fields_tag), metric::fields);
+    EXPECT_EQ(counter::metric(counter::methods_tag), metric::methods);
+    EXPECT_EQ(counter::metric(counter::nested_tag), metric::nested);
+    ASSERT_EQ(counter::metric("bob"), std::nullopt);
+}
+
+TEST_F(given_a_metadata_counter, resolved_tags_can_be_counted)
+{
+    const auto fields = counter->resolve(metadata_counter::fields_tag);
+    const auto unknown = counter->resolve("bob");
+
+    ASSERT_EQ(std::invoke(*counter, vertex, fields), 2);
+    ASSERT_EQ(std::invoke(*counter, vertex, unknown), 0);
+}
+
 } // namespace
\ No newline at end of file
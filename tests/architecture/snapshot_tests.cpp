@@ -0,0 +1,151 @@
+#include "../utility/config.hpp"
+#include "architecture/config.hpp"
+#include "architecture/graph.hpp"
+#include "architecture/snapshot.hpp"
+#include "architecture/symbol_table.hpp"
+#include "architecture/vertex_marker.hpp"
+#include "misc/source.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <jsoncpp/json/json.h>
+
+using namespace testing;
+using namespace architecture;
+using namespace utility;
+
+namespace
+{
+
+auto expect_identical(const config_data& lhs, const config_data& rhs) -> void
+{
+    const auto& [lhs_st, lhs_g, lhs_m] = lhs;
+    const auto& [rhs_st, rhs_g, rhs_m] = rhs;
+
+    EXPECT_EQ(lhs_st, rhs_st);
+    ASSERT_EQ(boost::num_vertices(lhs_g), boost::num_vertices(rhs_g));
+    ASSERT_EQ(boost::num_edges(lhs_g), boost::num_edges(rhs_g));
+    ASSERT_EQ(lhs_m.num_marked(), rhs_m.num_marked());
+
+    for (auto v : boost::make_iterator_range(boost::vertices(lhs_g)))
+    {
+        EXPECT_EQ(lhs_g[v], rhs_g[v]);
+        EXPECT_EQ(lhs_m.vertex(lhs_g[v]), rhs_m.vertex(rhs_g[v]));
+
+        const auto [lhs_first, lhs_last] = boost::out_edges(v, lhs_g);
+        const auto [rhs_first, rhs_last] = boost::out_edges(v, rhs_g);
+        ASSERT_EQ(
+            std::distance(lhs_first, lhs_last),
+            std::distance(rhs_first, rhs_last));
+
+        for (auto l = lhs_first, r = rhs_first; l != lhs_last; ++l, ++r)
+        {
+            EXPECT_EQ(boost::target(*l, lhs_g), boost::target(*r, rhs_g));
+            EXPECT_EQ(lhs_g[*l], rhs_g[*r]);
+        }
+    }
+}
+
+class given_a_snapshot_file : public Test
+{
+protected:
+    using path = std::filesystem::path;
+
+    void SetUp() override
+    {
+        snapshot = std::filesystem::temp_directory_path()
+            / "archv_snapshot_tests.snapshot";
+    }
+
+    void TearDown() override { std::filesystem::remove(snapshot); }
+
+    static auto sample(std::string_view name) -> path
+    {
+        return misc::resolve_source_path(path("../../data/testfiles") / name);
+    }
+
+    static auto deserialize_sample(std::string_view name) -> config_data
+    {
+        return deserialize(read_json_root(
+            (path("../../data/testfiles") / name).string()));
+    }
+
+    path snapshot;
+};
+
+TEST_F(given_a_snapshot_file, sample_graph_0_round_trips)
+{
+    const auto expected = deserialize_sample("sample_graph_0.json");
+
+    dump_snapshot(expected, 42, snapshot);
+    const auto actual = load_snapshot(snapshot, 42);
+
+    ASSERT_TRUE(actual);
+    expect_identical(*actual, expected);
+}
+
+TEST_F(given_a_snapshot_file, sample_graph_1_round_trips)
+{
+    const auto expected = deserialize_sample("sample_graph_1.json");
+
+    dump_snapshot(expected, 42, snapshot);
+    const auto actual = load_snapshot(snapshot, 42);
+
+    ASSERT_TRUE(actual);
+    expect_identical(*actual, expected);
+}
+
+TEST_F(given_a_snapshot_file, sample_graph_2_round_trips)
+{
+    const auto expected = deserialize_sample("sample_graph_2.json");
+
+    dump_snapshot(expected, 42, snapshot);
+    const auto actual = load_snapshot(snapshot, 42);
+
+    ASSERT_TRUE(actual);
+    expect_identical(*actual, expected);
+}
+
+TEST_F(given_a_snapshot_file, differently_keyed_snapshots_are_stale)
+{
+    dump_snapshot(deserialize_sample("sample_graph_2.json"), 42, snapshot);
+
+    ASSERT_FALSE(load_snapshot(snapshot, 43));
+}
+
+TEST_F(given_a_snapshot_file, missing_snapshots_are_not_loaded)
+{
+    ASSERT_FALSE(load_snapshot(snapshot, 42));
+}
+
+TEST_F(given_a_snapshot_file, truncated_snapshots_are_not_loaded)
+{
+    dump_snapshot(deserialize_sample("sample_graph_1.json"), 42, snapshot);
+    std::filesystem::resize_file(
+        snapshot, std::filesystem::file_size(snapshot) / 2);
+
+    ASSERT_FALSE(load_snapshot(snapshot, 42));
+}
+
+TEST_F(given_a_snapshot_file, content_hashes_depend_on_content)
+{
+    const auto lhs = content_hash(sample("sample_graph_1.json"));
+    const auto rhs = content_hash(sample("sample_graph_2.json"));
+
+    ASSERT_EQ(lhs, content_hash(sample("sample_graph_1.json")));
+    ASSERT_NE(lhs, rhs);
+}
+
+TEST_F(given_a_snapshot_file, cached_deserialization_writes_then_reads_it)
+{
+    const auto json = sample("sample_graph_2.json");
+    const auto expected = deserialize_sample("sample_graph_2.json");
+
+    expect_identical(deserialize_cached(json, snapshot, 2), expected);
+    ASSERT_TRUE(load_snapshot(snapshot, content_hash(json)));
+    expect_identical(deserialize_cached(json, snapshot, 2), expected);
+}
+
+} // namespace
@@ -8,6 +8,8 @@ using namespace testing;
 
 namespace arch = architecture;
 
+using id_type = arch::vertex_marker::id_type;
+
 namespace
 {
 
@@ -32,32 +34,40 @@ TEST_F(a_new_vertex_marker, doesnt_mark_vertex)
     EXPECT_FALSE(marker->marks("ClassA"));
 }
 
+TEST_F(a_new_vertex_marker, doesnt_intern_the_queried_ids)
+{
+    const auto size = id_type::table().size();
+
+    EXPECT_FALSE(marker->marks("vertex_marker_tests_unknown"));
+    EXPECT_EQ(id_type::table().size(), size);
+}
+
 TEST_F(a_new_vertex_marker, has_one_marked_vertex_after_mark)
 {
-    marker->mark("ClassA", arch::graph::vertex_descriptor());
+    marker->mark(id_type("ClassA"), arch::graph::vertex_descriptor());
 
     EXPECT_EQ(marker->num_marked(), 1);
 }
 
 TEST_F(a_new_vertex_marker, after_mark_vertex_is_marked)
 {
-    marker->mark("ClassA", arch::graph::vertex_descriptor());
+    marker->mark(id_type("ClassA"), arch::graph::vertex_descriptor());
 
     EXPECT_TRUE(marker->marks("ClassA"));
 }
 
 TEST_F(a_new_vertex_marker, after_two_marks_has_two_marked_vertices)
 {
-    marker->mark("ClassA", arch::graph::vertex_descriptor());
-    marker->mark("ClassB", arch::graph::vertex_descriptor());
+    marker->mark(id_type("ClassA"), arch::graph::vertex_descriptor());
+    marker->mark(id_type("ClassB"), arch::graph::vertex_descriptor());
 
     EXPECT_EQ(marker->num_marked(), 2);
 }
 
 TEST_F(a_new_vertex_marker, after_two_marks_both_vertices_are_marked)
 {
-    marker->mark("ClassA", arch::graph::vertex_descriptor());
-    marker->mark("ClassB", arch::graph::vertex_descriptor());
+    marker->mark(id_type("ClassA"), arch::graph::vertex_descriptor());
+    marker->mark(id_type("ClassB"), arch::graph::vertex_descriptor());
 
     EXPECT_TRUE(marker->marks("ClassA"));
     EXPECT_TRUE(marker->marks("ClassB"));
@@ -67,9 +77,9 @@ TEST_F(a_new_vertex_marker, after_marks_vertices_can_be_accessed)
 {
     arch::graph::vertex_descriptor v0 { 0 }, v1 { 1 }, v2 { 2 };
 
-    marker->mark("0", v0);
-    marker->mark("1", v1);
-    marker->mark("2", v2);
+    marker->mark(id_type("0"), v0);
+    marker->mark(id_type("1"), v1);
+    marker->mark(id_type("2"), v2);
 
     EXPECT_EQ(marker->vertex("0"), v0);
     EXPECT_EQ(marker->vertex("1"), v1);
@@ -119,6 +119,25 @@ TEST(
         clustering::invalid_snn_threshold);
 }
 
+TEST(
+    when_making_a_clustering_backend,
+    given_mce_time_limit_of_0_at_cfg_then_invalid_mce_time_limit_error_is_thrown)
+{
+    EXPECT_THROW(
+        clustering::make_backend(
+            graph(),
+            weight_map(10),
+            clustering::backend_config {
+                .clusterers = all_clusterers(),
+                .mst_finders = all_mst_finders(),
+                .clusterer = to_id(clustering::k_spanning_tree_clusterer_id),
+                .mst_finder = to_id(clustering::prim_mst_id),
+                .k = 2,
+                .snn_threshold = 1,
+                .mce_time_limit = 0 }),
+        clustering::invalid_mce_time_limit);
+}
+
 using backend_t = clustering::backend< graph, weight_map >;
 
 using mock_clusters_slot_t = NiceMock<
@@ -148,6 +167,21 @@ using mock_gamma_slot_t
 using mock_steps_slot_t
     = NiceMock< MockFunction< void(typename backend_t::steps_type) > >;
 
+using mock_resolution_slot_t
+    = NiceMock< MockFunction< void(typename backend_t::resolution_type) > >;
+
+using mock_iterations_slot_t
+    = NiceMock< MockFunction< void(typename backend_t::iterations_type) > >;
+
+using mock_clique_size_slot_t
+    = NiceMock< MockFunction< void(typename backend_t::clique_size_type) > >;
+
+using mock_clique_count_slot_t
+    = NiceMock< MockFunction< void(typename backend_t::clique_count_type) > >;
+
+using mock_seconds_slot_t
+    = NiceMock< MockFunction< void(typename backend_t::seconds_type) > >;
+
 class given_a_clustering_backend : public Test
 {
 protected:
@@ -162,6 +196,11 @@ protected:
     static constexpr auto default_min_q = 0.5f;
     static constexpr auto default_llp_gamma = 0.0f;
     static constexpr auto default_llp_steps = 1;
+    static constexpr auto default_leiden_resolution = 1.0f;
+    static constexpr auto default_leiden_iterations = 2;
+    static constexpr auto default_mce_min_clique_size = 2;
+    static constexpr auto default_mce_max_cliques = 100000;
+    static constexpr auto default_mce_time_limit = 10.0f;
 
     static constexpr auto weight = 10;
 
@@ -178,6 +217,11 @@ protected:
     mock_modularity_slot_t modularity_slot;
     mock_gamma_slot_t gamma_slot;
     mock_steps_slot_t steps_slot;
+    mock_resolution_slot_t resolution_slot;
+    mock_iterations_slot_t iterations_slot;
+    mock_clique_size_slot_t clique_size_slot;
+    mock_clique_count_slot_t clique_count_slot;
+    mock_seconds_slot_t seconds_slot;
 
     void SetUp() override
     {
@@ -505,6 +549,168 @@ TEST_F(
     clustering::update_llp_steps(*backend, steps);
 }
 
+TEST_F(
+    given_a_clustering_backend,
+    after_updating_the_leiden_resolution_new_val_is_held)
+{
+    constexpr auto resolution = 0.5f;
+
+    clustering::update_leiden_resolution(*backend, resolution);
+
+    ASSERT_EQ(clustering::get_leiden_resolution(*backend), resolution);
+}
+
+TEST_F(
+    given_a_clustering_backend,
+    when_updating_the_leiden_resolution_observers_are_notified)
+{
+    constexpr auto resolution = 0.5f;
+
+    backend->connect_to_leiden_resolution(resolution_slot.AsStdFunction());
+
+    EXPECT_CALL(resolution_slot, Call(resolution)).Times(1);
+
+    clustering::update_leiden_resolution(*backend, resolution);
+}
+
+TEST_F(
+    given_a_clustering_backend,
+    after_updating_the_leiden_iterations_new_val_is_held)
+{
+    constexpr auto iterations = 5;
+
+    clustering::update_leiden_iterations(*backend, iterations);
+
+    ASSERT_EQ(clustering::get_leiden_iterations(*backend), iterations);
+}
+
+TEST_F(
+    given_a_clustering_backend,
+    when_updating_the_leiden_iterations_observers_are_notified)
+{
+    constexpr auto iterations = 5;
+
+    backend->connect_to_leiden_iterations(iterations_slot.AsStdFunction());
+
+    EXPECT_CALL(iterations_slot, Call(iterations)).Times(1);
+
+    clustering::update_leiden_iterations(*backend, iterations);
+}
+
+TEST_F(
+    given_a_clustering_backend,
+    after_updating_the_mce_min_clique_size_new_val_is_held)
+{
+    constexpr auto n = 4;
+
+    clustering::update_mce_min_clique_size(*backend, n);
+
+    ASSERT_EQ(clustering::get_mce_min_clique_size(*backend), n);
+}
+
+TEST_F(
+    given_a_clustering_backend,
+    when_updating_the_mce_min_clique_size_observers_are_notified)
+{
+    constexpr auto n = 4;
+
+    backend->connect_to_mce_min_clique_size(clique_size_slot.AsStdFunction());
+
+    EXPECT_CALL(clique_size_slot, Call(n)).Times(1);
+
+    clustering::update_mce_min_clique_size(*backend, n);
+}
+
+TEST_F(
+    given_a_clustering_backend,
+    when_updating_the_mce_min_clique_size_with_invalid_value_nothing_happens)
+{
+    backend->connect_to_mce_min_clique_size(clique_size_slot.AsStdFunction());
+
+    EXPECT_CALL(clique_size_slot, Call(_)).Times(0);
+
+    clustering::update_mce_min_clique_size(*backend, 0);
+
+    ASSERT_EQ(
+        clustering::get_mce_min_clique_size(*backend),
+        default_mce_min_clique_size);
+}
+
+TEST_F(
+    given_a_clustering_backend,
+    after_updating_the_mce_max_cliques_new_val_is_held)
+{
+    constexpr auto n = 30;
+
+    clustering::update_mce_max_cliques(*backend, n);
+
+    ASSERT_EQ(clustering::get_mce_max_cliques(*backend), n);
+}
+
+TEST_F(
+    given_a_clustering_backend,
+    when_updating_the_mce_max_cliques_observers_are_notified)
+{
+    constexpr auto n = 30;
+
+    backend->connect_to_mce_max_cliques(clique_count_slot.AsStdFunction());
+
+    EXPECT_CALL(clique_count_slot, Call(n)).Times(1);
+
+    clustering::update_mce_max_cliques(*backend, n);
+}
+
+TEST_F(
+    given_a_clustering_backend,
+    when_updating_the_mce_max_cliques_with_invalid_value_nothing_happens)
+{
+    backend->connect_to_mce_max_cliques(clique_count_slot.AsStdFunction());
+
+    EXPECT_CALL(clique_count_slot, Call(_)).Times(0);
+
+    clustering::update_mce_max_cliques(*backend, -3);
+
+    ASSERT_EQ(
+        clustering::get_mce_max_cliques(*backend), default_mce_max_cliques);
+}
+
+TEST_F(
+    given_a_clustering_backend,
+    after_updating_the_mce_time_limit_new_val_is_held)
+{
+    constexpr auto secs = 0.5f;
+
+    clustering::update_mce_time_limit(*backend, secs);
+
+    ASSERT_EQ(clustering::get_mce_time_limit(*backend), secs);
+}
+
+TEST_F(
+    given_a_clustering_backend,
+    when_updating_the_mce_time_limit_observers_are_notified)
+{
+    constexpr auto secs = 0.5f;
+
+    backend->connect_to_mce_time_limit(seconds_slot.AsStdFunction());
+
+    EXPECT_CALL(seconds_slot, Call(secs)).Times(1);
+
+    clustering::update_mce_time_limit(*backend, secs);
+}
+
+TEST_F(
+    given_a_clustering_backend,
+    when_updating_the_mce_time_limit_with_invalid_value_nothing_happens)
+{
+    backend->connect_to_mce_time_limit(seconds_slot.AsStdFunction());
+
+    EXPECT_CALL(seconds_slot, Call(_)).Times(0);
+
+    clustering::update_mce_time_limit(*backend, -1);
+
+    ASSERT_EQ(clustering::get_mce_time_limit(*backend), default_mce_time_limit);
+}
+
 TEST_F(
     given_a_clustering_backend,
     when_restoring_to_defaults_default_data_are_given_after_querying)
@@ -515,6 +721,11 @@ TEST_F(
     constexpr auto q = 0.3f;
     constexpr auto gamma = 0.34f;
     constexpr auto steps = 999;
+    constexpr auto resolution = 0.25f;
+    constexpr auto iterations = 7;
+    constexpr auto min_clique_size = 5;
+    constexpr auto max_cliques = 12;
+    constexpr auto time_limit = 0.75f;
     constexpr auto intensity = 999.0;
 
     static_assert(id != defualt_mst_finder);
@@ -523,6 +734,11 @@ TEST_F(
     static_assert(q != default_min_q);
     static_assert(gamma != default_llp_gamma);
     static_assert(steps != default_llp_steps);
+    static_assert(resolution != default_leiden_resolution);
+    static_assert(iterations != default_leiden_iterations);
+    static_assert(min_clique_size != default_mce_min_clique_size);
+    static_assert(max_cliques != default_mce_max_cliques);
+    static_assert(time_limit != default_mce_time_limit);
     static_assert(intensity != default_intensity);
 
     clustering::update_intensity(*backend, intensity);
@@ -532,6 +748,11 @@ TEST_F(
     clustering::update_min_modularity(*backend, q);
     clustering::update_llp_gamma(*backend, gamma);
     clustering::update_llp_steps(*backend, steps);
+    clustering::update_leiden_resolution(*backend, resolution);
+    clustering::update_leiden_iterations(*backend, iterations);
+    clustering::update_mce_min_clique_size(*backend, min_clique_size);
+    clustering::update_mce_max_cliques(*backend, max_cliques);
+    clustering::update_mce_time_limit(*backend, time_limit);
 
     EXPECT_EQ(clustering::get_intensity(*backend), intensity);
     EXPECT_EQ(clustering::get_k(*backend), k);
@@ -540,6 +761,11 @@ TEST_F(
     EXPECT_EQ(clustering::get_min_modularity(*backend), q);
     EXPECT_EQ(clustering::get_llp_gamma(*backend), gamma);
     EXPECT_EQ(clustering::get_llp_steps(*backend), steps);
+    EXPECT_EQ(clustering::get_leiden_resolution(*backend), resolution);
+    EXPECT_EQ(clustering::get_leiden_iterations(*backend), iterations);
+    EXPECT_EQ(clustering::get_mce_min_clique_size(*backend), min_clique_size);
+    EXPECT_EQ(clustering::get_mce_max_cliques(*backend), max_cliques);
+    EXPECT_EQ(clustering::get_mce_time_limit(*backend), time_limit);
 
     clustering::restore_defaults(*backend);
 
@@ -551,6 +777,18 @@ TEST_F(
     ASSERT_EQ(clustering::get_min_modularity(*backend), default_min_q);
     ASSERT_EQ(clustering::get_llp_gamma(*backend), default_llp_gamma);
     ASSERT_EQ(clustering::get_llp_steps(*backend), default_llp_steps);
+    ASSERT_EQ(
+        clustering::get_leiden_resolution(*backend),
+        default_leiden_resolution);
+    ASSERT_EQ(
+        clustering::get_leiden_iterations(*backend),
+        default_leiden_iterations);
+    ASSERT_EQ(
+        clustering::get_mce_min_clique_size(*backend),
+        default_mce_min_clique_size);
+    ASSERT_EQ(
+        clustering::get_mce_max_cliques(*backend), default_mce_max_cliques);
+    ASSERT_EQ(clustering::get_mce_time_limit(*backend), default_mce_time_limit);
 }
 
 TEST_F(
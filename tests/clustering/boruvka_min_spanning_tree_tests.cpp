@@ -0,0 +1,146 @@
+#include "clustering/boruvka_min_spanning_tree.hpp"
+
+#include <boost/graph/kruskal_min_spanning_tree.hpp>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace testing;
+
+namespace
+{
+
+namespace impl = clustering::boruvka_detail;
+
+using graph = boost::
+    adjacency_list< boost::vecS, boost::vecS, boost::undirectedS, int, int >;
+
+using weight_map
+    = decltype(boost::get(boost::edge_bundle, std::declval< graph >()));
+
+using mst_finder = clustering::boruvka_min_spanning_tree< graph, weight_map >;
+using spanning_tree = mst_finder::spanning_tree;
+
+auto make_random_graph(int num_vertices, int num_edges, unsigned seed) -> graph
+{
+    auto g = graph();
+    auto rng = std::mt19937(seed);
+
+    for (auto i = 0; i < num_vertices; ++i)
+        boost::add_vertex(i, g);
+
+    for (auto i = 0; i < num_edges; ++i)
+        boost::add_edge(
+            rng() % num_vertices, rng() % num_vertices, rng() % 10, g);
+
+    return g;
+}
+
+auto total_weight(const graph& g, const spanning_tree& tree) -> int
+{
+    auto res = 0;
+    for (auto e : tree)
+        res += g[e];
+    return res;
+}
+
+auto kruskal(const graph& g) -> spanning_tree
+{
+    auto res = spanning_tree();
+    boost::kruskal_minimum_spanning_tree(
+        g,
+        std::back_inserter(res),
+        boost::weight_map(boost::get(boost::edge_bundle, g)));
+    return res;
+}
+
+auto boruvka(const graph& g) -> spanning_tree
+{
+    auto res = spanning_tree();
+    mst_finder()(g, std::back_inserter(res), boost::get(boost::edge_bundle, g));
+    return res;
+}
+
+TEST(boruvka_min_spanning_tree_tests, empty_graph_yields_empty_tree)
+{
+    EXPECT_TRUE(boruvka(graph()).empty());
+}
+
+TEST(boruvka_min_spanning_tree_tests, spans_a_small_graph)
+{
+    auto g = graph();
+    const auto v1 = boost::add_vertex(1, g);
+    const auto v2 = boost::add_vertex(2, g);
+    const auto v3 = boost::add_vertex(3, g);
+    const auto v4 = boost::add_vertex(4, g);
+    boost::add_edge(v1, v2, 7, g);
+    boost::add_edge(v1, v3, 2, g);
+    boost::add_edge(v2, v3, 3, g);
+    boost::add_edge(v3, v4, 2, g);
+    boost::add_edge(v1, v4, 4, g);
+
+    const auto tree = boruvka(g);
+
+    ASSERT_EQ(tree.size(), 3);
+    EXPECT_EQ(total_weight(g, tree), 7);
+}
+
+TEST(boruvka_min_spanning_tree_tests, spans_each_component_of_a_forest)
+{
+    auto g = graph();
+    for (auto i = 0; i < 5; ++i)
+        boost::add_vertex(i, g);
+    boost::add_edge(0, 1, 1, g);
+    boost::add_edge(1, 0, 2, g);
+    boost::add_edge(2, 3, 1, g);
+    boost::add_edge(3, 3, 0, g);
+
+    const auto tree = boruvka(g);
+
+    ASSERT_EQ(tree.size(), 2);
+    EXPECT_EQ(total_weight(g, tree), 2);
+}
+
+TEST(boruvka_min_spanning_tree_tests, weighs_as_much_as_kruskal)
+{
+    for (auto seed = 0u; seed < 10; ++seed)
+    {
+        const auto g = make_random_graph(200, 600, seed);
+
+        const auto expected = kruskal(g);
+        const auto actual = boruvka(g);
+
+        EXPECT_EQ(actual.size(), expected.size());
+        EXPECT_EQ(total_weight(g, actual), total_weight(g, expected));
+    }
+}
+
+TEST(boruvka_detail_tests, forest_does_not_depend_on_the_number_of_threads)
+{
+    const auto g = make_random_graph(2000, 8000, 42);
+    auto descriptors = std::vector< graph::edge_descriptor >();
+    const auto edges = impl::make_edge_list(
+        g, boost::get(boost::edge_bundle, g), descriptors);
+
+    const auto expected = impl::minimum_spanning_forest(edges, 2000, 1);
+
+    for (auto num_threads : { 2u, 3u, 8u })
+        EXPECT_EQ(
+            impl::minimum_spanning_forest(edges, 2000, num_threads), expected);
+}
+
+TEST(boruvka_detail_tests, filter_keeps_the_order)
+{
+    auto from = std::vector< std::size_t >(100);
+    std::iota(std::begin(from), std::end(from), 0);
+    auto to = std::vector< std::size_t >();
+
+    impl::parallel_filter(from, to, [](auto i) { return i % 3 == 0; }, 4);
+
+    ASSERT_EQ(to.size(), 34);
+    for (std::size_t i = 0; i < to.size(); ++i)
+        EXPECT_EQ(to[i], 3 * i);
+}
+
+} // namespace
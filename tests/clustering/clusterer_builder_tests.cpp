@@ -117,13 +117,23 @@ TEST_F(
         = clustering::maximal_clique_enumeration_clusterer< graph >;
 
     constexpr auto id = clustering::max_clique_enum_clusterer_id;
+    constexpr auto min_clique_size = 3;
+    constexpr auto max_cliques = 40;
+    constexpr auto time_limit = 1.5f;
     static_assert(clustering::is_clusterer_plugged_in(id));
 
-    const auto clusterer = builder->result(id);
+    const auto clusterer = builder->set_mce_min_clique_size(min_clique_size)
+                               .set_mce_max_cliques(max_cliques)
+                               .set_mce_time_limit(time_limit)
+                               .result(id);
 
     ASSERT_NE(clusterer, nullptr);
     EXPECT_EQ(clusterer->id(), id);
     ASSERT_EQ(typeid(*clusterer), typeid(expected_t));
+    const auto& downcasted = static_cast< const expected_t& >(*clusterer);
+    ASSERT_EQ(downcasted.min_clique_size(), min_clique_size);
+    ASSERT_EQ(downcasted.max_cliques(), max_cliques);
+    ASSERT_EQ(downcasted.time_limit(), time_limit);
 }
 
 TEST_F(
@@ -185,4 +195,66 @@ TEST_F(
     ASSERT_EQ(typeid(*clusterer), typeid(expected_t));
 }
 
+TEST_F(
+    clustering_cluster_builder_tests,
+    given_leiden_clusterer_id_returns_appropriate_implementation)
+{
+    using expected_t = clustering::leiden_clusterer< graph, weight_map >;
+
+    constexpr auto id = clustering::leiden_clusterer_id;
+    constexpr auto resolution = 0.5f;
+    constexpr auto iterations = 4;
+    static_assert(clustering::is_clusterer_plugged_in(id));
+
+    const auto clusterer = builder->set_leiden_resolution(resolution)
+                               .set_leiden_iterations(iterations)
+                               .result(id);
+
+    ASSERT_NE(clusterer, nullptr);
+    EXPECT_EQ(clusterer->id(), id);
+    ASSERT_EQ(typeid(*clusterer), typeid(expected_t));
+    const auto& downcasted = static_cast< const expected_t& >(*clusterer);
+    ASSERT_EQ(downcasted.resolution(), resolution);
+    ASSERT_EQ(downcasted.iterations(), iterations);
+}
+
+TEST_F(clustering_cluster_builder_tests, the_seed_is_set_to_random_clusterers)
+{
+    using louvain_t = clustering::louvain_method_clusterer< graph, weight_map >;
+    using llp_t
+        = clustering::layered_label_propagation_clusterer< graph, weight_map >;
+    using leiden_t = clustering::leiden_clusterer< graph, weight_map >;
+
+    builder->set_seed(42);
+
+    const auto* louvain = static_cast< const louvain_t* >(
+        builder->result(clustering::louvain_method_clusterer_id));
+    const auto* llp = static_cast< const llp_t* >(
+        builder->result(clustering::llp_clusterer_id));
+    const auto* leiden = static_cast< const leiden_t* >(
+        builder->result(clustering::leiden_clusterer_id));
+
+    EXPECT_EQ(builder->seed(), 42);
+    EXPECT_EQ(louvain->seed(), 42);
+    EXPECT_EQ(llp->seed(), 42);
+    ASSERT_EQ(leiden->seed(), 42);
+}
+
+TEST_F(clustering_cluster_builder_tests, seeded_clusterers_are_reproducible)
+{
+    for (auto i = 0; i < 30; ++i)
+        boost::add_edge(i, (i * 7 + 3) % 30, g);
+
+    builder->set_seed(42);
+
+    for (auto id : { clustering::louvain_method_clusterer_id,
+                     clustering::llp_clusterer_id,
+                     clustering::leiden_clusterer_id })
+    {
+        const auto* clusterer = builder->result(id);
+
+        ASSERT_EQ((*clusterer)(g), (*clusterer)(g));
+    }
+}
+
 } // namespace
\ No newline at end of file
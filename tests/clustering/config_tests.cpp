@@ -23,7 +23,13 @@ inline auto make_sample_0() -> config_data
                          .snn_threshold = 9,
                          .min_modularity = 22,
                          .llp_gamma = 0.12,
-                         .llp_steps = 3 };
+                         .llp_steps = 3,
+                         .leiden_resolution = 0.5,
+                         .leiden_iterations = 4,
+                         .mce_min_clique_size = 3,
+                         .mce_max_cliques = 500,
+                         .mce_time_limit = 2.5,
+                         .seed = 7 };
 }
 
 TEST(clustering_config_tests, clustering_sample_0)
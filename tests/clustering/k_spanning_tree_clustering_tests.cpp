@@ -177,4 +177,37 @@ TEST(k_spanning_tree_clustering_tests, clustering_sample_with_prim_mst)
     EXPECT_NE(clusters.at(vertices.at(2)), clusters.at(vertices.at(5)));
 }
 
+TEST(k_spanning_tree_clustering_tests, remaining_trees_share_cluster_0)
+{
+    auto g = graph();
+    auto v0 = boost::add_vertex(0, g);
+    auto v1 = boost::add_vertex(1, g);
+    auto v2 = boost::add_vertex(2, g);
+    auto v3 = boost::add_vertex(3, g);
+    auto v4 = boost::add_vertex(4, g);
+    boost::add_edge(v0, v1, 1, g);
+    boost::add_edge(v1, v2, 5, g);
+    boost::add_edge(v2, v3, 1, g);
+    const auto k = 2;
+    auto clusters = cluster_map();
+
+    clustering::k_spanning_tree_clustering(
+        g,
+        k,
+        [](const auto& g, auto out, auto edge_weight)
+        {
+            boost::kruskal_minimum_spanning_tree(
+                g, out, boost::weight_map(edge_weight));
+        },
+        boost::get(boost::edge_bundle, g),
+        boost::make_assoc_property_map(clusters));
+
+    ASSERT_EQ(clusters.size(), 5);
+    EXPECT_EQ(clusters.at(v0), 0);
+    EXPECT_EQ(clusters.at(v1), 0);
+    EXPECT_EQ(clusters.at(v2), 0);
+    EXPECT_EQ(clusters.at(v3), 0);
+    EXPECT_EQ(clusters.at(v4), 1);
+}
+
 } // namespace
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include "clustering/layered_label_propagation_clustering.hpp"
 
 #include <gtest/gtest.h>
+#include <utility>
+#include <vector>
 
 using namespace testing;
 
@@ -18,189 +20,197 @@ using cluster_map = std::unordered_map< graph::vertex_descriptor, cluster >;
 using weight_map
     = decltype(boost::get(boost::edge_bundle, std::declval< graph >()));
 
-using network = impl::network_properties< graph::vertex_descriptor, cluster >;
-
-TEST(
-    llp_detail_tests, max_value_keys_of_single_value_map_returns_range_with_key)
+// Three 5-cliques, joined in a ring by single edges.
+auto make_three_cliques() -> graph
 {
-    using assoc_container = std::unordered_map< int, int >;
+    auto g = graph();
 
-    const assoc_container map { { 1, 2 } };
+    for (auto i = 0; i < 15; ++i)
+        boost::add_vertex(i, g);
 
-    EXPECT_TRUE(std::ranges::equal(
-        impl::max_value_keys(map), std::ranges::views::single(1)));
+    for (auto first : { 0, 5, 10 })
+        for (auto i = first; i < first + 5; ++i)
+            for (auto j = i + 1; j < first + 5; ++j)
+                boost::add_edge(i, j, 1, g);
+
+    boost::add_edge(4, 5, 1, g);
+    boost::add_edge(9, 10, 1, g);
+    boost::add_edge(14, 0, 1, g);
+    return g;
 }
 
-TEST(llp_detail_tests, max_value_keys_of_map_returns_key_with_max_value)
+auto expect_three_cliques(const cluster_map& clusters) -> void
 {
-    using assoc_container = std::unordered_map< int, int >;
-    using container = std::vector< int >;
+    ASSERT_EQ(clusters.size(), 15);
 
-    const assoc_container map { { 1, 2 }, { 0, 20 } };
-    const container expected { 0 };
+    for (auto first : { 0, 5, 10 })
+        for (auto u = first + 1; u < first + 5; ++u)
+            EXPECT_EQ(clusters.at(u), clusters.at(first));
 
-    EXPECT_TRUE(std::ranges::equal(
-        impl::max_value_keys(map), std::ranges::views::all(expected)));
+    EXPECT_NE(clusters.at(0), clusters.at(5));
+    EXPECT_NE(clusters.at(5), clusters.at(10));
+    EXPECT_NE(clusters.at(10), clusters.at(0));
 }
 
-TEST(llp_detail_tests, max_value_keys_of_map_returns_keys_with_max_value)
+// v0 is linked to v1, v4 (community 0) and v2, v3 (community 3).
+auto make_star() -> graph
 {
-    using assoc_container = std::unordered_map< int, int >;
-    using container = std::vector< int >;
-
-    const assoc_container map { { 1, 2 }, { 0, 20 }, { 14, 20 } };
-    const container expected { 0, 14 };
+    auto g = graph();
+    for (auto i = 0; i < 5; ++i)
+        boost::add_vertex(i, g);
+
+    boost::add_edge(0, 1, 1, g);
+    boost::add_edge(0, 4, 1, g);
+    boost::add_edge(0, 2, 1, g);
+    boost::add_edge(0, 3, 1, g);
+    return g;
+}
 
-    EXPECT_TRUE(std::ranges::equal(
-        impl::max_value_keys(map), std::ranges::views::all(expected)));
+auto make_star_communities() -> impl::communities
+{
+    auto coms = impl::make_singletons(5);
+    impl::move_vertex(coms, 1, 0);
+    impl::move_vertex(coms, 4, 0);
+    impl::move_vertex(coms, 2, 3);
+    return coms;
 }
 
-TEST(
-    llp_detail_tests,
-    network_status_factory_of_empty_graph_returns_empty_storage)
+TEST(llp_detail_tests, network_of_empty_graph_is_empty)
 {
-    auto net = impl::network_status< network >(graph());
+    const auto net = impl::make_network(graph(), weight_map());
 
-    EXPECT_EQ(net.vertex_community.size(), 0);
+    EXPECT_EQ(net.num_vertices(), 0);
+    EXPECT_TRUE(net.neighbours.empty());
 }
 
-TEST(llp_detail_tests, network_status_factory_isolates_each_vertex)
+TEST(llp_detail_tests, network_holds_the_weighted_out_edges)
 {
     auto g = graph();
-    auto v0 = boost::add_vertex(g);
-    auto v1 = boost::add_vertex(g);
-    auto v2 = boost::add_vertex(g);
+    boost::add_vertex(0, g);
+    boost::add_vertex(1, g);
+    boost::add_vertex(2, g);
+    boost::add_edge(0, 1, 2, g);
+    boost::add_edge(0, 2, 3, g);
+
+    const auto net = impl::make_network(g, weight_map());
+
+    ASSERT_EQ(net.num_vertices(), 3);
+    ASSERT_EQ(net.neighbours_of(0).size(), 2);
+    EXPECT_EQ(net.neighbours_of(0)[0], std::pair(std::size_t(1), 2.0));
+    EXPECT_EQ(net.neighbours_of(0)[1], std::pair(std::size_t(2), 3.0));
+    ASSERT_EQ(net.neighbours_of(1).size(), 1);
+    EXPECT_EQ(net.neighbours_of(1)[0], std::pair(std::size_t(0), 2.0));
+    ASSERT_EQ(net.neighbours_of(2).size(), 1);
+    EXPECT_EQ(net.neighbours_of(2)[0], std::pair(std::size_t(0), 3.0));
+}
 
-    auto net = impl::network_status< network >(g);
+TEST(llp_detail_tests, singletons_isolate_each_vertex)
+{
+    const auto coms = impl::make_singletons(3);
 
-    EXPECT_EQ(net.vertex_community.at(v0), 0);
-    EXPECT_EQ(net.vertex_community.at(v1), 1);
-    EXPECT_EQ(net.vertex_community.at(v2), 2);
+    EXPECT_EQ(coms.of_vertex, (std::vector< std::size_t > { 0, 1, 2 }));
+    EXPECT_EQ(coms.size, (std::vector< std::size_t > { 1, 1, 1 }));
 }
 
-TEST(llp_detail_tests, community_num_members)
+TEST(llp_detail_tests, moving_a_vertex_updates_the_community_sizes)
 {
-    auto g = graph();
-    auto v0 = boost::add_vertex(g);
-    auto v1 = boost::add_vertex(g);
-    auto v2 = boost::add_vertex(g);
-    auto net = network();
-    net.vertex_community[v0] = 0;
-    net.vertex_community[v1] = 0;
-    net.vertex_community[v2] = 3;
-
-    auto counter = impl::community_num_members(net.vertex_community);
-
-    EXPECT_EQ(counter.at(0), 2);
-    EXPECT_EQ(counter.at(3), 1);
+    auto coms = impl::make_singletons(3);
+
+    impl::move_vertex(coms, 0, 2);
+    impl::move_vertex(coms, 1, 2);
+
+    EXPECT_EQ(coms.of_vertex, (std::vector< std::size_t > { 2, 2, 2 }));
+    EXPECT_EQ(coms.size, (std::vector< std::size_t > { 0, 0, 3 }));
 }
 
-TEST(llp_detail_tests, a_community_of_an_isolated_vertex_doesnt_dominate)
+TEST(llp_detail_tests, renumbering_orders_the_communities_by_appearance)
 {
-    auto g = graph();
-    auto v0 = boost::add_vertex(g);
-    auto v1 = boost::add_vertex(g);
-    auto v2 = boost::add_vertex(g);
-    boost::add_edge(v0, v1, g);
-    auto net = network();
-    net.vertex_community[v0] = 0;
-    net.vertex_community[v1] = 0;
-    net.vertex_community[v2] = 3;
-
-    EXPECT_FALSE(impl::dominates(v2, g, net, weight_map(), 10.0f));
+    auto of_vertex = std::vector< std::size_t > { 4, 2, 4, 0, 2 };
+
+    const auto num = impl::renumber_communities(of_vertex);
+
+    EXPECT_EQ(num, 3);
+    EXPECT_EQ(of_vertex, (std::vector< std::size_t > { 0, 1, 0, 2, 1 }));
 }
 
-TEST(
-    llp_detail_tests,
-    a_community_of_a_vertex_dominates_if_the_number_of_its_members_is_the_max_number)
+TEST(llp_detail_tests, neighbour_communities_are_scored_by_gamma)
 {
-    auto g = graph();
-    auto v0 = boost::add_vertex(g);
-    auto v1 = boost::add_vertex(g);
-    auto v2 = boost::add_vertex(g);
-    boost::add_edge(v0, v1, g);
-    boost::add_edge(v0, v2, g);
-    auto net = network();
-    net.vertex_community[v0] = 0;
-    net.vertex_community[v1] = 0;
-    net.vertex_community[v2] = 3;
-
-    EXPECT_TRUE(impl::dominates(v0, g, net, weight_map(), 0.0f));
-    EXPECT_TRUE(impl::dominates(v1, g, net, weight_map(), 10.0f));
+    const auto g = make_star();
+    const auto net = impl::make_network(g, weight_map());
+    const auto coms = make_star_communities();
+    auto scores = std::vector< impl::network::neighbour >();
+
+    impl::neighbour_communities(net, coms, 0, 1.0f, scores);
+
+    // Community 0 has 3 members, community 3 has 2.
+    ASSERT_EQ(scores.size(), 2);
+    EXPECT_EQ(scores[0], std::pair(std::size_t(0), 2.0 - (3.0 - 2.0)));
+    EXPECT_EQ(scores[1], std::pair(std::size_t(3), 2.0 - (2.0 - 2.0)));
 }
 
-TEST(
-    llp_detail_tests,
-    a_community_of_a_vertex_doesnt_dominate_if_the_number_of_its_members_is_not_the_max_number)
+TEST(llp_detail_tests, a_vertex_without_neighbours_stays_in_its_community)
 {
-    auto g = graph();
-    auto v0 = boost::add_vertex(g);
-    auto v1 = boost::add_vertex(g);
-    auto v2 = boost::add_vertex(g);
-    boost::add_edge(v0, v1, g);
-    boost::add_edge(v0, v2, g);
-    auto net = network();
-    net.vertex_community[v0] = 0;
-    net.vertex_community[v1] = 0;
-    net.vertex_community[v2] = 3;
-
-    EXPECT_FALSE(impl::dominates(v2, g, net, weight_map(), 0.0f));
+    auto g = make_star();
+    boost::add_vertex(5, g);
+    const auto net = impl::make_network(g, weight_map());
+    const auto coms = impl::make_singletons(6);
+    auto scratch = std::vector< impl::network::neighbour >();
+
+    EXPECT_EQ(
+        impl::dominant_community(
+            net, coms, 5, 0.0f, [](auto) { return 0; }, scratch),
+        5);
 }
 
-TEST(
-    llp_detail_tests,
-    dominant_community_given_mock_ugenerator_and_unlinked_vertex_is_nil)
+TEST(llp_detail_tests, a_vertex_stays_in_its_community_if_it_dominates)
 {
-    auto g = graph();
-    auto v0 = boost::add_vertex(g);
-    auto v1 = boost::add_vertex(g);
-    auto v2 = boost::add_vertex(g);
-    boost::add_edge(v0, v1, g);
-    auto net = network();
-    net.vertex_community[v0] = 0;
-    net.vertex_community[v1] = 0;
-    net.vertex_community[v2] = 3;
+    const auto g = make_star();
+    const auto net = impl::make_network(g, weight_map());
+    const auto coms = make_star_communities();
+    auto scratch = std::vector< impl::network::neighbour >();
 
     EXPECT_EQ(
         impl::dominant_community(
-            v2, g, net, weight_map(), 0.0f, [](auto, auto) { return 0; }),
-        impl::community_traits< cluster >::nil());
+            net, coms, 1, 10.0f, [](auto) { return 0; }, scratch),
+        0);
 }
 
-TEST(
-    llp_detail_tests,
-    dominant_community_given_mock_ugenerator_and_linked_vertex_returns_generated_community)
+TEST(llp_detail_tests, a_vertex_moves_to_the_picked_dominant_community)
 {
-    auto g = graph();
-    auto v0 = boost::add_vertex(g);
-    auto v1 = boost::add_vertex(g);
-    auto v2 = boost::add_vertex(g);
-    auto v3 = boost::add_vertex(g);
-    auto v4 = boost::add_vertex(g);
-    boost::add_edge(v0, v1, g);
-    boost::add_edge(v0, v4, g);
-    boost::add_edge(v0, v2, g);
-    boost::add_edge(v0, v3, g);
-    auto net = network();
-    net.vertex_community[v0] = 0;
-    net.vertex_community[v1] = 0;
-    net.vertex_community[v2] = 3;
-    net.vertex_community[v3] = 3;
-    net.vertex_community[v4] = 0;
+    const auto g = make_star();
+    const auto net = impl::make_network(g, weight_map());
+    const auto coms = make_star_communities();
+    auto scratch = std::vector< impl::network::neighbour >();
 
     EXPECT_EQ(
         impl::dominant_community(
-            v0, g, net, weight_map(), 0.0f, [](auto, auto) { return 0; }),
+            net, coms, 2, 0.0f, [](auto) { return 0; }, scratch),
         0);
 
     EXPECT_EQ(
         impl::dominant_community(
-            v2, g, net, weight_map(), 0.0f, [](auto, auto) { return 0; }),
+            net, coms, 0, 1.0f, [](auto) { return 0; }, scratch),
+        3);
+}
+
+TEST(llp_detail_tests, dominant_communities_are_picked_in_order)
+{
+    auto g = make_star();
+    boost::add_vertex(5, g);
+    boost::add_edge(5, 1, 1, g);
+    boost::add_edge(5, 2, 1, g);
+    const auto net = impl::make_network(g, weight_map());
+    const auto coms = make_star_communities();
+    auto scratch = std::vector< impl::network::neighbour >();
+
+    EXPECT_EQ(
+        impl::dominant_community(
+            net, coms, 5, 0.0f, [](auto) { return 0; }, scratch),
         0);
 
     EXPECT_EQ(
         impl::dominant_community(
-            v0, g, net, weight_map(), 0.0f, [](auto, auto) { return 1; }),
+            net, coms, 5, 0.0f, [](auto) { return 1; }, scratch),
         3);
 }
 
@@ -257,4 +267,139 @@ TEST(layered_label_propagation_clustering_tests, proof_of_concept)
     ASSERT_EQ(clusters.size(), 4);
 }
 
+TEST(layered_label_propagation_clustering_tests, cliques_are_clustered_apart)
+{
+    const auto g = make_three_cliques();
+    auto clusters = cluster_map();
+    auto rng = std::mt19937(42);
+
+    clustering::layered_label_propagation_clustering(
+        g,
+        weight_map(),
+        0.0f,
+        20,
+        boost::make_assoc_property_map(clusters),
+        [&rng](std::size_t min, std::size_t max)
+        { return misc::urandom_from(rng, min, max); },
+        rng);
+
+    expect_three_cliques(clusters);
+}
+
+TEST(layered_label_propagation_clustering_tests, is_reproducible_from_the_rng)
+{
+    const auto g = make_three_cliques();
+    auto clusters1 = cluster_map();
+    auto clusters2 = cluster_map();
+    auto rng1 = std::mt19937(7);
+    auto rng2 = std::mt19937(7);
+
+    clustering::layered_label_propagation_clustering(
+        g,
+        weight_map(),
+        0.5f,
+        20,
+        boost::make_assoc_property_map(clusters1),
+        [&rng1](std::size_t min, std::size_t max)
+        { return misc::urandom_from(rng1, min, max); },
+        rng1);
+
+    clustering::layered_label_propagation_clustering(
+        g,
+        weight_map(),
+        0.5f,
+        20,
+        boost::make_assoc_property_map(clusters2),
+        [&rng2](std::size_t min, std::size_t max)
+        { return misc::urandom_from(rng2, min, max); },
+        rng2);
+
+    EXPECT_EQ(clusters1, clusters2);
+}
+
+TEST(
+    parallel_layered_label_propagation_clustering_tests,
+    given_empty_graph_cluster_map_is_empty)
+{
+    cluster_map map;
+
+    clustering::parallel_layered_label_propagation_clustering(
+        graph(), weight_map(), 0.0f, 1, boost::make_assoc_property_map(map));
+
+    EXPECT_EQ(map.size(), 0);
+}
+
+TEST(
+    parallel_layered_label_propagation_clustering_tests,
+    given_graph_with_no_edges_then_cluster_map_isolates_each)
+{
+    graph g;
+    auto v0 = boost::add_vertex(0, g);
+    auto v1 = boost::add_vertex(0, g);
+    auto v2 = boost::add_vertex(0, g);
+    cluster_map map;
+
+    clustering::parallel_layered_label_propagation_clustering(
+        g, weight_map(), 0.0f, 1, boost::make_assoc_property_map(map));
+
+    ASSERT_EQ(map.size(), 3);
+    EXPECT_EQ(map.at(v0), 0);
+    EXPECT_EQ(map.at(v1), 1);
+    EXPECT_EQ(map.at(v2), 2);
+}
+
+TEST(
+    parallel_layered_label_propagation_clustering_tests,
+    cliques_are_clustered_apart)
+{
+    const auto g = make_three_cliques();
+    auto clusters = cluster_map();
+    auto rng = std::mt19937(42);
+
+    clustering::parallel_layered_label_propagation_clustering(
+        g,
+        weight_map(),
+        0.0f,
+        20,
+        boost::make_assoc_property_map(clusters),
+        [&rng](std::size_t min, std::size_t max)
+        { return misc::urandom_from(rng, min, max); },
+        rng);
+
+    expect_three_cliques(clusters);
+}
+
+TEST(
+    parallel_layered_label_propagation_clustering_tests,
+    is_reproducible_from_the_rng)
+{
+    const auto g = make_three_cliques();
+    auto clusters1 = cluster_map();
+    auto clusters2 = cluster_map();
+    auto rng1 = std::mt19937(7);
+    auto rng2 = std::mt19937(7);
+
+    clustering::parallel_layered_label_propagation_clustering(
+        g,
+        weight_map(),
+        0.5f,
+        20,
+        boost::make_assoc_property_map(clusters1),
+        [&rng1](std::size_t min, std::size_t max)
+        { return misc::urandom_from(rng1, min, max); },
+        rng1);
+
+    clustering::parallel_layered_label_propagation_clustering(
+        g,
+        weight_map(),
+        0.5f,
+        20,
+        boost::make_assoc_property_map(clusters2),
+        [&rng2](std::size_t min, std::size_t max)
+        { return misc::urandom_from(rng2, min, max); },
+        rng2);
+
+    EXPECT_EQ(clusters1, clusters2);
+}
+
 } // namespace
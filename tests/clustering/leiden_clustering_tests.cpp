@@ -0,0 +1,248 @@
+#include "clustering/leiden_clustering.hpp"
+
+#include <gtest/gtest.h>
+#include <set>
+#include <vector>
+
+using namespace testing;
+
+namespace
+{
+
+namespace impl = clustering::leiden_detail;
+
+using graph = boost::
+    adjacency_list< boost::vecS, boost::vecS, boost::undirectedS, int, int >;
+
+using directed_graph = boost::
+    adjacency_list< boost::vecS, boost::vecS, boost::directedS, int, int >;
+
+using cluster = int;
+using cluster_map = std::unordered_map< graph::vertex_descriptor, cluster >;
+
+using weight_map
+    = decltype(boost::get(boost::edge_bundle, std::declval< graph >()));
+
+using directed_weight_map = decltype(boost::get(
+    boost::edge_bundle,
+    std::declval< directed_graph >()));
+
+// Three 5-cliques, joined in a ring by single edges.
+template < typename Graph >
+auto make_three_cliques() -> Graph
+{
+    auto g = Graph();
+
+    for (auto i = 0; i < 15; ++i)
+        boost::add_vertex(i, g);
+
+    for (auto first : { 0, 5, 10 })
+        for (auto i = first; i < first + 5; ++i)
+            for (auto j = i + 1; j < first + 5; ++j)
+                boost::add_edge(i, j, 1, g);
+
+    boost::add_edge(4, 5, 1, g);
+    boost::add_edge(9, 10, 1, g);
+    boost::add_edge(14, 0, 1, g);
+    return g;
+}
+
+auto expect_three_cliques(const cluster_map& clusters) -> void
+{
+    ASSERT_EQ(clusters.size(), 15);
+
+    for (auto first : { 0, 5, 10 })
+        for (auto u = first + 1; u < first + 5; ++u)
+            EXPECT_EQ(clusters.at(u), clusters.at(first));
+
+    EXPECT_NE(clusters.at(0), clusters.at(5));
+    EXPECT_NE(clusters.at(5), clusters.at(10));
+    EXPECT_NE(clusters.at(10), clusters.at(0));
+}
+
+TEST(leiden_detail_tests, communities_hold_the_strengths_of_their_vertices)
+{
+    const auto g = make_three_cliques< graph >();
+    const auto net = clustering::louvain_detail::make_network(g, weight_map());
+
+    auto of_vertex = std::vector< std::size_t >(15, 0);
+    of_vertex[14] = 1;
+
+    const auto coms = impl::make_communities(net, of_vertex);
+
+    EXPECT_EQ(coms.size[0], 14);
+    EXPECT_EQ(coms.size[1], 1);
+    EXPECT_EQ(coms.size[2], 0);
+    EXPECT_EQ(coms.out_strength[1], net.out_strength[14]);
+    EXPECT_EQ(coms.in_strength[1], net.in_strength[14]);
+    EXPECT_EQ(coms.out_strength[0] + coms.out_strength[1], net.total);
+}
+
+TEST(leiden_detail_tests, refined_sub_communities_are_connected)
+{
+    const auto g = make_three_cliques< graph >();
+    const auto net = clustering::louvain_detail::make_network(g, weight_map());
+    const auto coms
+        = impl::make_communities(net, std::vector< std::size_t >(15, 0));
+    auto rng = std::mt19937(42);
+
+    const auto refined = impl::refine(net, coms, 1.0, rng);
+
+    ASSERT_EQ(refined.size(), 15);
+    EXPECT_LT(std::set(std::begin(refined), std::end(refined)).size(), 15);
+
+    // Floods each sub-community from its first member.
+    for (std::size_t first = 0; first < 15; ++first)
+    {
+        auto reached = std::set< std::size_t > { first };
+        auto frontier = std::vector< std::size_t > { first };
+
+        while (!frontier.empty())
+        {
+            const auto u = frontier.back();
+            frontier.pop_back();
+
+            for (auto v :
+                 boost::make_iterator_range(boost::adjacent_vertices(u, g)))
+                if (refined[v] == refined[first] and reached.insert(v).second)
+                    frontier.push_back(v);
+        }
+
+        for (std::size_t u = 0; u < 15; ++u)
+            EXPECT_EQ(refined[u] == refined[first], reached.contains(u));
+    }
+}
+
+TEST(leiden_detail_tests, refinement_keeps_sub_communities_within_communities)
+{
+    const auto g = make_three_cliques< graph >();
+    const auto net = clustering::louvain_detail::make_network(g, weight_map());
+    auto of_vertex = std::vector< std::size_t >(15);
+    for (std::size_t u = 0; u < 15; ++u)
+        of_vertex[u] = u % 2;
+    const auto coms = impl::make_communities(net, of_vertex);
+    auto rng = std::mt19937(42);
+
+    const auto refined = impl::refine(net, coms, 1.0, rng);
+
+    for (std::size_t u = 0; u < 15; ++u)
+        EXPECT_EQ(of_vertex[refined[u]], of_vertex[u]);
+}
+
+TEST(leiden_clustering_tests, given_0_vertices_then_0_clusters)
+{
+    auto g = graph();
+    auto clusters = cluster_map();
+
+    clustering::leiden_clustering(
+        g, weight_map(), boost::make_assoc_property_map(clusters));
+
+    ASSERT_EQ(clusters.size(), 0);
+}
+
+TEST(leiden_clustering_tests, given_0_edges_then_vertices_are_isolated)
+{
+    auto g = graph();
+    const auto v0 = boost::add_vertex(0, g);
+    const auto v1 = boost::add_vertex(1, g);
+    const auto v2 = boost::add_vertex(2, g);
+    auto clusters = cluster_map();
+
+    clustering::leiden_clustering(
+        g, weight_map(), boost::make_assoc_property_map(clusters));
+
+    ASSERT_EQ(clusters.size(), 3);
+    EXPECT_EQ(clusters.at(v0), 0);
+    EXPECT_EQ(clusters.at(v1), 1);
+    EXPECT_EQ(clusters.at(v2), 2);
+}
+
+TEST(leiden_clustering_tests, given_0_iterations_then_vertices_are_isolated)
+{
+    const auto g = make_three_cliques< graph >();
+    auto clusters = cluster_map();
+
+    clustering::leiden_clustering(
+        g, weight_map(), boost::make_assoc_property_map(clusters), 1.0f, 0);
+
+    ASSERT_EQ(clusters.size(), 15);
+    for (auto u = 0; u < 15; ++u)
+        EXPECT_EQ(clusters.at(u), u);
+}
+
+TEST(leiden_clustering_tests, cliques_are_clustered_apart)
+{
+    const auto g = make_three_cliques< graph >();
+    auto clusters = cluster_map();
+
+    clustering::leiden_clustering(
+        g, weight_map(), boost::make_assoc_property_map(clusters));
+
+    expect_three_cliques(clusters);
+}
+
+TEST(leiden_clustering_tests, directed_cliques_are_clustered_apart)
+{
+    const auto g = make_three_cliques< directed_graph >();
+    auto clusters = cluster_map();
+
+    clustering::leiden_clustering(
+        g, directed_weight_map(), boost::make_assoc_property_map(clusters));
+
+    expect_three_cliques(clusters);
+}
+
+TEST(leiden_clustering_tests, low_resolution_merges_the_cliques)
+{
+    const auto g = make_three_cliques< graph >();
+    auto clusters = cluster_map();
+
+    clustering::leiden_clustering(
+        g, weight_map(), boost::make_assoc_property_map(clusters), 0.0f);
+
+    ASSERT_EQ(clusters.size(), 15);
+    for (auto u = 1; u < 15; ++u)
+        EXPECT_EQ(clusters.at(u), clusters.at(0));
+}
+
+TEST(leiden_clustering_tests, high_resolution_splits_the_cliques)
+{
+    const auto g = make_three_cliques< graph >();
+    auto clusters = cluster_map();
+
+    clustering::leiden_clustering(
+        g, weight_map(), boost::make_assoc_property_map(clusters), 100.0f);
+
+    ASSERT_EQ(clusters.size(), 15);
+    for (auto u = 0; u < 15; ++u)
+        EXPECT_EQ(clusters.at(u), u);
+}
+
+TEST(leiden_clustering_tests, is_reproducible_from_the_rng)
+{
+    const auto g = make_three_cliques< graph >();
+    auto clusters1 = cluster_map();
+    auto clusters2 = cluster_map();
+    auto rng1 = std::mt19937(7);
+    auto rng2 = std::mt19937(7);
+
+    clustering::leiden_clustering(
+        g,
+        weight_map(),
+        boost::make_assoc_property_map(clusters1),
+        1.0f,
+        2,
+        rng1);
+
+    clustering::leiden_clustering(
+        g,
+        weight_map(),
+        boost::make_assoc_property_map(clusters2),
+        1.0f,
+        2,
+        rng2);
+
+    EXPECT_EQ(clusters1, clusters2);
+}
+
+} // namespace
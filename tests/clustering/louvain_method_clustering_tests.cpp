@@ -19,574 +19,256 @@ using cluster_map = std::unordered_map< graph::vertex_descriptor, cluster >;
 using weight_map
     = decltype(boost::get(boost::edge_bundle, std::declval< graph >()));
 
-TEST(
-    louvain_method_details_tests,
-    weighted_degree_of_vertex_with_0_adj_edges_is_0)
-{
-    auto g = graph();
-    boost::add_vertex(0, g);
-    const auto v1 = boost::add_vertex(1, g);
+using directed_graph = boost::
+    adjacency_list< boost::vecS, boost::vecS, boost::directedS, int, int >;
 
-    ASSERT_EQ(impl::weighted_degree(v1, g, weight_map()), 0);
-}
+using directed_weight_map = decltype(boost::get(
+    boost::edge_bundle,
+    std::declval< directed_graph >()));
 
-TEST(
-    louvain_method_details_tests,
-    weighted_degree_of_vertex_with_1_adj_edge_of_weight_3_is_3)
+// Two 5-cliques, joined by a single edge.
+template < typename Graph >
+auto make_two_cliques() -> Graph
 {
-    auto g = graph();
-    const auto v0 = boost::add_vertex(0, g);
-    const auto v1 = boost::add_vertex(1, g);
-    boost::add_edge(v0, v1, 3, g);
+    auto g = Graph();
 
-    ASSERT_EQ(impl::weighted_degree(v1, g, weight_map()), 3);
-    ASSERT_EQ(impl::weighted_degree(v0, g, weight_map()), 3);
-}
+    for (auto i = 0; i < 10; ++i)
+        boost::add_vertex(i, g);
 
-TEST(
-    louvain_method_details_tests,
-    weighted_degree_of_vertex_with_5_adj_edges_of_weight_2_is_10)
-{
-    auto g = graph();
-    const auto v0 = boost::add_vertex(0, g);
-    const auto v1 = boost::add_vertex(1, g);
-    boost::add_edge(v0, v1, 2, g);
-    boost::add_edge(v0, v1, 2, g);
-    boost::add_edge(v0, v1, 2, g);
-    boost::add_edge(v0, v1, 2, g);
-    boost::add_edge(v0, v1, 2, g);
+    for (auto first : { 0, 5 })
+        for (auto i = first; i < first + 5; ++i)
+            for (auto j = i + 1; j < first + 5; ++j)
+                boost::add_edge(i, j, 1, g);
 
-    ASSERT_EQ(impl::weighted_degree(v1, g, weight_map()), 10);
-    ASSERT_EQ(impl::weighted_degree(v0, g, weight_map()), 10);
+    boost::add_edge(4, 5, 1, g);
+    return g;
 }
 
-TEST(
-    louvain_method_details_tests,
-    weighted_degree_of_vertex_with_1_adj_edge_of_weight_5_to_itself_is_10)
+auto weight_between(const impl::network& net, std::size_t u, std::size_t v)
+    -> double
 {
-    auto g = graph();
-    const auto v0 = boost::add_vertex(0, g);
-    boost::add_edge(v0, v0, 5, g);
-
-    ASSERT_EQ(impl::weighted_degree(v0, g, weight_map()), 10);
+    for (const auto& [w, weight] : net.neighbours_of(u))
+        if (w == v)
+            return weight;
+    return 0;
 }
 
-TEST(louvain_method_details_tests, weight_sum_of_graph_with_0_edges_is_0)
+TEST(louvain_method_details_tests, network_of_graph_with_0_edges_is_empty)
 {
     auto g = graph();
+    boost::add_vertex(0, g);
+    boost::add_vertex(1, g);
+
+    const auto net = impl::make_network(g, weight_map());
 
-    ASSERT_EQ(impl::weight_sum(g, weight_map()), 0);
+    ASSERT_EQ(net.num_vertices(), 2);
+    EXPECT_TRUE(net.neighbours.empty());
+    EXPECT_EQ(net.total, 0);
 }
 
-TEST(
-    louvain_method_details_tests,
-    weight_sum_of_graph_with_5_edges_of_2_weight_is_10)
+TEST(louvain_method_details_tests, undirected_edges_count_in_both_directions)
 {
     auto g = graph();
     const auto v0 = boost::add_vertex(0, g);
     const auto v1 = boost::add_vertex(1, g);
-    boost::add_edge(v0, v1, 2, g);
-    boost::add_edge(v0, v1, 2, g);
-    boost::add_edge(v0, v1, 2, g);
-    boost::add_edge(v0, v1, 2, g);
-    boost::add_edge(v0, v1, 2, g);
-
-    ASSERT_EQ(impl::weight_sum(g, weight_map()), 10);
-}
-
-TEST(
-    louvain_method_details_tests, community_advance_increments_community_by_one)
-{
-    cluster i = 0;
-    impl::community_advance(i);
-    EXPECT_EQ(i, 1);
-}
-
-using network
-    = impl::network_properties< graph::vertex_descriptor, int, cluster >;
-
-TEST(
-    louvain_method_details_tests,
-    network_status_of_empty_graphleaves_as_with_empty_status)
-{
-    using impl::network_status;
+    boost::add_edge(v0, v1, 3, g);
 
-    auto g = graph();
-    auto status = network();
+    const auto net = impl::make_network(g, weight_map());
 
-    EXPECT_EQ(network_status< network >(g, weight_map()), network());
+    EXPECT_EQ(net.total, 6);
+    EXPECT_EQ(net.out_strength[0], 3);
+    EXPECT_EQ(net.in_strength[0], 3);
+    EXPECT_EQ(net.out_strength[1], 3);
+    EXPECT_EQ(net.in_strength[1], 3);
+    EXPECT_EQ(weight_between(net, 0, 1), 6);
+    EXPECT_EQ(weight_between(net, 1, 0), 6);
 }
 
-TEST(
-    louvain_method_details_tests,
-    network_status_of_graph_puts_each_vertex_into_a_different_community)
+TEST(louvain_method_details_tests, undirected_loops_count_twice)
 {
-    using impl::network_status;
-
     auto g = graph();
     const auto v0 = boost::add_vertex(0, g);
-    const auto v1 = boost::add_vertex(1, g);
-    const auto v2 = boost::add_vertex(1, g);
-    const auto v3 = boost::add_vertex(1, g);
-    boost::add_edge(v0, v1, 2, g);
-    boost::add_edge(v0, v2, 2, g);
-    boost::add_edge(v0, v1, 2, g);
-    boost::add_edge(v0, v1, 2, g);
-    boost::add_edge(v3, v1, 2, g);
+    boost::add_edge(v0, v0, 2, g);
 
-    auto status = network_status< network >(g, weight_map());
+    const auto net = impl::make_network(g, weight_map());
 
-    ASSERT_EQ(status.vertex_community.size(), 4);
-    EXPECT_EQ(status.vertex_community.at(v0), 0);
-    EXPECT_EQ(status.vertex_community.at(v1), 1);
-    EXPECT_EQ(status.vertex_community.at(v2), 2);
-    EXPECT_EQ(status.vertex_community.at(v3), 3);
+    EXPECT_EQ(net.total, 4);
+    EXPECT_EQ(net.loops[0], 4);
+    EXPECT_TRUE(net.neighbours_of(0).empty());
 }
 
-TEST(
-    louvain_method_details_tests,
-    network_status_of_graph_maps_each_community_with_each_vertex_weighted_degree)
+TEST(louvain_method_details_tests, directed_edges_count_once)
 {
-    using impl::network_status;
-
-    auto g = graph();
+    auto g = directed_graph();
     const auto v0 = boost::add_vertex(0, g);
     const auto v1 = boost::add_vertex(1, g);
-    boost::add_vertex(1, g);
-    boost::add_vertex(1, g);
-    boost::add_edge(v0, v1, 2, g);
+    boost::add_edge(v0, v1, 3, g);
 
-    auto status = network_status< network >(g, weight_map());
+    const auto net = impl::make_network(g, directed_weight_map());
 
-    ASSERT_EQ(status.community_incident.size(), 4);
-    EXPECT_EQ(status.community_incident.at(0), 2);
-    EXPECT_EQ(status.community_incident.at(1), 2);
-    EXPECT_EQ(status.community_incident.at(2), 0);
-    EXPECT_EQ(status.community_incident.at(3), 0);
+    EXPECT_EQ(net.total, 3);
+    EXPECT_EQ(net.out_strength[0], 3);
+    EXPECT_EQ(net.in_strength[0], 0);
+    EXPECT_EQ(net.out_strength[1], 0);
+    EXPECT_EQ(net.in_strength[1], 3);
+    EXPECT_EQ(weight_between(net, 0, 1), 3);
+    EXPECT_EQ(weight_between(net, 1, 0), 3);
 }
 
-TEST(
-    louvain_method_details_tests,
-    network_status_of_graph_maps_each_vertex_with_its_weighted_degree)
+TEST(louvain_method_details_tests, opposite_directed_edges_are_merged)
 {
-    using impl::network_status;
-
-    auto g = graph();
+    auto g = directed_graph();
     const auto v0 = boost::add_vertex(0, g);
     const auto v1 = boost::add_vertex(1, g);
-    const auto v2 = boost::add_vertex(1, g);
-    const auto v3 = boost::add_vertex(1, g);
-    boost::add_edge(v0, v1, 2, g);
-    boost::add_edge(v2, v1, 20, g);
+    boost::add_edge(v0, v1, 3, g);
+    boost::add_edge(v1, v0, 4, g);
+    boost::add_edge(v0, v1, 1, g);
 
-    auto status = network_status< network >(g, weight_map());
+    const auto net = impl::make_network(g, directed_weight_map());
 
-    ASSERT_EQ(status.vertex_incident.size(), 4);
-    EXPECT_EQ(status.vertex_incident.at(v0), 2);
-    EXPECT_EQ(status.vertex_incident.at(v1), 22);
-    EXPECT_EQ(status.vertex_incident.at(v2), 20);
-    EXPECT_EQ(status.vertex_incident.at(v3), 0);
+    ASSERT_EQ(net.neighbours_of(0).size(), 1);
+    ASSERT_EQ(net.neighbours_of(1).size(), 1);
+    EXPECT_EQ(weight_between(net, 0, 1), 8);
+    EXPECT_EQ(weight_between(net, 1, 0), 8);
 }
 
-TEST(
-    louvain_method_details_tests,
-    network_status_of_graph_maps_each_vertex_with_its_loop_weight)
-{
-    using impl::network_status;
-
-    auto g = graph();
-    const auto v0 = boost::add_vertex(0, g);
-    const auto v1 = boost::add_vertex(1, g);
-    const auto v2 = boost::add_vertex(1, g);
-    const auto v3 = boost::add_vertex(1, g);
-    boost::add_edge(v0, v0, 69420, g);
-    boost::add_edge(v2, v1, 20, g);
-
-    auto status = network_status< network >(g, weight_map());
-
-    ASSERT_EQ(status.vertex_loop.size(), 4);
-    EXPECT_EQ(status.vertex_loop.at(v0), 69420);
-    EXPECT_EQ(status.vertex_loop.at(v1), 0);
-    EXPECT_EQ(status.vertex_loop.at(v2), 0);
-    EXPECT_EQ(status.vertex_loop.at(v3), 0);
-}
-
-TEST(
-    louvain_method_details_tests,
-    update_network_status_of_graph_maps_each_community_with_each_vertex_loop_weight)
+TEST(louvain_method_details_tests, modularity_of_empty_network_is_zero)
 {
-    using impl::network_status;
-
-    auto g = graph();
-    const auto v0 = boost::add_vertex(0, g);
-    const auto v1 = boost::add_vertex(1, g);
-    const auto v2 = boost::add_vertex(1, g);
-    boost::add_vertex(1, g);
-    boost::add_edge(v0, v0, 69420, g);
-    boost::add_edge(v2, v1, 20, g);
+    const auto net = impl::make_network(graph(), weight_map());
 
-    auto status = network_status< network >(g, weight_map());
-
-    ASSERT_EQ(status.community_internal.size(), 4);
-    EXPECT_EQ(status.community_internal.at(0), 69420);
-    EXPECT_EQ(status.community_internal.at(1), 0);
-    EXPECT_EQ(status.community_internal.at(2), 0);
-    EXPECT_EQ(status.community_internal.at(3), 0);
+    EXPECT_EQ(impl::modularity(net, impl::make_singletons(net)), 0);
 }
 
-TEST(
-    louvain_method_details_tests,
-    neighbor_communities_of_a_node_maps_each_neighbor_community_with_the_weighted_degree_of_the_links_of_the_node_towards_the_community)
+TEST(louvain_method_details_tests, modularity_of_split_edge_is_minus_half)
 {
-    using impl::neighbor_communities;
-
     auto g = graph();
     const auto v0 = boost::add_vertex(0, g);
     const auto v1 = boost::add_vertex(1, g);
-    const auto v2 = boost::add_vertex(2, g);
-    boost::add_edge(v0, v1, 3, g);
-    boost::add_edge(v0, v2, 6, g);
-
-    auto status = network();
-    status.vertex_community[v0] = 1;
-    status.vertex_community[v1] = 2;
-    status.vertex_community[v2] = 2;
+    boost::add_edge(v0, v1, 1, g);
 
-    const auto neighcom = neighbor_communities(v0, g, status, weight_map());
+    const auto net = impl::make_network(g, weight_map());
 
-    ASSERT_EQ(neighcom.size(), 1);
-    EXPECT_EQ(neighcom.at(2), 9);
+    EXPECT_DOUBLE_EQ(impl::modularity(net, impl::make_singletons(net)), -0.5);
 }
 
-TEST(
-    louvain_method_details_tests,
-    renumber_empty_communities_will_produce_empty_communities)
+TEST(louvain_method_details_tests, modularity_of_two_separate_edges_is_half)
 {
-    using impl::renumber_communities;
-
     auto g = graph();
-    auto status = network();
+    for (auto i = 0; i < 4; ++i)
+        boost::add_vertex(i, g);
+    boost::add_edge(0, 1, 1, g);
+    boost::add_edge(2, 3, 1, g);
 
-    const auto coms = renumber_communities(status.vertex_community);
+    const auto net = impl::make_network(g, weight_map());
+    auto coms = impl::make_singletons(net);
+    impl::move_vertex(net, coms, 1, 0);
+    impl::move_vertex(net, coms, 3, 2);
 
-    ASSERT_EQ(coms.size(), 0);
+    EXPECT_DOUBLE_EQ(impl::modularity(net, coms), 0.5);
 }
 
-TEST(
-    louvain_method_details_tests,
-    renumber_communities_will_produce_ordered_communities)
+TEST(louvain_method_details_tests, modularity_of_one_directed_community_is_zero)
 {
-    using impl::renumber_communities;
-
-    auto g = graph();
-    const auto v0 = boost::add_vertex(30, g);
-    const auto v1 = boost::add_vertex(145, g);
-    const auto v2 = boost::add_vertex(24, g);
-    const auto v3 = boost::add_vertex(20, g);
-
-    auto status = network();
-    status.vertex_community[v0] = 3;
-    status.vertex_community[v1] = 4;
-    status.vertex_community[v2] = 200;
-    status.vertex_community[v3] = 200;
-
-    const auto coms = renumber_communities(status.vertex_community);
-
-    ASSERT_EQ(coms.size(), 4);
-    EXPECT_EQ(coms.at(v0), 2);
-    EXPECT_EQ(coms.at(v1), 1);
-    EXPECT_EQ(coms.at(v2), 0);
-    EXPECT_EQ(coms.at(v3), 0);
-}
+    auto g = directed_graph();
+    for (auto i = 0; i < 3; ++i)
+        boost::add_vertex(i, g);
+    boost::add_edge(0, 1, 1, g);
+    boost::add_edge(1, 2, 2, g);
+    boost::add_edge(2, 0, 3, g);
 
-TEST(louvain_method_details_tests, modularity_of_empty_network_is_zero)
-{
-    using impl::modularity;
+    const auto net = impl::make_network(g, directed_weight_map());
+    auto coms = impl::make_singletons(net);
+    impl::move_vertex(net, coms, 1, 0);
+    impl::move_vertex(net, coms, 2, 0);
 
-    ASSERT_EQ(modularity< double >(network()), 0);
+    EXPECT_NEAR(impl::modularity(net, coms), 0, 1e-12);
 }
 
-TEST(louvain_method_details_tests, modularity_of_c)
+TEST(louvain_method_details_tests, moving_a_vertex_moves_its_strengths)
 {
-    using impl::modularity;
-
-    const double expected = -0.5;
-    network net;
-    net.total = 2;
-    net.community_incident[1] = 4;
-    net.community_internal[1] = 2;
+    const auto g = make_two_cliques< graph >();
+    const auto net = impl::make_network(g, weight_map());
+    auto coms = impl::make_singletons(net);
 
-    const auto actual = modularity< double >(net, 1);
+    impl::move_vertex(net, coms, 1, 0);
 
-    ASSERT_EQ(expected, actual);
+    EXPECT_EQ(coms.of_vertex[1], 0);
+    EXPECT_EQ(coms.size[0], 2);
+    EXPECT_EQ(coms.size[1], 0);
+    EXPECT_EQ(coms.out_strength[0], net.out_strength[0] + net.out_strength[1]);
+    EXPECT_EQ(coms.in_strength[1], 0);
 }
 
-TEST(louvain_method_details_tests, modularity_of_network_with_one_community)
+TEST(louvain_method_details_tests, best_community_of_clique_vertex_is_clique)
 {
-    using impl::modularity;
+    const auto g = make_two_cliques< graph >();
+    const auto net = impl::make_network(g, weight_map());
+    auto coms = impl::make_singletons(net);
+    auto scratch = std::vector< impl::network::neighbour >();
 
-    const double expected = -0.5;
-    network net;
-    net.total = 2;
-    net.vertex_community[0] = 1;
-    net.community_incident[1] = 4;
-    net.community_internal[1] = 2;
+    for (auto u : { 1, 2, 3 })
+        impl::move_vertex(net, coms, u, 0);
 
-    const auto actual = modularity< double >(net);
-
-    ASSERT_EQ(expected, actual);
+    EXPECT_EQ(impl::best_community(net, coms, 4, 1, scratch), 0);
+    EXPECT_EQ(impl::best_community(net, coms, 1, 1, scratch), 0);
 }
 
-TEST(louvain_method_details_tests, modularity_of_network_with_two_communities)
+TEST(louvain_method_details_tests, best_community_of_isolated_vertex_is_own)
 {
-    using impl::modularity;
-
-    const double expected = -1;
-    network net;
-    net.total = 2;
-    net.vertex_community[0] = 1;
-    net.community_incident[1] = 4;
-    net.community_internal[1] = 2;
-    net.vertex_community[1] = 2;
-    net.community_incident[2] = 4;
-    net.community_internal[2] = 2;
-
-    const auto actual = modularity< double >(net);
+    auto g = graph();
+    for (auto i = 0; i < 3; ++i)
+        boost::add_vertex(i, g);
+    boost::add_edge(0, 1, 1, g);
 
-    ASSERT_EQ(expected, actual);
-}
+    const auto net = impl::make_network(g, weight_map());
+    const auto coms = impl::make_singletons(net);
+    auto scratch = std::vector< impl::network::neighbour >();
 
-TEST(
-    louvain_method_details_tests,
-    delta_modularity_of_communities_with_same_modularity_is_zero)
-{
-    using impl::delta_modularity;
-    using impl::modularity;
-    using impl::neighbor_communities;
-
-    graph g;
-    const auto v0 = boost::add_vertex(g);
-    const auto v1 = boost::add_vertex(g);
-    boost::add_edge(v0, v1, 4, g);
-    network net;
-    net.total = 2;
-    net.vertex_community[0] = 1;
-    net.vertex_incident[0] = 4;
-    net.community_incident[1] = 4;
-    net.community_internal[1] = 0;
-    net.vertex_community[1] = 2;
-    net.vertex_incident[1] = 4;
-    net.community_incident[2] = 4;
-    net.community_internal[2] = 0;
-    const auto neighcom = neighbor_communities(0, g, net, weight_map());
-
-    EXPECT_EQ(modularity< double >(net, 1), modularity< double >(net, 2));
-
-    ASSERT_EQ(delta_modularity< double >(net, 0, neighcom, 2), 0);
+    EXPECT_EQ(impl::best_community(net, coms, 2, 1, scratch), 2);
 }
 
-TEST(
-    louvain_method_details_tests,
-    community_aggregation_yields_empty_graph_given_empty)
+TEST(louvain_method_details_tests, communities_are_renumbered_in_order)
 {
-    using impl::community_aggregation;
-    using vertex_community_storage
-        = std::unordered_map< graph::vertex_descriptor, cluster >;
+    auto coms = std::vector< std::size_t > { 4, 2, 4, 0, 2 };
 
-    graph g;
-    vertex_community_storage part;
-
-    const auto induced = community_aggregation(g, weight_map(), part);
-
-    EXPECT_TRUE(boost::isomorphism(induced.g, g));
-    EXPECT_EQ(induced.edge_weight.size(), 0);
+    EXPECT_EQ(impl::renumber_communities(coms), 3);
+    EXPECT_EQ(coms, (std::vector< std::size_t > { 0, 1, 0, 2, 1 }));
 }
 
-TEST(
-    louvain_method_details_tests,
-    community_aggregation_with_two_vertices_in_same_partition_and_no_edges_results_to_single_vertex_induced)
+TEST(louvain_method_details_tests, aggregation_preserves_modularity)
 {
-    using impl::community_aggregation;
-    using vertex_community_storage
-        = std::unordered_map< graph::vertex_descriptor, cluster >;
+    const auto g = make_two_cliques< graph >();
+    const auto net = impl::make_network(g, weight_map());
+    auto coms = impl::make_singletons(net);
 
-    graph g;
-    const auto v0 = boost::add_vertex(g);
-    const auto v1 = boost::add_vertex(g);
-    vertex_community_storage part { { v0, 0 }, { v1, 0 } };
+    for (auto u = 1; u < 5; ++u)
+        impl::move_vertex(net, coms, u, 0);
+    for (auto u = 6; u < 10; ++u)
+        impl::move_vertex(net, coms, u, 5);
 
-    const auto induced = community_aggregation(g, weight_map(), part);
+    const auto q = impl::modularity(net, coms);
+    const auto num = impl::renumber_communities(coms.of_vertex);
+    const auto sub = impl::aggregate(net, coms.of_vertex, num);
 
-    EXPECT_EQ(boost::num_vertices(induced.g), 1);
-    EXPECT_EQ(boost::num_edges(induced.g), 0);
-    EXPECT_EQ(induced.edge_weight.size(), 0);
-}
-
-TEST(
-    louvain_method_details_tests,
-    community_aggregation_with_two_vertices_in_same_partition_and_one_edge_results_to_single_vertex_and_edge_induced)
-{
-    using impl::community_aggregation;
-    using vertex_community_storage
-        = std::unordered_map< graph::vertex_descriptor, cluster >;
-
-    graph g;
-    const auto v0 = boost::add_vertex(g);
-    const auto v1 = boost::add_vertex(g);
-    boost::add_edge(v0, v1, 33, g);
-    vertex_community_storage part { { v0, 0 }, { v1, 0 } };
-
-    const auto induced = community_aggregation(g, weight_map(), part);
-
-    EXPECT_EQ(boost::num_vertices(induced.g), 1);
-    EXPECT_EQ(boost::num_edges(induced.g), 1);
-    ASSERT_EQ(induced.edge_weight.size(), 1);
-    ASSERT_TRUE(induced.edge_weight.contains(*boost::edges(induced.g).first));
-    EXPECT_EQ(induced.edge_weight.at(*boost::edges(induced.g).first), 33);
-    EXPECT_EQ(
-        boost::source(*boost::edges(induced.g).first, induced.g),
-        boost::target(*boost::edges(induced.g).first, induced.g));
+    ASSERT_EQ(sub.num_vertices(), 2);
+    EXPECT_EQ(sub.total, net.total);
+    EXPECT_EQ(sub.loops[0], 20);
+    EXPECT_EQ(weight_between(sub, 0, 1), 2);
+    EXPECT_DOUBLE_EQ(impl::modularity(sub, impl::make_singletons(sub)), q);
 }
 
-TEST(
-    louvain_method_details_tests,
-    community_aggregation_wraps_edges_within_community_to_one_self_loop_with_combined_weight)
+TEST(louvain_method_details_tests, moving_vertices_gains_modularity)
 {
-    using impl::community_aggregation;
-    using vertex_community_storage
-        = std::unordered_map< graph::vertex_descriptor, cluster >;
-
-    graph g;
-    const auto v0 = boost::add_vertex(g);
-    const auto v1 = boost::add_vertex(g);
-    const auto v2 = boost::add_vertex(g);
-    boost::add_edge(v0, v1, 33, g);
-    boost::add_edge(v0, v2, 22, g);
-    vertex_community_storage part { { v0, 0 }, { v1, 0 }, { v2, 0 } };
-
-    const auto induced = community_aggregation(g, weight_map(), part);
-
-    EXPECT_EQ(boost::num_vertices(induced.g), 1);
-    EXPECT_EQ(boost::num_edges(induced.g), 1);
-    ASSERT_EQ(induced.edge_weight.size(), 1);
-    ASSERT_TRUE(induced.edge_weight.contains(*boost::edges(induced.g).first));
-    EXPECT_EQ(induced.edge_weight.at(*boost::edges(induced.g).first), 55);
-    EXPECT_EQ(
-        boost::source(*boost::edges(induced.g).first, induced.g),
-        boost::target(*boost::edges(induced.g).first, induced.g));
-}
-
-TEST(
-    louvain_method_details_tests,
-    community_aggregation_with_two_vertices_in_different_partition_results_to_two_vertices_induced)
-{
-    using impl::community_aggregation;
-    using vertex_community_storage
-        = std::unordered_map< graph::vertex_descriptor, cluster >;
-
-    graph g;
-    const auto v0 = boost::add_vertex(g);
-    const auto v1 = boost::add_vertex(g);
-    vertex_community_storage part { { v0, 0 }, { v1, 1 } };
+    const auto g = make_two_cliques< graph >();
+    const auto net = impl::make_network(g, weight_map());
+    auto coms = impl::make_singletons(net);
+    auto rng = std::mt19937(42);
 
-    const auto induced = community_aggregation(g, weight_map(), part);
+    const auto before = impl::modularity(net, coms);
+    const auto gain = impl::move_vertices(net, coms, 0.0, 1.0, rng);
 
-    EXPECT_EQ(boost::num_vertices(induced.g), 2);
-    EXPECT_EQ(boost::num_edges(induced.g), 0);
-    ASSERT_EQ(induced.edge_weight.size(), 0);
-}
-
-TEST(
-    louvain_method_details_tests,
-    community_aggregation_with_two_communities_inter_community_edges_and_self_loops)
-{
-    using impl::community_aggregation;
-    using vertex_community_storage
-        = std::unordered_map< graph::vertex_descriptor, cluster >;
-
-    graph g;
-    const auto v0 = boost::add_vertex(g);
-    const auto v1 = boost::add_vertex(g);
-    const auto v2 = boost::add_vertex(g);
-    const auto v3 = boost::add_vertex(g);
-    boost::add_edge(v0, v1, 2, g);
-    boost::add_edge(v2, v3, 4, g);
-    boost::add_edge(v2, v0, 6, g);
-    vertex_community_storage part {
-        { v0, 0 }, { v1, 0 }, { v2, 1 }, { v3, 1 }
-    };
-
-    const auto induced = community_aggregation(g, weight_map(), part);
-
-    EXPECT_EQ(boost::num_vertices(induced.g), 2);
-    EXPECT_EQ(boost::num_edges(induced.g), 3);
-    ASSERT_EQ(induced.edge_weight.size(), 3);
-
-    const auto vv0 = 0;
-    const auto vv1 = 1;
-
-    const auto [ee0, ee0_ok] = boost::edge(vv0, vv0, induced.g);
-    ASSERT_TRUE(ee0_ok);
-    ASSERT_TRUE(induced.edge_weight.contains(ee0));
-    EXPECT_EQ(induced.edge_weight.at(ee0), 2);
-
-    const auto [ee1, ee1_ok] = boost::edge(vv1, vv1, induced.g);
-    ASSERT_TRUE(ee1_ok);
-    ASSERT_TRUE(induced.edge_weight.contains(ee1));
-    EXPECT_EQ(induced.edge_weight.at(ee1), 4);
-
-    const auto [ee2, ee2_ok] = boost::edge(vv1, vv0, induced.g);
-    ASSERT_TRUE(ee2_ok);
-    ASSERT_TRUE(induced.edge_weight.contains(ee2));
-    EXPECT_EQ(induced.edge_weight.at(ee2), 6);
-}
-
-TEST(
-    louvain_method_details_tests,
-    community_func_given_single_partition_dendrogram_yields_communities_from_partition)
-{
-    using vertex = graph::vertex_descriptor;
-    using vertex_community = std::unordered_map< vertex, cluster >;
-    using dendrogram = impl::dendrogram< vertex_community >;
-    using impl::community;
-
-    dendrogram parts { { { 0, 1 }, { 1, 4 }, { 5, 7 } } };
-
-    EXPECT_EQ(community(parts, 0), 1);
-    EXPECT_EQ(community(parts, 1), 4);
-    EXPECT_EQ(community(parts, 5), 7);
-}
-
-TEST(
-    louvain_method_details_tests,
-    community_func_given_two_partitions_dendrogram_yields_communities_from_optimized)
-{
-    using vertex = graph::vertex_descriptor;
-    using vertex_community = std::unordered_map< vertex, cluster >;
-    using dendrogram = impl::dendrogram< vertex_community >;
-    using impl::community;
-
-    dendrogram parts { { { 0, 1 }, { 1, 4 } }, { { 1, 2 }, { 4, 5 } } };
-
-    EXPECT_EQ(community(parts, 0), 2);
-    EXPECT_EQ(community(parts, 1), 5);
-}
-
-TEST(
-    louvain_method_details_tests,
-    community_func_given_three_partitions_dendrogram_yields_communities_from_optimized)
-{
-    using vertex = graph::vertex_descriptor;
-    using vertex_community = std::unordered_map< vertex, cluster >;
-    using dendrogram = impl::dendrogram< vertex_community >;
-    using impl::community;
-
-    dendrogram parts { { { 0, 1 }, { 1, 4 } },
-                       { { 1, 2 }, { 4, 5 } },
-                       { { 2, 0 }, { 5, 0 } } };
-
-    EXPECT_EQ(community(parts, 0), 0);
-    EXPECT_EQ(community(parts, 1), 0);
+    EXPECT_GT(gain, 0);
+    EXPECT_NEAR(impl::modularity(net, coms), before + gain, 1e-12);
 }
 
 TEST(louvain_method_clustering_tests, given_0_vertices_then_0_clusters)
@@ -640,4 +322,61 @@ TEST(louvain_method_clustering_tests, proof_of_concept)
     ASSERT_EQ(clusters.size(), 4);
 }
 
-} // namespace
\ No newline at end of file
+TEST(louvain_method_clustering_tests, cliques_are_clustered_apart)
+{
+    const auto g = make_two_cliques< graph >();
+    auto clusters = cluster_map();
+
+    clustering::louvain_method_clustering(
+        g, weight_map(), boost::make_assoc_property_map(clusters));
+
+    ASSERT_EQ(clusters.size(), 10);
+    for (auto u = 1; u < 5; ++u)
+        EXPECT_EQ(clusters.at(u), clusters.at(0));
+    for (auto u = 6; u < 10; ++u)
+        EXPECT_EQ(clusters.at(u), clusters.at(5));
+    EXPECT_NE(clusters.at(0), clusters.at(5));
+}
+
+TEST(louvain_method_clustering_tests, directed_cliques_are_clustered_apart)
+{
+    const auto g = make_two_cliques< directed_graph >();
+    auto clusters = cluster_map();
+
+    clustering::louvain_method_clustering(
+        g, directed_weight_map(), boost::make_assoc_property_map(clusters));
+
+    ASSERT_EQ(clusters.size(), 10);
+    for (auto u = 1; u < 5; ++u)
+        EXPECT_EQ(clusters.at(u), clusters.at(0));
+    for (auto u = 6; u < 10; ++u)
+        EXPECT_EQ(clusters.at(u), clusters.at(5));
+    EXPECT_NE(clusters.at(0), clusters.at(5));
+}
+
+TEST(louvain_method_clustering_tests, is_reproducible_from_the_rng)
+{
+    const auto g = make_two_cliques< graph >();
+    auto clusters1 = cluster_map();
+    auto clusters2 = cluster_map();
+    auto rng1 = std::mt19937(7);
+    auto rng2 = std::mt19937(7);
+
+    clustering::louvain_method_clustering(
+        g,
+        weight_map(),
+        boost::make_assoc_property_map(clusters1),
+        0.0f,
+        rng1);
+
+    clustering::louvain_method_clustering(
+        g,
+        weight_map(),
+        boost::make_assoc_property_map(clusters2),
+        0.0f,
+        rng2);
+
+    EXPECT_EQ(clusters1, clusters2);
+}
+
+} // namespace
@@ -1,9 +1,12 @@
 #include "clustering/maximal_clique_enumeration_clustering.hpp"
 #include "misc/random.hpp"
 
+#include <algorithm>
 #include <boost/graph/bron_kerbosch_all_cliques.hpp>
+#include <chrono>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <vector>
 
 using namespace testing;
 
@@ -154,4 +157,251 @@ TEST(maximal_clique_enumeration_tests, graph_cluster_analysis_example)
     EXPECT_NE(clusters.at(v4), clusters.at(v5));
 }
 
-} // namespace
\ No newline at end of file
+TEST(
+    maximal_clique_enumeration_tests,
+    bounded_graph_cluster_analysis_example)
+{
+    graph g;
+
+    auto v4 = boost::add_vertex(4, g);
+    auto v5 = boost::add_vertex(5, g);
+    auto v6 = boost::add_vertex(6, g);
+    auto v7 = boost::add_vertex(7, g);
+    auto v8 = boost::add_vertex(8, g);
+
+    boost::add_edge(v4, v7, g);
+    boost::add_edge(v4, v8, g);
+    boost::add_edge(v5, v6, g);
+    boost::add_edge(v5, v7, g);
+    boost::add_edge(v5, v8, g);
+    boost::add_edge(v6, v8, g);
+    boost::add_edge(v6, v7, g);
+    boost::add_edge(v7, v8, g);
+
+    cluster_map clusters;
+
+    clustering::maximal_clique_enumeration_clustering(
+        g, boost::make_assoc_property_map(clusters));
+
+    ASSERT_EQ(clusters.size(), 5);
+    EXPECT_EQ(clusters.at(v5), clusters.at(v6));
+    EXPECT_EQ(clusters.at(v6), clusters.at(v7));
+    EXPECT_EQ(clusters.at(v7), clusters.at(v8));
+    EXPECT_NE(clusters.at(v4), clusters.at(v5));
+}
+
+TEST(
+    maximal_clique_enumeration_tests,
+    given_cliques_smaller_than_the_min_size_then_all_vertices_are_isolated)
+{
+    graph g;
+    cluster_map clusters;
+
+    auto v1 = boost::add_vertex(1, g);
+    auto v2 = boost::add_vertex(2, g);
+    auto v3 = boost::add_vertex(3, g);
+
+    boost::add_edge(v1, v2, g);
+    boost::add_edge(v2, v3, g);
+    boost::add_edge(v1, v3, g);
+
+    clustering::maximal_clique_enumeration_clustering(
+        g, boost::make_assoc_property_map(clusters), 4);
+
+    ASSERT_EQ(clusters.size(), 3);
+    EXPECT_NE(clusters.at(v1), clusters.at(v2));
+    EXPECT_NE(clusters.at(v1), clusters.at(v3));
+    EXPECT_NE(clusters.at(v2), clusters.at(v3));
+}
+
+TEST(
+    maximal_clique_enumeration_tests,
+    directed_vertices_are_adjacent_only_if_connected_both_ways)
+{
+    using digraph = boost::adjacency_list<
+        boost::vecS,
+        boost::vecS,
+        boost::directedS,
+        int,
+        boost::no_property >;
+
+    digraph g;
+    auto clusters = std::unordered_map< digraph::vertex_descriptor, int >();
+
+    auto v1 = boost::add_vertex(1, g);
+    auto v2 = boost::add_vertex(2, g);
+    auto v3 = boost::add_vertex(3, g);
+
+    boost::add_edge(v1, v2, g);
+    boost::add_edge(v2, v1, g);
+    boost::add_edge(v2, v3, g);
+    boost::add_edge(v3, v1, g);
+
+    clustering::maximal_clique_enumeration_clustering(
+        g, boost::make_assoc_property_map(clusters));
+
+    ASSERT_EQ(clusters.size(), 3);
+    EXPECT_EQ(clusters.at(v1), clusters.at(v2));
+    EXPECT_NE(clusters.at(v1), clusters.at(v3));
+}
+
+namespace mce = clustering::mce_detail;
+
+auto random_graph(int num_vertices, int num_edges)
+{
+    graph g;
+
+    for (auto i = 0; i < num_vertices; ++i)
+        boost::add_vertex(i, g);
+
+    // Without self loops or parallel edges, for the boost visitor.
+    for (auto i = 0; i < num_edges; ++i)
+    {
+        const auto u = misc::urandom(0, num_vertices - 1);
+        const auto v = misc::urandom(0, num_vertices - 1);
+
+        if (u != v and !boost::edge(u, v, g).second)
+            boost::add_edge(u, v, g);
+    }
+
+    return g;
+}
+
+TEST(
+    maximal_clique_enumeration_tests,
+    degeneracy_order_has_at_most_degeneracy_later_neighbours)
+{
+    const auto g = random_graph(200, 800);
+    const auto net = mce::make_network(g);
+    const auto n = net.num_vertices();
+
+    // The degeneracy, by repeatedly removing a vertex of min degree.
+    auto degeneracy = std::size_t(0);
+    auto removed = std::vector< bool >(n, false);
+
+    const auto remaining_degree = [&](auto u)
+    {
+        const auto row = net.neighbours_of(u);
+        return static_cast< std::size_t >(std::count_if(
+            std::begin(row),
+            std::end(row),
+            [&](auto v) { return !removed[v]; }));
+    };
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        auto min = std::size_t(0);
+        for (std::size_t u = 0; u < n; ++u)
+            if (!removed[u]
+                and (removed[min]
+                     or remaining_degree(u) < remaining_degree(min)))
+                min = u;
+
+        degeneracy = std::max(degeneracy, remaining_degree(min));
+        removed[min] = true;
+    }
+
+    const auto order = mce::degeneracy_order(net);
+    ASSERT_EQ(order.size(), n);
+
+    auto position = std::vector< std::size_t >(n);
+    for (std::size_t i = 0; i < n; ++i)
+        position[order[i]] = i;
+
+    for (std::size_t u = 0; u < n; ++u)
+    {
+        const auto row = net.neighbours_of(u);
+        EXPECT_LE(
+            std::count_if(
+                std::begin(row),
+                std::end(row),
+                [&](auto v) { return position[v] > position[u]; }),
+            degeneracy);
+    }
+}
+
+TEST(
+    maximal_clique_enumeration_tests,
+    largest_cliques_match_bron_kerbosch_regardless_of_threads)
+{
+    const auto g = random_graph(400, 4000);
+    const auto net = mce::make_network(g);
+
+    auto expected = std::vector< std::vector< graph::vertex_descriptor > >();
+    boost::bron_kerbosch_all_cliques(
+        g, clustering::detail::largest_clique_recorder(expected));
+
+    for (auto& clique : expected)
+        std::sort(std::begin(clique), std::end(clique));
+    std::sort(std::begin(expected), std::end(expected));
+
+    const auto serial = mce::largest_cliques(net, mce::bounds(), 1);
+    const auto parallel = mce::largest_cliques(net, mce::bounds(), 4);
+
+    ASSERT_TRUE(serial.complete);
+    ASSERT_TRUE(parallel.complete);
+    EXPECT_EQ(serial.cliques, parallel.cliques);
+
+    auto actual = serial.cliques;
+    std::sort(std::begin(actual), std::end(actual));
+
+    ASSERT_EQ(actual.size(), expected.size());
+    for (std::size_t i = 0; i < actual.size(); ++i)
+        EXPECT_TRUE(std::equal(
+            std::begin(actual[i]),
+            std::end(actual[i]),
+            std::begin(expected[i]),
+            std::end(expected[i])));
+}
+
+TEST(maximal_clique_enumeration_tests, search_stops_at_max_cliques)
+{
+    const auto g = random_graph(1200, 12000);
+    const auto net = mce::make_network(g);
+
+    auto limits = mce::bounds();
+    limits.max_cliques = 1;
+
+    const auto found = mce::largest_cliques(net, limits, 1);
+
+    EXPECT_FALSE(found.complete);
+    EXPECT_EQ(found.cliques.size(), 1);
+}
+
+TEST(
+    maximal_clique_enumeration_tests,
+    search_stops_at_max_cliques_smaller_than_the_largest)
+{
+    // A wheel, whose maximal cliques are all triangles.
+    constexpr auto rim = 20;
+    auto g = graph(rim + 1);
+    for (auto i = 0; i < rim; ++i)
+    {
+        boost::add_edge(rim, i, g);
+        boost::add_edge(i, (i + 1) % rim, g);
+    }
+
+    const auto net = mce::make_network(g);
+
+    auto limits = mce::bounds();
+    limits.min_size = 4;
+    limits.max_cliques = 1;
+
+    const auto found = mce::largest_cliques(net, limits, 1);
+
+    EXPECT_FALSE(found.complete);
+    EXPECT_TRUE(found.cliques.empty());
+}
+
+TEST(maximal_clique_enumeration_tests, search_stops_at_deadline)
+{
+    const auto g = random_graph(1200, 12000);
+    const auto net = mce::make_network(g);
+
+    auto limits = mce::bounds();
+    limits.deadline = mce::clock::now();
+
+    EXPECT_FALSE(mce::largest_cliques(net, limits, 1).complete);
+}
+
+} // namespace
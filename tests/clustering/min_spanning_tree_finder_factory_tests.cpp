@@ -49,4 +49,18 @@ TEST(clusterin_mst_finder_factory_tests, given_kruskal_id_returns_kruskal_mst)
     ASSERT_EQ(typeid(*finder), typeid(expected_t));
 }
 
+TEST(clusterin_mst_finder_factory_tests, given_boruvka_id_returns_boruvka_mst)
+{
+    using expected_t
+        = clustering::boruvka_min_spanning_tree< graph, weight_map >;
+
+    constexpr auto id = clustering::boruvka_mst_id;
+    static_assert(clustering::is_mst_finder_plugged_in(id));
+    const auto finder = mst_finder_factory::make_mst_finder(id);
+
+    ASSERT_NE(nullptr, finder);
+    EXPECT_EQ(id, finder->id());
+    ASSERT_EQ(typeid(*finder), typeid(expected_t));
+}
+
 } // namespace
\ No newline at end of file
@@ -1,4 +1,6 @@
+#include "clustering/detail/shared_nearest_neighbour_clustering.hpp"
 #include "clustering/shared_nearest_neighbour_clustering.hpp"
+#include "misc/algorithm.hpp"
 #include "misc/random.hpp"
 
 #include <boost/graph/isomorphism.hpp>
@@ -262,4 +264,112 @@ TEST(shared_nearest_neighbour_tests, clustering_computing_snn)
     EXPECT_NE(clusters.at(v3), clusters.at(v4));
 }
 
-} // namespace
\ No newline at end of file
+// Number of shared neighbours of each edge, by linear search.
+template < typename Graph >
+auto naive_shared_nearest_neighbour(const Graph& g)
+{
+    auto res = std::vector< std::size_t >();
+
+    for (auto e : boost::make_iterator_range(boost::edges(g)))
+    {
+        const auto [ubegin, uend]
+            = boost::adjacent_vertices(boost::source(e, g), g);
+        const auto [vbegin, vend]
+            = boost::adjacent_vertices(boost::target(e, g), g);
+
+        auto intersection = std::vector< typename Graph::vertex_descriptor >();
+        misc::set_intersection(
+            ubegin, uend, vbegin, vend, std::back_inserter(intersection));
+
+        res.push_back(intersection.size());
+    }
+
+    return res;
+}
+
+TEST(
+    shared_nearest_neighbour_tests,
+    neighbours_are_counted_as_many_times_as_they_are_adjacent_to_the_source)
+{
+    graph g;
+
+    auto v0 = boost::add_vertex(0, g);
+    auto v1 = boost::add_vertex(1, g);
+    auto v2 = boost::add_vertex(2, g);
+
+    boost::add_edge(v0, v1, g);
+    boost::add_edge(v0, v2, g);
+    boost::add_edge(v0, v2, g);
+    boost::add_edge(v1, v2, g);
+
+    const auto expected = naive_shared_nearest_neighbour(g);
+    const auto actual = clustering::detail::shared_nearest_neighbour(g);
+
+    EXPECT_EQ(actual, expected);
+    EXPECT_EQ(actual.front(), 2);
+}
+
+TEST(
+    shared_nearest_neighbour_tests,
+    shared_nearest_neighbour_matches_linear_search_around_hubs)
+{
+    constexpr auto num_vertices = 1100;
+    constexpr auto num_edges = 3000;
+
+    graph g;
+
+    for (auto i = 0; i < num_vertices; ++i)
+        boost::add_vertex(i, g);
+
+    // Two adjacent hubs, (with bitset neighbourhoods), a smaller hub, and
+    // some random edges.
+    for (auto hub = 0; hub < 3; ++hub)
+        for (auto v = 0; v < num_vertices; v += hub < 2 ? 1 : 3)
+            if (v != hub)
+                boost::add_edge(hub, v, g);
+
+    for (auto i = 0; i < num_edges; ++i)
+        boost::add_edge(
+            misc::urandom(0, num_vertices - 1),
+            misc::urandom(0, num_vertices - 1),
+            g);
+
+    EXPECT_EQ(
+        clustering::detail::shared_nearest_neighbour(g),
+        naive_shared_nearest_neighbour(g));
+}
+
+TEST(shared_nearest_neighbour_tests, intersections_agree)
+{
+    using clustering::detail::bitset_shared;
+    using clustering::detail::gallop_shared;
+    using clustering::detail::merge_shared;
+    using neighbour = clustering::detail::neighbourhoods::neighbour;
+
+    constexpr auto universe = 5000;
+
+    const auto random_neighbourhood = [](auto size)
+    {
+        auto res = std::map< std::size_t, std::size_t >();
+        for (auto i = 0; i < size; ++i)
+            ++res[misc::urandom(0, universe - 1)];
+        return std::vector< neighbour >(std::begin(res), std::end(res));
+    };
+
+    for (auto size : { 1, 10, 100, 4000 })
+    {
+        const auto u = random_neighbourhood(size);
+        const auto v = random_neighbourhood(300);
+
+        auto vbits = boost::dynamic_bitset<>(universe);
+        for (const auto& [w, times] : v)
+            vbits.set(w);
+
+        const auto expected = merge_shared(u, v);
+
+        EXPECT_EQ(gallop_shared(u, v), expected);
+        EXPECT_EQ(bitset_shared(u, vbits), expected);
+    }
+}
+
+} // namespace
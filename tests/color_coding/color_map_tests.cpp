@@ -80,4 +80,19 @@ TEST_F(a_dynamic_color_map, returns_nullopt_when_color_codes_get_inactive)
     ASSERT_EQ(boost::get(color_map, edge), std::nullopt);
 }
 
+TEST_F(a_dynamic_color_map, resolves_interned_dependencies_by_index)
+{
+    using interned_dependency_map = boost::constant_property_map<
+        graph::edge_descriptor,
+        misc::interned_dependency >;
+
+    const auto color_map = make_color_map< graph >(
+        *back,
+        interned_dependency_map(misc::interned_dependency("Inheritance")));
+
+    update_color(*back, "Inheritance", rgba({ 20, 20, 20, 1 }));
+
+    ASSERT_EQ(*boost::get(color_map, edge), rgba({ 20, 20, 20, 1 }));
+}
+
 } // namespace
\ No newline at end of file
@@ -55,4 +55,14 @@ TEST_F(given_a_color_repo, dependencies_can_be_paired_with_inactive_color_codes)
     ASSERT_EQ(repo->get_color("b"), color_code({ { 1, 0, 0, 0 } }, false));
 }
 
+TEST_F(given_a_color_repo, colors_can_be_queried_by_interned_dependency)
+{
+    const auto a = misc::interned_dependency("a").handle();
+
+    repo->set_color("a", color_code({ 0, 0, 0, 0 }));
+
+    ASSERT_EQ(repo->get_color(a), color_code({ 0, 0, 0, 0 }));
+    ASSERT_EQ(repo->get_color(a), repo->get_color("a"));
+}
+
 } // namespace
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 using namespace testing;
 
+using id_type = gui::popup_holder::id_type;
+
 namespace
 {
 
@@ -34,14 +36,14 @@ protected:
 
 TEST_F(given_a_popup_holder, when_inserting_a_popup_then_contains)
 {
-    popups->insert("ClassX", gui::structure_popup());
+    popups->insert(id_type("ClassX"), gui::structure_popup());
 
     EXPECT_TRUE(popups->contains("ClassX"));
 }
 
 TEST_F(given_a_popup_holder, when_inserting_a_popup_then_size_is_1)
 {
-    popups->insert("ClassX", gui::structure_popup());
+    popups->insert(id_type("ClassX"), gui::structure_popup());
 
     EXPECT_EQ(popups->size(), 1);
 }
@@ -49,8 +51,8 @@ TEST_F(given_a_popup_holder, when_inserting_a_popup_then_size_is_1)
 TEST_F(
     given_a_popup_holder, when_inserting_with_the_same_id_twice_then_contains)
 {
-    popups->insert("ClassX", gui::structure_popup());
-    popups->insert("ClassX", gui::structure_popup());
+    popups->insert(id_type("ClassX"), gui::structure_popup());
+    popups->insert(id_type("ClassX"), gui::structure_popup());
 
     EXPECT_TRUE(popups->contains("ClassX"));
 }
@@ -58,8 +60,8 @@ TEST_F(
 TEST_F(
     given_a_popup_holder, when_inserting_with_the_same_id_twice_then_size_is_1)
 {
-    popups->insert("ClassX", gui::structure_popup());
-    popups->insert("ClassX", gui::structure_popup());
+    popups->insert(id_type("ClassX"), gui::structure_popup());
+    popups->insert(id_type("ClassX"), gui::structure_popup());
 
     EXPECT_EQ(popups->size(), 1);
 }
@@ -68,8 +70,8 @@ TEST_F(
     given_a_popup_holder,
     when_inserting_two_popups_with_dif_ids_then_contains_both_popups)
 {
-    popups->insert("Foo", gui::structure_popup());
-    popups->insert("Bar", gui::structure_popup());
+    popups->insert(id_type("Foo"), gui::structure_popup());
+    popups->insert(id_type("Bar"), gui::structure_popup());
 
     EXPECT_TRUE(popups->contains("Foo"));
     EXPECT_TRUE(popups->contains("Bar"));
@@ -78,8 +80,8 @@ TEST_F(
 TEST_F(
     given_a_popup_holder, when_inserting_two_popups_with_dif_ids_then_size_is_2)
 {
-    popups->insert("Foo", gui::structure_popup());
-    popups->insert("Bar", gui::structure_popup());
+    popups->insert(id_type("Foo"), gui::structure_popup());
+    popups->insert(id_type("Bar"), gui::structure_popup());
 
     EXPECT_EQ(popups->size(), 2);
 }
@@ -95,7 +97,7 @@ TEST_F(
     given_a_popup_holder,
     remove_after_insert_means_that_popup_is_no_longer_containd)
 {
-    popups->insert("Buzz", gui::structure_popup());
+    popups->insert(id_type("Buzz"), gui::structure_popup());
 
     popups->remove("Buzz");
 
@@ -104,7 +106,7 @@ TEST_F(
 
 TEST_F(given_a_popup_holder, remove_after_1_insert_means_that_size_is_0)
 {
-    popups->insert("Buzz", gui::structure_popup());
+    popups->insert(id_type("Buzz"), gui::structure_popup());
 
     popups->remove("Buzz");
 
@@ -120,8 +122,8 @@ TEST_F(given_a_popup_holder, clear_initially_does_nothing)
 
 TEST_F(given_a_popup_holder, after_2_inserts_and_clear_then_size_is_0)
 {
-    popups->insert("Buzz", gui::structure_popup());
-    popups->insert("HAA", gui::structure_popup());
+    popups->insert(id_type("Buzz"), gui::structure_popup());
+    popups->insert(id_type("HAA"), gui::structure_popup());
 
     popups->clear();
 
@@ -130,8 +132,8 @@ TEST_F(given_a_popup_holder, after_2_inserts_and_clear_then_size_is_0)
 
 TEST_F(given_a_popup_holder, after_2_inserts_and_clear_then_contains_none)
 {
-    popups->insert("Buzz", gui::structure_popup());
-    popups->insert("HAA", gui::structure_popup());
+    popups->insert(id_type("Buzz"), gui::structure_popup());
+    popups->insert(id_type("HAA"), gui::structure_popup());
 
     popups->clear();
 
@@ -1,10 +1,17 @@
 #include "layout/backend.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/property_maps/constant_property_map.hpp>
+#include <boost/property_map/function_property_map.hpp>
+#include <functional>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
 namespace
 {
@@ -249,4 +256,379 @@ TEST_F(given_a_layout_backend, export_configs_returns_a_state_copy)
     EXPECT_EQ(initial_data(), export_configs(*inst));
 }
 
+inline auto wait_for_commit(backend& b)
+{
+    while (b.is_pending())
+    {
+        b.poll();
+        std::this_thread::yield();
+    }
+}
+
+TEST_F(given_a_layout_backend, requesting_with_unlisted_layout_results_to_noop)
+{
+    layout::request_layout(*inst, "aaaaa");
+
+    ASSERT_FALSE(inst->is_pending());
+}
+
+TEST_F(given_a_layout_backend, requesting_with_negative_scale_results_to_noop)
+{
+    layout::request_scale(*inst, -2);
+
+    ASSERT_FALSE(inst->is_pending());
+}
+
+TEST_F(given_a_layout_backend, a_layout_request_is_committed_when_polled)
+{
+    inst->connect_to_layout(mock_layout_observer.AsStdFunction());
+    inst->connect_to_topology(mock_space_observer.AsStdFunction());
+
+    EXPECT_CALL(mock_layout_observer, Call(testing::_)).Times(1);
+    EXPECT_CALL(mock_space_observer, Call(testing::_)).Times(0);
+
+    layout::request_layout(*inst, layout::random_id);
+
+    EXPECT_TRUE(inst->is_pending());
+    EXPECT_EQ(inst->requested_layout(), layout::random_id);
+    EXPECT_EQ(layout::get_layout_id(*inst), initial_layout);
+
+    wait_for_commit(*inst);
+
+    ASSERT_EQ(layout::get_layout_id(*inst), layout::random_id);
+}
+
+TEST_F(given_a_layout_backend, a_topology_request_is_committed_when_polled)
+{
+    inst->connect_to_layout(mock_layout_observer.AsStdFunction());
+    inst->connect_to_topology(mock_space_observer.AsStdFunction());
+
+    EXPECT_CALL(mock_layout_observer, Call(testing::_)).Times(1);
+    EXPECT_CALL(mock_space_observer, Call(testing::_)).Times(1);
+
+    layout::request_topology(*inst, layout::sphere_id, 300);
+    wait_for_commit(*inst);
+
+    ASSERT_EQ(layout::get_topology_id(*inst), layout::sphere_id);
+    ASSERT_EQ(layout::get_scale(*inst), 300);
+    ASSERT_EQ(layout::get_layout_id(*inst), initial_layout);
+}
+
+TEST_F(given_a_layout_backend, a_newer_request_supersedes_a_pending_one)
+{
+    inst->connect_to_layout(mock_layout_observer.AsStdFunction());
+
+    EXPECT_CALL(mock_layout_observer, Call(testing::_)).Times(1);
+
+    layout::request_topology(*inst, layout::sphere_id);
+    layout::request_layout(*inst, layout::random_id);
+    layout::request_scale(*inst, 34);
+
+    EXPECT_EQ(inst->requested_topology(), layout::sphere_id);
+    EXPECT_EQ(inst->requested_layout(), layout::random_id);
+    EXPECT_EQ(inst->requested_scale(), 34);
+
+    wait_for_commit(*inst);
+
+    ASSERT_EQ(layout::get_topology_id(*inst), layout::sphere_id);
+    ASSERT_EQ(layout::get_layout_id(*inst), layout::random_id);
+    ASSERT_EQ(layout::get_scale(*inst), 34);
+}
+
+TEST_F(given_a_layout_backend, a_cancelled_request_is_never_committed)
+{
+    inst->connect_to_layout(mock_layout_observer.AsStdFunction());
+
+    EXPECT_CALL(mock_layout_observer, Call(testing::_)).Times(0);
+
+    layout::request_layout(*inst, layout::random_id);
+    inst->cancel();
+    inst->poll();
+
+    ASSERT_FALSE(inst->is_pending());
+    ASSERT_EQ(layout::get_layout_id(*inst), initial_layout);
+}
+
+TEST_F(given_a_layout_backend, a_commit_reports_full_progress)
+{
+    using progress_type = backend::progress_type;
+
+    auto progress = std::vector< progress_type >();
+    inst->connect_to_progress([&progress](auto p) { progress.push_back(p); });
+
+    layout::request_defaults(*inst);
+    wait_for_commit(*inst);
+
+    ASSERT_FALSE(progress.empty());
+    EXPECT_TRUE(std::ranges::is_sorted(progress));
+    ASSERT_EQ(progress.back(), 1);
+}
+
+class given_a_layout_backend_of_a_path : public given_a_layout_backend
+{
+public:
+    void SetUp() override
+    {
+        g = graph(10);
+        for (auto i = 1; i < 10; ++i)
+            boost::add_edge(i - 1, i, g);
+
+        given_a_layout_backend::SetUp();
+    }
+
+protected:
+    auto positions() const
+    {
+        return std::vector(
+            std::begin(inst->get_layout().positions()),
+            std::end(inst->get_layout().positions()));
+    }
+};
+
+TEST_F(given_a_layout_backend_of_a_path, a_scale_update_rescales_the_positions)
+{
+    const auto initial_positions = positions();
+
+    layout::update_scale(*inst, initial_scale * 2);
+
+    ASSERT_EQ(layout::get_layout_id(*inst), initial_layout);
+    ASSERT_EQ(positions().size(), initial_positions.size());
+    for (std::size_t v = 0; v < initial_positions.size(); ++v)
+        for (auto axis = 0; axis < 3; ++axis)
+            EXPECT_DOUBLE_EQ(
+                positions()[v][axis], initial_positions[v][axis] * 2);
+}
+
+TEST_F(given_a_layout_backend_of_a_path, a_scale_request_is_committed_at_once)
+{
+    inst->connect_to_layout(mock_layout_observer.AsStdFunction());
+    inst->connect_to_topology(mock_space_observer.AsStdFunction());
+
+    EXPECT_CALL(mock_layout_observer, Call(testing::_)).Times(1);
+    EXPECT_CALL(mock_space_observer, Call(testing::_)).Times(1);
+
+    layout::request_scale(*inst, 34);
+
+    ASSERT_FALSE(inst->is_pending());
+    ASSERT_EQ(layout::get_scale(*inst), 34);
+}
+
+TEST_F(given_a_layout_backend_of_a_path, a_refinement_keeps_the_layout_type)
+{
+    inst->connect_to_layout(mock_layout_observer.AsStdFunction());
+    inst->connect_to_topology(mock_space_observer.AsStdFunction());
+
+    EXPECT_CALL(mock_layout_observer, Call(testing::_)).Times(1);
+    EXPECT_CALL(mock_space_observer, Call(testing::_)).Times(0);
+
+    inst->request_refinement();
+
+    EXPECT_TRUE(inst->is_pending());
+
+    wait_for_commit(*inst);
+
+    ASSERT_EQ(layout::get_layout_id(*inst), initial_layout);
+    ASSERT_EQ(layout::get_topology_id(*inst), initial_topology);
+    ASSERT_EQ(positions().size(), boost::num_vertices(g));
+}
+
+TEST_F(given_a_layout_backend_of_a_path, a_weights_change_is_refined_if_auto)
+{
+    inst->set_auto_refine(true);
+
+    inst->notify_weights_changed();
+
+    ASSERT_TRUE(inst->is_pending());
+}
+
+TEST_F(given_a_layout_backend_of_a_path, a_previous_layout_is_restored_cached)
+{
+    auto config = initial_data();
+    config.cache_budget = 1;
+    inst = std::make_unique< backend >(g, weight_map(), std::move(config));
+    const auto initial_positions = positions();
+
+    layout::request_layout(*inst, layout::random_id);
+    wait_for_commit(*inst);
+    layout::request_layout(*inst, initial_layout);
+
+    ASSERT_FALSE(inst->is_pending());
+    ASSERT_EQ(layout::get_layout_id(*inst), initial_layout);
+    ASSERT_EQ(positions(), initial_positions);
+}
+
+TEST_F(given_a_layout_backend_of_a_path, layouts_are_not_cached_without_budget)
+{
+    layout::request_layout(*inst, layout::random_id);
+    wait_for_commit(*inst);
+    layout::request_layout(*inst, initial_layout);
+
+    ASSERT_TRUE(inst->is_pending());
+    ASSERT_TRUE(inst->cache().empty());
+}
+
+TEST_F(given_a_layout_backend_of_a_path, auto_refinement_is_off_by_default)
+{
+    inst->notify_weights_changed();
+
+    ASSERT_FALSE(inst->is_pending());
+}
+
+TEST_F(given_a_layout_backend_of_a_path, layouts_are_reproducible_from_a_seed)
+{
+    auto config = initial_data();
+    config.seed = 42;
+    inst = std::make_unique< backend >(g, weight_map(), config);
+    auto other = backend(g, weight_map(), config);
+
+    layout::request_layout(*inst, layout::multilevel_id);
+    layout::request_layout(other, layout::multilevel_id);
+    wait_for_commit(*inst);
+    wait_for_commit(other);
+
+    ASSERT_TRUE(std::ranges::equal(
+        inst->get_layout().positions(), other.get_layout().positions()));
+}
+
+TEST_F(given_a_layout_backend_of_a_path, layouts_differ_across_seeds)
+{
+    auto config = initial_data();
+    config.layout = layout::random_id;
+    config.seed = 42;
+    inst = std::make_unique< backend >(g, weight_map(), config);
+    config.seed = 43;
+    const auto other = backend(g, weight_map(), config);
+
+    ASSERT_FALSE(std::ranges::equal(
+        inst->get_layout().positions(), other.get_layout().positions()));
+}
+
+class given_a_layout_backend_with_failing_weights : public testing::Test
+{
+public:
+    using weight_map = boost::function_property_map<
+        std::function< int(graph::edge_descriptor) >,
+        graph::edge_descriptor >;
+
+    using backend = layout::backend< graph, weight_map >;
+
+    void SetUp() override
+    {
+        g = graph(10);
+        for (auto i = 1; i < 10; ++i)
+            boost::add_edge(i - 1, i, g);
+
+        auto config = backend::config_data_type {
+            .layouts = { std::cbegin(layout::layout_ids),
+                         std::cend(layout::layout_ids) },
+            .topologies = { std::cbegin(layout::topology_ids),
+                            std::cend(layout::topology_ids) },
+            .layout = std::string(layout::random_id),
+            .topology = std::string(initial_topology),
+            .scale = initial_scale
+        };
+
+        inst = std::make_unique< backend >(
+            g, weight_map(std::ref(edge_weight)), std::move(config));
+    }
+
+protected:
+    std::function< int(graph::edge_descriptor) > edge_weight
+        = [this](auto) -> int
+    {
+        if (fail)
+            throw std::runtime_error("failing weight");
+        return 1;
+    };
+
+    std::unique_ptr< backend > inst;
+    graph g;
+    bool fail { false };
+};
+
+TEST_F(
+    given_a_layout_backend_with_failing_weights,
+    a_failed_request_is_dropped_keeping_the_committed_layout)
+{
+    auto mock_observer = testing::NiceMock<
+        testing::MockFunction< void(const backend::layout_type&) > >();
+    inst->connect_to_layout(mock_observer.AsStdFunction());
+
+    EXPECT_CALL(mock_observer, Call(testing::_)).Times(0);
+
+    fail = true;
+    layout::request_layout(*inst, layout::fruchterman_reingold_id);
+
+    while (inst->is_pending())
+    {
+        ASSERT_NO_THROW(inst->poll());
+        std::this_thread::yield();
+    }
+
+    ASSERT_EQ(layout::get_layout_id(*inst), layout::random_id);
+}
+
+class given_a_layout_backend_with_mutable_weights : public testing::Test
+{
+public:
+    using weight_map = boost::function_property_map<
+        std::function< int(graph::edge_descriptor) >,
+        graph::edge_descriptor >;
+
+    using backend = layout::backend< graph, weight_map >;
+
+    void SetUp() override
+    {
+        g = graph(10);
+        for (auto i = 1; i < 10; ++i)
+            boost::add_edge(i - 1, i, g);
+
+        auto config = backend::config_data_type {
+            .layouts = { std::cbegin(layout::layout_ids),
+                         std::cend(layout::layout_ids) },
+            .topologies = { std::cbegin(layout::topology_ids),
+                            std::cend(layout::topology_ids) },
+            .layout = std::string(layout::random_id),
+            .topology = std::string(initial_topology),
+            .scale = initial_scale,
+            .cache_budget = 1
+        };
+
+        inst = std::make_unique< backend >(
+            g, weight_map(std::ref(edge_weight)), std::move(config));
+    }
+
+protected:
+    std::function< int(graph::edge_descriptor) > edge_weight
+        = [this](auto) -> int { return weight; };
+
+    std::unique_ptr< backend > inst;
+    graph g;
+    std::atomic< int > weight { 1 }; // read by the workers too
+};
+
+TEST_F(
+    given_a_layout_backend_with_mutable_weights,
+    a_request_is_cached_under_the_weights_it_was_computed_from)
+{
+    layout::request_layout(*inst, layout::fruchterman_reingold_id);
+    weight = 2;
+
+    while (inst->is_pending())
+    {
+        inst->poll();
+        std::this_thread::yield();
+    }
+
+    layout::request_layout(*inst, layout::fruchterman_reingold_id);
+
+    EXPECT_TRUE(inst->is_pending());
+
+    inst->cancel();
+    weight = 1;
+    layout::request_layout(*inst, layout::fruchterman_reingold_id);
+
+    EXPECT_FALSE(inst->is_pending());
+}
+
 } // namespace
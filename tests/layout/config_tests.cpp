@@ -21,7 +21,9 @@ auto make_sample_layout_0()
                          .topologies = { "Cube" },
                          .layout = "Gursoy Atun",
                          .topology = "Cube",
-                         .scale = 100 };
+                         .scale = 100,
+                         .cache_budget = 16,
+                         .seed = 42 };
 }
 
 TEST(layout_deserialization, sample_layout_0)
@@ -0,0 +1,196 @@
+#include "layout/cube.hpp"
+#include "layout/fruchterman_reingold_layout.hpp"
+#include "layout/sphere.hpp"
+
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/property_maps/constant_property_map.hpp>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <random>
+#include <stop_token>
+#include <vector>
+
+using namespace testing;
+
+namespace
+{
+
+using graph = boost::adjacency_list<
+    boost::vecS,
+    boost::vecS,
+    boost::directedS,
+    boost::no_property,
+    boost::no_property >;
+
+using weight_map = boost::constant_property_map< graph::edge_descriptor, int >;
+
+using fruchterman_reingold_layout
+    = layout::fruchterman_reingold_layout< graph >;
+
+using point = layout::detail::vector3;
+
+inline auto make_path(std::size_t num_vertices)
+{
+    auto g = graph(num_vertices);
+    for (std::size_t i = 1; i < num_vertices; ++i)
+        boost::add_edge(i - 1, i, g);
+
+    return g;
+}
+
+inline auto distance(const point& p1, const point& p2)
+{
+    using layout::detail::operator-;
+    const auto d = p1 - p2;
+    return std::sqrt(layout::detail::dot(d, d));
+}
+
+TEST(a_fruchterman_reingold_layout, positions_every_vertex)
+{
+    const auto g = make_path(50);
+
+    const auto lay
+        = fruchterman_reingold_layout(g, layout::cube(100), weight_map(1));
+
+    ASSERT_EQ(lay.positions().size(), boost::num_vertices(g));
+}
+
+TEST(a_fruchterman_reingold_layout, keeps_the_vertices_within_a_cube)
+{
+    constexpr auto scale = 100.0;
+    const auto g = make_path(50);
+
+    const auto lay
+        = fruchterman_reingold_layout(g, layout::cube(scale), weight_map(1));
+
+    for (const auto& p : lay.positions())
+        for (auto coord : p)
+        {
+            EXPECT_GE(coord, -scale);
+            EXPECT_LE(coord, scale);
+        }
+}
+
+TEST(a_fruchterman_reingold_layout, keeps_the_vertices_within_a_sphere)
+{
+    constexpr auto scale = 100.0;
+    const auto g = make_path(50);
+
+    const auto lay
+        = fruchterman_reingold_layout(g, layout::sphere(scale), weight_map(1));
+
+    for (const auto& p : lay.positions())
+        EXPECT_LE(distance(p, { 0, 0, 0 }), scale + 1e-6);
+}
+
+TEST(a_fruchterman_reingold_layout, places_adjacent_vertices_closer_than_others)
+{
+    const auto g = make_path(50);
+
+    const auto lay
+        = fruchterman_reingold_layout(g, layout::cube(100), weight_map(1));
+
+    const auto pos = lay.positions();
+
+    auto adjacent = 0.0;
+    for (std::size_t i = 1; i < pos.size(); ++i)
+        adjacent += distance(pos[i - 1], pos[i]);
+    adjacent /= double(pos.size() - 1);
+
+    auto all = 0.0;
+    for (std::size_t i = 0; i < pos.size(); ++i)
+        for (std::size_t j = i + 1; j < pos.size(); ++j)
+            all += distance(pos[i], pos[j]);
+    all /= double(pos.size() * (pos.size() - 1) / 2);
+
+    EXPECT_LT(adjacent, all);
+}
+
+TEST(a_fruchterman_reingold_layout, reports_full_progress_when_done)
+{
+    const auto g = make_path(10);
+    auto token = misc::job_token();
+
+    fruchterman_reingold_layout(g, layout::cube(100), weight_map(1), token);
+
+    EXPECT_EQ(token.progress(), 1);
+}
+
+TEST(a_fruchterman_reingold_layout, can_be_cancelled)
+{
+    const auto g = make_path(10);
+    auto source = std::stop_source();
+    auto token = misc::job_token(source.get_token());
+    source.request_stop();
+
+    EXPECT_THROW(
+        fruchterman_reingold_layout(g, layout::cube(100), weight_map(1), token),
+        misc::job_cancelled);
+}
+
+TEST(a_barnes_hut_octree, sums_the_exact_repulsion_without_approximation)
+{
+    auto rng = std::mt19937(42);
+    auto dist = std::uniform_real_distribution(-100.0, 100.0);
+
+    auto points = std::vector< point >(200);
+    for (auto& p : points)
+        p = { dist(rng), dist(rng), dist(rng) };
+
+    const auto tree = layout::detail::octree(points);
+
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        using layout::detail::operator+;
+        using layout::detail::operator-;
+        using layout::detail::operator*;
+
+        auto expected = point { 0, 0, 0 };
+        for (std::size_t j = 0; j < points.size(); ++j)
+        {
+            if (i == j)
+                continue;
+
+            const auto d = points[i] - points[j];
+            expected = expected + d * (1 / layout::detail::dot(d, d));
+        }
+
+        const auto actual = tree.repulsion(i, 1, 0);
+
+        for (auto axis = 0; axis < 3; ++axis)
+            EXPECT_NEAR(actual[axis], expected[axis], 1e-9);
+    }
+}
+
+TEST(a_barnes_hut_octree, approximates_the_repulsion)
+{
+    auto rng = std::mt19937(42);
+    auto dist = std::uniform_real_distribution(-100.0, 100.0);
+
+    auto points = std::vector< point >(2000);
+    for (auto& p : points)
+        p = { dist(rng), dist(rng), dist(rng) };
+
+    const auto tree = layout::detail::octree(points);
+
+    for (std::size_t i = 0; i < points.size(); i += 100)
+    {
+        const auto exact = tree.repulsion(i, 1, 0);
+        const auto approx = tree.repulsion(i, 1, 0.5);
+
+        EXPECT_LT(
+            distance(exact, approx),
+            0.1 * std::sqrt(layout::detail::dot(exact, exact)));
+    }
+}
+
+TEST(a_barnes_hut_octree, separates_coincident_points)
+{
+    const auto points = std::vector< point >(20, point { 1, 1, 1 });
+
+    const auto tree = layout::detail::octree(points);
+
+    EXPECT_NE(tree.repulsion(0, 1, 1), (point { 0, 0, 0 }));
+}
+
+} // namespace
@@ -0,0 +1,105 @@
+#include "layout/layout_cache.hpp"
+#include "layout/plugin.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace testing;
+
+namespace
+{
+
+using cache_type = layout::layout_cache;
+using key_type = cache_type::key_type;
+using positions_type = cache_type::positions_type;
+
+constexpr auto positions_bytes = sizeof(cache_type::position_type) * 10;
+
+inline auto make_key(double scale)
+{
+    return key_type { .layout = layout::gursoy_atun_id,
+                      .topology = layout::cube_id,
+                      .scale = scale,
+                      .weights = 0 };
+}
+
+inline auto make_positions(double coord)
+{
+    return positions_type(10, { coord, coord, coord });
+}
+
+TEST(a_layout_cache, is_initially_empty)
+{
+    const auto cache = cache_type(positions_bytes);
+
+    ASSERT_TRUE(cache.empty());
+    ASSERT_EQ(cache.usage(), 0);
+}
+
+TEST(a_layout_cache, finds_the_inserted_positions)
+{
+    auto cache = cache_type(positions_bytes);
+
+    cache.insert(make_key(1), make_positions(1));
+
+    ASSERT_NE(cache.find(make_key(1)), nullptr);
+    ASSERT_EQ(*cache.find(make_key(1)), make_positions(1));
+    ASSERT_EQ(cache.usage(), positions_bytes);
+}
+
+TEST(a_layout_cache, does_not_find_other_keys)
+{
+    auto cache = cache_type(positions_bytes);
+
+    cache.insert(make_key(1), make_positions(1));
+
+    ASSERT_EQ(cache.find(make_key(2)), nullptr);
+}
+
+TEST(a_layout_cache, replaces_the_positions_of_an_inserted_key)
+{
+    auto cache = cache_type(positions_bytes);
+
+    cache.insert(make_key(1), make_positions(1));
+    cache.insert(make_key(1), make_positions(2));
+
+    ASSERT_EQ(cache.size(), 1);
+    ASSERT_EQ(*cache.find(make_key(1)), make_positions(2));
+}
+
+TEST(a_layout_cache, evicts_the_least_recently_used_positions)
+{
+    auto cache = cache_type(positions_bytes * 2);
+
+    cache.insert(make_key(1), make_positions(1));
+    cache.insert(make_key(2), make_positions(2));
+    cache.find(make_key(1));
+    cache.insert(make_key(3), make_positions(3));
+
+    EXPECT_NE(cache.find(make_key(1)), nullptr);
+    EXPECT_EQ(cache.find(make_key(2)), nullptr);
+    EXPECT_NE(cache.find(make_key(3)), nullptr);
+    ASSERT_LE(cache.usage(), cache.budget());
+}
+
+TEST(a_layout_cache, ignores_positions_larger_than_its_budget)
+{
+    auto cache = cache_type(positions_bytes - 1);
+
+    cache.insert(make_key(1), make_positions(1));
+
+    ASSERT_TRUE(cache.empty());
+}
+
+TEST(a_layout_cache, evicts_down_to_a_smaller_budget)
+{
+    auto cache = cache_type(positions_bytes * 2);
+    cache.insert(make_key(1), make_positions(1));
+    cache.insert(make_key(2), make_positions(2));
+
+    cache.set_budget(positions_bytes);
+
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_NE(cache.find(make_key(2)), nullptr);
+}
+
+} // namespace
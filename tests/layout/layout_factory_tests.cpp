@@ -1,7 +1,9 @@
+#include "layout/cube.hpp"
 #include "layout/gursoy_atun_layout.hpp"
 #include "layout/layout_factory.hpp"
 #include "layout/topology.hpp"
 
+#include <algorithm>
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/property_maps/constant_property_map.hpp>
 #include <gmock/gmock.h>
@@ -42,6 +44,7 @@ public:
         move_position_toward,
         (const point_type&, fraction_type, const point_type&),
         (const, override));
+    MOCK_METHOD(point_type, bound, (const point_type&), (const, override));
     MOCK_METHOD(std::unique_ptr< topology >, clone, (), (const, override));
 };
 
@@ -63,4 +66,112 @@ TEST(a_layout_factory, will_create_a_random_layout_upon_request)
     ASSERT_EQ(typeid(*lay), typeid(layout::random_layout< graph >));
 }
 
+TEST(a_layout_factory, will_create_a_fruchterman_reingold_layout_upon_request)
+{
+    auto lay = layout_factory::make_layout(
+        layout::fruchterman_reingold_id,
+        graph(),
+        nice_mock_topology(),
+        weight_map());
+
+    ASSERT_EQ(
+        typeid(*lay), typeid(layout::fruchterman_reingold_layout< graph >));
+}
+
+TEST(a_layout_factory, will_create_a_multilevel_layout_upon_request)
+{
+    auto lay = layout_factory::make_layout(
+        layout::multilevel_id, graph(), nice_mock_topology(), weight_map());
+
+    ASSERT_EQ(typeid(*lay), typeid(layout::multilevel_layout< graph >));
+}
+
+TEST(a_layout_factory, will_create_a_pivot_mds_layout_upon_request)
+{
+    auto lay = layout_factory::make_layout(
+        layout::pivot_mds_id, graph(), nice_mock_topology(), weight_map());
+
+    ASSERT_EQ(typeid(*lay), typeid(layout::pivot_mds_layout< graph >));
+}
+
+inline auto make_graph(std::size_t num_vertices)
+{
+    auto g = graph(num_vertices);
+    for (std::size_t i = 1; i < num_vertices; ++i)
+        boost::add_edge(i - 1, i, g);
+
+    return g;
+}
+
+TEST(a_created_layout, stores_one_position_per_vertex)
+{
+    const auto g = make_graph(10);
+
+    for (auto id : layout::layout_ids)
+    {
+        auto lay = layout_factory::make_layout(
+            id, g, layout::cube(10), weight_map(1));
+
+        EXPECT_EQ(lay->positions().size(), boost::num_vertices(g));
+    }
+}
+
+TEST(a_created_layout, exposes_the_same_positions_in_bulk)
+{
+    const auto g = make_graph(10);
+
+    for (auto id : layout::layout_ids)
+    {
+        auto lay = layout_factory::make_layout(
+            id, g, layout::cube(10), weight_map(1));
+
+        for (auto v : boost::make_iterator_range(boost::vertices(g)))
+        {
+            EXPECT_EQ(lay->positions()[v][0], lay->x(v));
+            EXPECT_EQ(lay->positions()[v][1], lay->y(v));
+            EXPECT_EQ(lay->positions()[v][2], lay->z(v));
+        }
+    }
+}
+
+TEST(a_warm_started_layout, keeps_its_initial_positions_without_iterations)
+{
+    const auto g = make_graph(10);
+    const auto space = layout::cube(10);
+    const auto initial = layout_factory::make_layout(
+        layout::random_id, g, space, weight_map(1));
+
+    for (auto id : layout::layout_ids)
+    {
+        auto lay = layout_factory::make_layout(
+            id, g, space, weight_map(1), initial->positions(), 0);
+
+        EXPECT_EQ(lay->id(), id);
+        EXPECT_TRUE(std::ranges::equal(lay->positions(), initial->positions()));
+    }
+}
+
+TEST(a_warm_started_layout, keeps_the_vertices_within_the_space)
+{
+    constexpr auto scale = 10.0;
+    const auto g = make_graph(10);
+    const auto space = layout::cube(scale);
+    const auto initial = layout_factory::make_layout(
+        layout::random_id, g, space, weight_map(1));
+
+    for (auto id : layout::layout_ids)
+    {
+        auto lay = layout_factory::make_layout(
+            id, g, space, weight_map(1), initial->positions(), 10);
+
+        EXPECT_EQ(lay->positions().size(), boost::num_vertices(g));
+        for (const auto& p : lay->positions())
+            for (auto coord : p)
+            {
+                EXPECT_GE(coord, -scale);
+                EXPECT_LE(coord, scale);
+            }
+    }
+}
+
 } // namespace
\ No newline at end of file
@@ -0,0 +1,235 @@
+#include "layout/cube.hpp"
+#include "layout/multilevel_layout.hpp"
+#include "layout/sphere.hpp"
+
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/property_maps/constant_property_map.hpp>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <stop_token>
+#include <vector>
+
+using namespace testing;
+
+namespace
+{
+
+using graph = boost::adjacency_list<
+    boost::vecS,
+    boost::vecS,
+    boost::directedS,
+    boost::no_property,
+    boost::no_property >;
+
+using weight_map = boost::constant_property_map< graph::edge_descriptor, int >;
+
+using multilevel_layout = layout::multilevel_layout< graph >;
+
+using layout::detail::weighted_edges;
+
+inline auto make_path(std::size_t num_vertices)
+{
+    auto g = graph(num_vertices);
+    for (std::size_t i = 1; i < num_vertices; ++i)
+        boost::add_edge(i - 1, i, g);
+
+    return g;
+}
+
+TEST(a_heavy_edge_matching, matches_vertices_through_their_heaviest_edge)
+{
+    const auto edges
+        = weighted_edges { { .source = 0, .target = 1, .weight = 0.1 },
+                           { .source = 0, .target = 2, .weight = 1 },
+                           { .source = 1, .target = 3, .weight = 1 } };
+
+    const auto parent = layout::detail::match_heavy_edges(4, edges);
+
+    EXPECT_EQ(parent[0], parent[2]);
+    EXPECT_EQ(parent[1], parent[3]);
+    EXPECT_NE(parent[0], parent[1]);
+    EXPECT_EQ(layout::detail::num_coarse_vertices(parent), 2);
+}
+
+TEST(a_heavy_edge_matching, leaves_isolated_vertices_unmatched)
+{
+    const auto edges
+        = weighted_edges { { .source = 0, .target = 1, .weight = 1 } };
+
+    const auto parent = layout::detail::match_heavy_edges(3, edges);
+
+    EXPECT_EQ(parent[0], parent[1]);
+    EXPECT_NE(parent[2], parent[0]);
+    EXPECT_EQ(layout::detail::num_coarse_vertices(parent), 2);
+}
+
+TEST(a_heavy_edge_matching, pairs_the_leaves_of_a_hub)
+{
+    auto edges = weighted_edges();
+    for (std::size_t i = 1; i < 6; ++i)
+        edges.push_back({ .source = 0, .target = i, .weight = 1 });
+
+    const auto parent = layout::detail::match_heavy_edges(6, edges);
+
+    EXPECT_EQ(parent[0], parent[1]);
+    EXPECT_EQ(parent[2], parent[3]);
+    EXPECT_NE(parent[4], parent[2]);
+    EXPECT_EQ(layout::detail::num_coarse_vertices(parent), 3);
+}
+
+TEST(a_heavy_edge_matching, pairs_isolated_vertices)
+{
+    const auto edges = weighted_edges();
+
+    const auto parent = layout::detail::match_heavy_edges(5, edges);
+
+    EXPECT_EQ(parent[0], parent[1]);
+    EXPECT_EQ(parent[2], parent[3]);
+    EXPECT_EQ(layout::detail::num_coarse_vertices(parent), 3);
+}
+
+TEST(a_heavy_edge_matching, coarsens_a_star)
+{
+    constexpr auto num_leaves = std::size_t(10000);
+
+    auto edges = weighted_edges();
+    for (std::size_t i = 1; i <= num_leaves; ++i)
+        edges.push_back({ .source = 0, .target = i, .weight = 1 });
+
+    auto n = num_leaves + 1;
+    while (n > layout::multilevel_layout< graph >::coarsest_size)
+    {
+        const auto parent = layout::detail::match_heavy_edges(n, edges);
+        const auto num_coarse = layout::detail::num_coarse_vertices(parent);
+
+        ASSERT_LE(
+            num_coarse,
+            (1 - layout::multilevel_layout< graph >::min_reduction) * n);
+
+        edges = layout::detail::contract_edges(edges, parent);
+        n = num_coarse;
+    }
+}
+
+TEST(an_edge_contraction, merges_parallel_edges_and_drops_loops)
+{
+    const auto edges
+        = weighted_edges { { .source = 0, .target = 1, .weight = 1 },
+                           { .source = 0, .target = 2, .weight = 1 },
+                           { .source = 1, .target = 2, .weight = 1 },
+                           { .source = 3, .target = 2, .weight = 1 } };
+    const auto parent = layout::detail::coarse_map { 0, 0, 1, 2 };
+
+    const auto res = layout::detail::contract_edges(edges, parent);
+
+    ASSERT_EQ(res.size(), 2);
+    EXPECT_EQ(res[0].source, 0);
+    EXPECT_EQ(res[0].target, 1);
+    EXPECT_EQ(res[0].weight, 1);
+    EXPECT_EQ(res[1].source, 1);
+    EXPECT_EQ(res[1].target, 2);
+    EXPECT_EQ(res[1].weight, 0.5);
+}
+
+TEST(a_random_offset, is_centered_about_the_origin_within_a_cube)
+{
+    constexpr auto scale = 100.0;
+    constexpr auto num_draws = 10000;
+    const auto space = layout::cube(scale, 42);
+
+    auto mean = layout::detail::vector3 { 0, 0, 0 };
+    for (auto i = 0; i < num_draws; ++i)
+    {
+        const auto offset = layout::detail::random_offset(space);
+        for (auto axis = 0; axis < 3; ++axis)
+            mean[axis] += offset[axis] / num_draws;
+    }
+
+    for (auto coord : mean)
+        EXPECT_NEAR(coord, 0, scale / 20);
+}
+
+TEST(a_multilevel_layout, positions_every_vertex)
+{
+    const auto g = make_path(500);
+
+    const auto lay = multilevel_layout(g, layout::cube(100), weight_map(1));
+
+    ASSERT_EQ(lay.positions().size(), boost::num_vertices(g));
+}
+
+TEST(a_multilevel_layout, keeps_the_vertices_within_a_cube)
+{
+    constexpr auto scale = 100.0;
+    const auto g = make_path(500);
+
+    const auto lay = multilevel_layout(g, layout::cube(scale), weight_map(1));
+
+    for (const auto& p : lay.positions())
+        for (auto coord : p)
+        {
+            EXPECT_GE(coord, -scale);
+            EXPECT_LE(coord, scale);
+        }
+}
+
+TEST(a_multilevel_layout, keeps_the_vertices_within_a_sphere)
+{
+    constexpr auto scale = 100.0;
+    const auto g = make_path(500);
+
+    const auto lay = multilevel_layout(g, layout::sphere(scale), weight_map(1));
+
+    for (const auto& p : lay.positions())
+        EXPECT_LE(
+            std::sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]), scale + 1e-6);
+}
+
+TEST(a_multilevel_layout, lays_out_an_edgeless_graph)
+{
+    const auto g = graph(500);
+
+    const auto lay = multilevel_layout(g, layout::cube(100), weight_map(1));
+
+    ASSERT_EQ(lay.positions().size(), boost::num_vertices(g));
+}
+
+TEST(a_multilevel_layout, is_reproducible_from_the_topology_seed)
+{
+    const auto g = make_path(500);
+
+    const auto lay1
+        = multilevel_layout(g, layout::cube(100, 42), weight_map(1));
+    const auto lay2
+        = multilevel_layout(g, layout::cube(100, 42), weight_map(1));
+
+    ASSERT_TRUE(std::equal(
+        std::begin(lay1.positions()),
+        std::end(lay1.positions()),
+        std::begin(lay2.positions()),
+        std::end(lay2.positions())));
+}
+
+TEST(a_multilevel_layout, reports_full_progress_when_done)
+{
+    const auto g = make_path(500);
+    auto token = misc::job_token();
+
+    multilevel_layout(g, layout::cube(100), weight_map(1), token);
+
+    EXPECT_EQ(token.progress(), 1);
+}
+
+TEST(a_multilevel_layout, can_be_cancelled)
+{
+    const auto g = make_path(500);
+    auto source = std::stop_source();
+    auto token = misc::job_token(source.get_token());
+    source.request_stop();
+
+    EXPECT_THROW(
+        multilevel_layout(g, layout::cube(100), weight_map(1), token),
+        misc::job_cancelled);
+}
+
+} // namespace
@@ -0,0 +1,248 @@
+#include "layout/cube.hpp"
+#include "layout/pivot_mds_layout.hpp"
+#include "layout/sphere.hpp"
+
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/property_maps/constant_property_map.hpp>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <set>
+#include <stop_token>
+#include <vector>
+
+using namespace testing;
+
+namespace
+{
+
+using graph = boost::adjacency_list<
+    boost::vecS,
+    boost::vecS,
+    boost::directedS,
+    boost::no_property,
+    boost::no_property >;
+
+using weight_map = boost::constant_property_map< graph::edge_descriptor, int >;
+
+using pivot_mds_layout = layout::pivot_mds_layout< graph >;
+
+using layout::detail::weighted_edges;
+
+inline auto make_path(std::size_t num_vertices)
+{
+    auto g = graph(num_vertices);
+    for (std::size_t i = 1; i < num_vertices; ++i)
+        boost::add_edge(i - 1, i, g);
+
+    return g;
+}
+
+inline auto distance(
+    const layout::detail::vector3& p1,
+    const layout::detail::vector3& p2)
+{
+    using layout::detail::operator-;
+    const auto d = p1 - p2;
+    return std::sqrt(layout::detail::dot(d, d));
+}
+
+TEST(shortest_distances, follow_the_edge_lengths)
+{
+    const auto edges
+        = weighted_edges { { .source = 0, .target = 1, .weight = 1 },
+                           { .source = 1, .target = 2, .weight = 0.5 },
+                           { .source = 0, .target = 2, .weight = 0.25 } };
+    const auto adjacency = layout::detail::make_weighted_adjacency(3, edges);
+    auto distances = std::vector< double >(3);
+
+    layout::detail::shortest_distances(adjacency, 0, distances);
+
+    EXPECT_EQ(distances[0], 0);
+    EXPECT_EQ(distances[1], 1);
+    EXPECT_EQ(distances[2], 3);
+}
+
+TEST(shortest_distances, place_unreachable_vertices_beyond_the_farthest)
+{
+    const auto edges
+        = weighted_edges { { .source = 0, .target = 1, .weight = 1 } };
+    const auto adjacency = layout::detail::make_weighted_adjacency(3, edges);
+    auto distances = std::vector< double >(3);
+
+    layout::detail::shortest_distances(adjacency, 0, distances);
+
+    EXPECT_EQ(distances[2], 2);
+}
+
+TEST(pivot_distances, are_picked_farthest_from_each_other)
+{
+    auto edges = weighted_edges();
+    for (std::size_t i = 1; i < 10; ++i)
+        edges.push_back({ .source = i - 1, .target = i, .weight = 1 });
+    const auto adjacency = layout::detail::make_weighted_adjacency(10, edges);
+
+    const auto dists = layout::detail::make_pivot_distances(adjacency, 3);
+
+    ASSERT_EQ(dists.pivots.size(), 3);
+    EXPECT_EQ(dists.pivots[0], 0);
+    EXPECT_EQ(dists.pivots[1], 9);
+    EXPECT_EQ(dists.at(1, 0), 9);
+}
+
+TEST(pivot_distances, call_the_checkpoint_before_each_pivot)
+{
+    auto edges = weighted_edges();
+    for (std::size_t i = 1; i < 10; ++i)
+        edges.push_back({ .source = i - 1, .target = i, .weight = 1 });
+    const auto adjacency = layout::detail::make_weighted_adjacency(10, edges);
+    auto calls = std::vector< std::size_t >();
+
+    layout::detail::make_pivot_distances(
+        adjacency, 3, [&calls](auto p) { calls.push_back(p); });
+
+    EXPECT_EQ(calls, (std::vector< std::size_t > { 0, 1, 2 }));
+}
+
+TEST(sparse_stress_majorization, calls_the_checkpoint_after_each_iteration)
+{
+    const auto edges
+        = weighted_edges { { .source = 0, .target = 1, .weight = 1 } };
+    const auto adjacency = layout::detail::make_weighted_adjacency(2, edges);
+    const auto dists = layout::detail::make_pivot_distances(adjacency, 2);
+    auto positions = layout::detail::pivot_mds(dists);
+    auto calls = std::vector< int >();
+
+    layout::detail::sparse_stress_majorization(
+        positions,
+        adjacency,
+        dists,
+        3,
+        [&calls](auto i) { calls.push_back(i); });
+
+    EXPECT_EQ(calls, (std::vector< int > { 1, 2, 3 }));
+}
+
+TEST(components, are_connected_through_weighted_edges_only)
+{
+    const auto edges
+        = weighted_edges { { .source = 0, .target = 2, .weight = 1 },
+                           { .source = 1, .target = 3, .weight = 0 } };
+    const auto adjacency = layout::detail::make_weighted_adjacency(4, edges);
+
+    const auto components = layout::detail::make_components(adjacency);
+
+    ASSERT_EQ(components.size(), 3);
+    EXPECT_EQ(components[0].vertices, (std::vector< std::size_t > { 0, 2 }));
+    EXPECT_EQ(components[1].vertices, (std::vector< std::size_t > { 1 }));
+    EXPECT_EQ(components[2].vertices, (std::vector< std::size_t > { 3 }));
+    ASSERT_EQ(components[0].adjacency.neighbours_of(0).size(), 1);
+    EXPECT_EQ(components[0].adjacency.neighbours_of(0)[0].vertex, 1);
+    EXPECT_TRUE(components[1].adjacency.neighbours_of(0).empty());
+}
+
+TEST(a_pivot_mds_layout, positions_every_vertex)
+{
+    const auto g = make_path(100);
+
+    const auto lay = pivot_mds_layout(g, layout::cube(100), weight_map(1));
+
+    ASSERT_EQ(lay.positions().size(), boost::num_vertices(g));
+}
+
+TEST(a_pivot_mds_layout, is_deterministic)
+{
+    const auto g = make_path(100);
+
+    const auto lay1 = pivot_mds_layout(g, layout::cube(100), weight_map(1));
+    const auto lay2 = pivot_mds_layout(g, layout::cube(100), weight_map(1));
+
+    ASSERT_TRUE(std::equal(
+        std::begin(lay1.positions()),
+        std::end(lay1.positions()),
+        std::begin(lay2.positions()),
+        std::end(lay2.positions())));
+}
+
+TEST(a_pivot_mds_layout, keeps_the_vertices_within_a_cube)
+{
+    constexpr auto scale = 100.0;
+    const auto g = make_path(100);
+
+    const auto lay = pivot_mds_layout(g, layout::cube(scale), weight_map(1));
+
+    for (const auto& p : lay.positions())
+        for (auto coord : p)
+        {
+            EXPECT_GE(coord, -scale);
+            EXPECT_LE(coord, scale);
+        }
+}
+
+TEST(a_pivot_mds_layout, keeps_the_vertices_within_a_sphere)
+{
+    constexpr auto scale = 100.0;
+    const auto g = make_path(100);
+
+    const auto lay = pivot_mds_layout(g, layout::sphere(scale), weight_map(1));
+
+    for (const auto& p : lay.positions())
+        EXPECT_LE(distance(p, { 0, 0, 0 }), scale + 1e-6);
+}
+
+TEST(a_pivot_mds_layout, preserves_the_graph_distances)
+{
+    const auto g = make_path(100);
+
+    const auto lay = pivot_mds_layout(g, layout::cube(100), weight_map(1));
+    const auto pos = lay.positions();
+
+    EXPECT_LT(distance(pos[0], pos[1]), distance(pos[0], pos[50]));
+    EXPECT_LT(distance(pos[0], pos[50]), distance(pos[0], pos[99]));
+}
+
+TEST(a_pivot_mds_layout, places_disconnected_vertices_apart)
+{
+    auto g = make_path(20);
+    for (auto i = 0; i < 180; ++i)
+        boost::add_vertex(g);
+
+    const auto lay = pivot_mds_layout(g, layout::cube(100), weight_map(1));
+    const auto pos = lay.positions();
+    const auto distinct
+        = std::set< layout::detail::vector3 >(std::begin(pos), std::end(pos));
+
+    EXPECT_EQ(distinct.size(), boost::num_vertices(g));
+}
+
+TEST(a_pivot_mds_layout, lays_out_an_empty_graph)
+{
+    const auto g = graph();
+
+    const auto lay = pivot_mds_layout(g, layout::cube(100), weight_map(1));
+
+    ASSERT_TRUE(lay.positions().empty());
+}
+
+TEST(a_pivot_mds_layout, reports_full_progress_when_done)
+{
+    const auto g = make_path(100);
+    auto token = misc::job_token();
+
+    pivot_mds_layout(g, layout::cube(100), weight_map(1), token);
+
+    EXPECT_EQ(token.progress(), 1);
+}
+
+TEST(a_pivot_mds_layout, can_be_cancelled)
+{
+    const auto g = make_path(100);
+    auto source = std::stop_source();
+    auto token = misc::job_token(source.get_token());
+    source.request_stop();
+
+    EXPECT_THROW(
+        pivot_mds_layout(g, layout::cube(100), weight_map(1), token),
+        misc::job_cancelled);
+}
+
+} // namespace
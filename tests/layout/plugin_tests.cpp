@@ -22,6 +22,21 @@ TEST(layout_plugin_tests, random_layout_is_plugged_in)
     ASSERT_TRUE(layout::is_layout_plugged_in(layout::random_id));
 }
 
+TEST(layout_plugin_tests, fruchterman_reingold_layout_is_plugged_in)
+{
+    ASSERT_TRUE(layout::is_layout_plugged_in(layout::fruchterman_reingold_id));
+}
+
+TEST(layout_plugin_tests, multilevel_layout_is_plugged_in)
+{
+    ASSERT_TRUE(layout::is_layout_plugged_in(layout::multilevel_id));
+}
+
+TEST(layout_plugin_tests, pivot_mds_layout_is_plugged_in)
+{
+    ASSERT_TRUE(layout::is_layout_plugged_in(layout::pivot_mds_id));
+}
+
 TEST(layout_plugin_tests, invalid_topology_is_not_plugged_in)
 {
     ASSERT_FALSE(layout::is_topology_plugged_in("Bob"));
@@ -12,6 +12,12 @@ using namespace testing;
 namespace
 {
 
+inline auto
+equal(const topology::point_type& p1, const topology::point_type& p2)
+{
+    return p1[0] == p2[0] and p1[1] == p2[1] and p1[2] == p2[2];
+}
+
 TEST(a_topology_factory, makes_a_cube_upon_cube_request)
 {
     auto space = topology_factory::make_topology(cube_id, 12);
@@ -26,4 +32,23 @@ TEST(a_topology_factory, makes_a_sphere_upon_sphere_request)
     ASSERT_EQ(typeid(*space), typeid(sphere));
 }
 
+TEST(a_topology_factory, makes_reproducible_topologies_from_a_seed)
+{
+    auto space1 = topology_factory::make_topology(cube_id, 12, 42);
+    auto space2 = topology_factory::make_topology(cube_id, 12, 42);
+
+    for (auto i = 0; i < 10; ++i)
+        ASSERT_TRUE(equal(space1->random_point(), space2->random_point()));
+}
+
+TEST(a_seeded_topology, restarts_its_random_sequence_when_cloned)
+{
+    const auto space = sphere(2, 42);
+    const auto first = space.random_point();
+
+    const auto clone = space.clone();
+
+    ASSERT_TRUE(equal(clone->random_point(), first));
+}
+
 } // namespace
\ No newline at end of file
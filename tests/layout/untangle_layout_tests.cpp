@@ -3,8 +3,9 @@
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/property_maps/constant_property_map.hpp>
 #include <boost/property_map/function_property_map.hpp>
-#include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <memory>
+#include <vector>
 
 using namespace testing;
 
@@ -21,24 +22,28 @@ using graph = boost::adjacency_list<
 using vertex = graph::vertex_descriptor;
 using edge = graph::edge_descriptor;
 
-struct mock_layout : public layout::layout< graph >
+using position = layout::layout< graph >::position_type;
+
+// Holds a fixed set of positions, (one per vertex).
+struct fake_layout : public layout::layout< graph >
 {
     using base = layout< graph >;
     using id_type = typename base::id_type;
-    using vertex_type = typename base::vertex_type;
-    using coord_type = typename base::coord_type;
 
-    mock_layout() = default;
-    ~mock_layout() override = default;
+    explicit fake_layout(const std::vector< position >& positions)
+    {
+        set_positions(positions);
+    }
 
-    MOCK_METHOD(id_type, id, (), (const));
-    MOCK_METHOD(coord_type, x, (vertex_type), (const));
-    MOCK_METHOD(coord_type, y, (vertex_type), (const));
-    MOCK_METHOD(coord_type, z, (vertex_type), (const));
-    MOCK_METHOD(std::unique_ptr< base >, clone, (), (const));
-};
+    ~fake_layout() override = default;
 
-using nice_mock_layout = NiceMock< mock_layout >;
+    auto id() const -> id_type override { return "fake"; }
+
+    auto clone() const -> std::unique_ptr< base > override
+    {
+        return std::make_unique< fake_layout >(*this);
+    }
+};
 
 TEST(untangle_layout_tests, two_vertices_on_the_same_cluster_will_be_untangled)
 {
@@ -46,20 +51,11 @@ TEST(untangle_layout_tests, two_vertices_on_the_same_cluster_will_be_untangled)
     const auto v0 = boost::add_vertex(g);
     const auto v1 = boost::add_vertex(g);
     const auto vertex_cluster = boost::make_constant_property< vertex >(0);
-    nice_mock_layout initial;
-    ON_CALL(initial, x(v0)).WillByDefault(Return(0));
-    ON_CALL(initial, y(v0)).WillByDefault(Return(0));
-    ON_CALL(initial, z(v0)).WillByDefault(Return(0));
-    ON_CALL(initial, x(v1)).WillByDefault(Return(1));
-    ON_CALL(initial, y(v1)).WillByDefault(Return(1));
-    ON_CALL(initial, z(v1)).WillByDefault(Return(1));
+    const auto initial = fake_layout({ { 0, 0, 0 }, { 1, 1, 1 } });
     auto layout_factory = [](const auto&, auto)
     {
-        auto res = std::make_unique< nice_mock_layout >();
-        ON_CALL(*res, x(_)).WillByDefault(Return(2));
-        ON_CALL(*res, y(_)).WillByDefault(Return(2));
-        ON_CALL(*res, z(_)).WillByDefault(Return(2));
-        return res;
+        return std::make_unique< fake_layout >(
+            std::vector< position > { { 2, 2, 2 } });
     };
     const double scale = 10;
 
@@ -74,4 +70,48 @@ TEST(untangle_layout_tests, two_vertices_on_the_same_cluster_will_be_untangled)
     EXPECT_EQ(res->z(v1), 3);
 }
 
+TEST(untangle_layout_tests, clusters_are_densely_indexed_by_first_appearance)
+{
+    const auto g = graph(4);
+    const auto clusters = std::vector< int > { 7, 3, 7, 5 };
+    const auto vertex_cluster = boost::make_function_property_map< vertex >(
+        [&clusters](auto v) { return clusters[v]; });
+
+    const auto indices
+        = layout::detail::make_cluster_indices(g, vertex_cluster);
+
+    ASSERT_EQ(indices.num_clusters, 3);
+    EXPECT_EQ(indices.of_vertex, (std::vector< std::size_t > { 0, 1, 0, 2 }));
+}
+
+TEST(untangle_layout_tests, vertices_will_be_offsetted_by_their_cluster)
+{
+    graph g;
+    const auto v0 = boost::add_vertex(g);
+    const auto v1 = boost::add_vertex(g);
+    const auto v2 = boost::add_vertex(g);
+    boost::add_edge(v0, v2, g);
+    const auto vertex_cluster = boost::make_function_property_map< vertex >(
+        [](auto v) { return v == 1 ? 1 : 0; });
+    const auto initial
+        = fake_layout({ { 1, 1, 1 }, { 1, 1, 1 }, { 1, 1, 1 } });
+    auto layout_factory = [](const auto& induced, auto)
+    {
+        EXPECT_EQ(boost::num_vertices(induced), 2);
+        EXPECT_EQ(boost::num_edges(induced), 0);
+
+        return std::make_unique< fake_layout >(
+            std::vector< position > { { 10, 10, 10 }, { 20, 20, 20 } });
+    };
+    const double scale = 10;
+
+    const auto res = layout::untangle_layout(
+        g, vertex_cluster, initial, layout_factory, scale);
+
+    EXPECT_EQ(res->x(v0), 11);
+    EXPECT_EQ(res->x(v1), 21);
+    EXPECT_EQ(res->x(v2), 11);
+    EXPECT_EQ(res->z(v2), 11);
+}
+
 } // namespace
\ No newline at end of file
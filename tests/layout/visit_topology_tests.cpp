@@ -0,0 +1,68 @@
+#include "layout/cube.hpp"
+#include "layout/sphere.hpp"
+#include "layout/visit_topology.hpp"
+
+#include <gtest/gtest.h>
+#include <type_traits>
+
+using namespace testing;
+
+namespace
+{
+
+struct other_topology : layout::topology
+{
+    auto id() const -> id_type override { return "Other"; }
+    auto scale() const -> scale_type override { return 1; }
+    auto random_point() const -> point_type override { return {}; }
+
+    auto distance(const point_type&, const point_type&) const
+        -> distance_type override
+    {
+        return 0;
+    }
+
+    auto move_position_toward(
+        const point_type& p1,
+        fraction_type,
+        const point_type&) const -> point_type override
+    {
+        return p1;
+    }
+
+    auto bound(const point_type& p) const -> point_type override { return p; }
+
+    auto clone() const -> std::unique_ptr< topology > override
+    {
+        return std::make_unique< other_topology >(*this);
+    }
+};
+
+template < typename Expected >
+inline auto visits_as(const layout::topology& space)
+{
+    return layout::visit_topology(
+        space,
+        [](const auto& concrete)
+        {
+            using concrete_type = std::decay_t< decltype(concrete) >;
+            return std::is_same_v< concrete_type, Expected >;
+        });
+}
+
+TEST(visit_topology, visits_a_cube_as_a_cube)
+{
+    ASSERT_TRUE(visits_as< layout::cube >(layout::cube(10)));
+}
+
+TEST(visit_topology, visits_a_sphere_as_a_sphere)
+{
+    ASSERT_TRUE(visits_as< layout::sphere >(layout::sphere(10)));
+}
+
+TEST(visit_topology, visits_any_other_topology_polymorphically)
+{
+    ASSERT_TRUE(visits_as< layout::topology >(other_topology()));
+}
+
+} // namespace
@@ -0,0 +1,95 @@
+#include "misc/array_map.hpp"
+
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/property_map/function_property_map.hpp>
+#include <gtest/gtest.h>
+
+using namespace misc;
+using namespace testing;
+
+namespace
+{
+
+struct edge_index_t
+{
+    using kind = boost::edge_property_tag;
+};
+
+using graph = boost::adjacency_list<
+    boost::vecS,
+    boost::vecS,
+    boost::directedS,
+    boost::no_property,
+    boost::property< edge_index_t, std::size_t, int > >;
+
+using edge_type = graph::edge_descriptor;
+
+class given_a_graph_with_an_edge_index : public Test
+{
+protected:
+    void SetUp() override
+    {
+        const auto a = boost::add_vertex(g);
+        const auto b = boost::add_vertex(g);
+        const auto c = boost::add_vertex(g);
+
+        boost::add_edge(a, b, graph::edge_property_type(0, 10), g);
+        boost::add_edge(b, c, graph::edge_property_type(1, 20), g);
+        boost::add_edge(c, a, graph::edge_property_type(2, 30), g);
+    }
+
+    auto edge_index() const { return boost::get(edge_index_t(), g); }
+
+    auto edge_weight() const
+    {
+        return boost::make_function_property_map< edge_type >(
+            [this](auto e) { return g[e] * factor; });
+    }
+
+    graph g;
+    int factor { 1 };
+};
+
+TEST_F(given_a_graph_with_an_edge_index, materialized_values_match_the_map)
+{
+    const auto snapshot = materialize_edges(g, edge_weight(), edge_index());
+
+    for (auto e : boost::make_iterator_range(boost::edges(g)))
+        EXPECT_EQ(boost::get(snapshot, e), boost::get(edge_weight(), e));
+}
+
+TEST_F(given_a_graph_with_an_edge_index, snapshots_do_not_track_the_map)
+{
+    const auto snapshot = materialize_edges(g, edge_weight(), edge_index());
+
+    factor = 2;
+
+    for (auto e : boost::make_iterator_range(boost::edges(g)))
+        EXPECT_EQ(boost::get(snapshot, e), g[e]);
+}
+
+TEST_F(given_a_graph_with_an_edge_index, rematerializing_updates_all_copies)
+{
+    auto snapshot = materialize_edges(g, edge_weight(), edge_index());
+    const auto copy = snapshot;
+
+    factor = 2;
+    rematerialize_edges(g, edge_weight(), snapshot);
+
+    for (auto e : boost::make_iterator_range(boost::edges(g)))
+        EXPECT_EQ(boost::get(copy, e), g[e] * 2);
+}
+
+TEST_F(given_a_graph_with_an_edge_index, deep_copies_do_not_track_the_snapshot)
+{
+    auto snapshot = materialize_edges(g, edge_weight(), edge_index());
+    const auto copy = copy_edges(g, snapshot);
+
+    factor = 2;
+    rematerialize_edges(g, edge_weight(), snapshot);
+
+    for (auto e : boost::make_iterator_range(boost::edges(g)))
+        EXPECT_EQ(boost::get(copy, e), g[e]);
+}
+
+} // namespace
@@ -0,0 +1,141 @@
+#include "misc/interning.hpp"
+
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+using namespace misc;
+using namespace testing;
+
+namespace
+{
+
+TEST(a_string_interner, yields_the_same_handle_for_equal_strings)
+{
+    auto table = string_interner();
+
+    const auto a = table.intern("a");
+    const auto b = table.intern("b");
+
+    ASSERT_NE(a, b);
+    ASSERT_EQ(table.intern(std::string("a")), a);
+    ASSERT_EQ(table.size(), 2);
+}
+
+TEST(a_string_interner, resolves_handles_to_their_strings)
+{
+    auto table = string_interner();
+
+    const auto h = table.intern("ClassX");
+
+    ASSERT_EQ(table.str(h), "ClassX");
+}
+
+TEST(a_string_interner, finds_only_interned_strings)
+{
+    auto table = string_interner();
+
+    const auto h = table.intern("a");
+
+    ASSERT_EQ(table.find("a"), h);
+    ASSERT_EQ(table.find("b"), std::nullopt);
+}
+
+TEST(a_string_interner, keeps_strings_in_place_while_growing)
+{
+    auto table = string_interner();
+
+    const auto h = table.intern("first");
+    const auto* addr = &table.str(h);
+
+    for (auto i = 0; i < 5000; ++i)
+        table.intern(std::to_string(i));
+
+    ASSERT_EQ(&table.str(h), addr);
+    ASSERT_EQ(table.str(table.intern("4999")), "4999");
+    ASSERT_EQ(table.size(), 5001);
+}
+
+TEST(a_string_interner, can_be_used_concurrently)
+{
+    auto table = string_interner();
+    auto handles = std::vector< std::vector< string_interner::handle_type > >(
+        4, std::vector< string_interner::handle_type >(1000));
+
+    auto threads = std::vector< std::thread >();
+    for (auto t = 0; t < 4; ++t)
+        threads.emplace_back(
+            [&table, &handles, t]()
+            {
+                for (auto i = 0; i < 1000; ++i)
+                    handles[t][i] = table.intern(std::to_string(i));
+            });
+
+    for (auto& thread : threads)
+        thread.join();
+
+    ASSERT_EQ(table.size(), 1000);
+    for (const auto& hs : handles)
+        ASSERT_EQ(hs, handles.front());
+}
+
+TEST(an_interned_string, is_equal_to_an_equal_interned_string)
+{
+    const auto a = interned_string("ClassX");
+    const auto b = interned_string(std::string("ClassX"));
+
+    ASSERT_EQ(a, b);
+    ASSERT_EQ(a.handle(), b.handle());
+    ASSERT_EQ(
+        std::hash< interned_string >()(a),
+        std::hash< interned_string >()(b));
+}
+
+TEST(an_interned_string, is_ordered_lexicographically)
+{
+    const auto b = interned_string("interning_tests_b");
+    const auto a = interned_string("interning_tests_a");
+
+    ASSERT_LT(a, b);
+}
+
+TEST(an_interned_string, converts_to_its_string)
+{
+    const auto id = interned_string("ClassX");
+    const std::string& str = id;
+
+    ASSERT_EQ(str, "ClassX");
+    ASSERT_EQ(id.str(), "ClassX");
+}
+
+TEST(an_interned_string, is_empty_by_default)
+{
+    ASSERT_EQ(interned_string().str(), "");
+    ASSERT_EQ(interned_string(), interned_string(""));
+}
+
+TEST(an_interned_string, can_key_hash_sets)
+{
+    auto set = std::unordered_set< interned_string >();
+
+    set.insert(interned_string("a"));
+    set.insert(interned_string(std::string("a")));
+    set.insert(interned_string("b"));
+
+    ASSERT_EQ(set.size(), 2);
+    ASSERT_TRUE(set.contains(interned_string("a")));
+}
+
+TEST(an_interned_string, can_be_found_without_interning)
+{
+    const auto id = interned_string("interning_tests_found");
+    const auto size = interned_string::table().size();
+
+    ASSERT_EQ(interned_string::find("interning_tests_found"), id);
+    ASSERT_EQ(interned_string::find("interning_tests_not_found"), std::nullopt);
+    ASSERT_EQ(interned_string::table().size(), size);
+}
+
+} // namespace
@@ -0,0 +1,107 @@
+#include "misc/job.hpp"
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
+
+using namespace misc;
+using namespace testing;
+
+namespace
+{
+
+TEST(job_token, checkpoints_report_clamped_progress)
+{
+    auto token = job_token();
+
+    token.checkpoint(0.5);
+    EXPECT_EQ(token.progress(), 0.5);
+
+    token.checkpoint(2);
+    ASSERT_EQ(token.progress(), 1);
+}
+
+TEST(job_token, checkpoints_throw_once_stopped)
+{
+    auto source = std::stop_source();
+    auto token = job_token(source.get_token());
+
+    EXPECT_NO_THROW(token.checkpoint(0.1));
+
+    source.request_stop();
+
+    ASSERT_THROW(token.checkpoint(0.2), job_cancelled);
+}
+
+TEST(job_token, foreground_jobs_are_never_stopped)
+{
+    ASSERT_FALSE(foreground_job().stop_requested());
+}
+
+TEST(async_job, returns_the_job_result)
+{
+    auto job = async_job< int >([](job_token&) { return 42; });
+
+    ASSERT_EQ(job.get(), 42);
+}
+
+TEST(async_job, rethrows_the_job_exception)
+{
+    auto job = async_job< int >(
+        [](job_token&) -> int { throw std::runtime_error("bob"); });
+
+    ASSERT_THROW(job.get(), std::runtime_error);
+}
+
+TEST(async_job, is_ready_once_returned)
+{
+    auto job = async_job< int >([](job_token&) { return 1; });
+
+    while (!job.ready())
+        std::this_thread::yield();
+
+    ASSERT_EQ(job.get(), 1);
+}
+
+TEST(async_job, cancelled_jobs_throw_on_their_next_checkpoint)
+{
+    auto started = std::atomic< bool >(false);
+
+    auto job = async_job< int >(
+        [&started](job_token& token)
+        {
+            started = true;
+            while (true)
+                token.checkpoint(0);
+            return 0;
+        });
+
+    while (!started)
+        std::this_thread::yield();
+
+    job.cancel();
+
+    ASSERT_THROW(job.get(), job_cancelled);
+}
+
+TEST(async_job, destroying_a_job_cancels_it)
+{
+    auto cancelled = std::atomic< bool >(false);
+
+    {
+        auto job = async_job< int >(
+            [&cancelled](job_token& token)
+            {
+                while (!token.stop_requested())
+                    std::this_thread::yield();
+
+                cancelled = true;
+                return 0;
+            });
+    }
+
+    ASSERT_TRUE(cancelled);
+}
+
+} // namespace
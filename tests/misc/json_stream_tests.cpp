@@ -0,0 +1,114 @@
+#include "misc/json_stream.hpp"
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace misc;
+using namespace testing;
+
+namespace
+{
+
+TEST(json_stream, members_are_visited_in_document_order)
+{
+    auto is = std::istringstream(R"({ "b" : 1, "a" : "x", "c" : null })");
+    auto stream = json_stream(is);
+    auto keys = std::vector< std::string >();
+
+    stream.for_each_member(
+        [&](auto key)
+        {
+            keys.push_back(std::move(key));
+            stream.skip_value();
+        });
+
+    ASSERT_EQ(keys, (std::vector< std::string > { "b", "a", "c" }));
+}
+
+TEST(json_stream, elements_can_be_read_as_values)
+{
+    auto is = std::istringstream(R"([ { "k" : [1, 2] }, "s", 3.5, true ])");
+    auto stream = json_stream(is);
+    auto vals = std::vector< Json::Value >();
+
+    stream.for_each_element([&]() { vals.push_back(stream.read_value()); });
+
+    ASSERT_EQ(vals.size(), 4);
+    EXPECT_EQ(vals[0]["k"][1].asInt(), 2);
+    EXPECT_EQ(vals[1].asString(), "s");
+    EXPECT_EQ(vals[2].asDouble(), 3.5);
+    EXPECT_TRUE(vals[3].asBool());
+}
+
+TEST(json_stream, escaped_strings_are_decoded)
+{
+    auto is = std::istringstream(R"({ "a\"bé" : "}]" })");
+    auto stream = json_stream(is);
+    auto key = std::string();
+    auto val = std::string();
+
+    stream.for_each_member(
+        [&](auto k)
+        {
+            key = std::move(k);
+            val = stream.read_string();
+        });
+
+    EXPECT_EQ(key, "a\"bé");
+    EXPECT_EQ(val, "}]");
+}
+
+TEST(json_stream, null_composites_are_empty)
+{
+    auto is = std::istringstream("null");
+    auto stream = json_stream(is);
+    auto visited = false;
+
+    stream.for_each_element([&]() { visited = true; });
+
+    ASSERT_FALSE(visited);
+}
+
+TEST(json_stream, truncated_input_is_reported)
+{
+    auto is = std::istringstream(R"({ "a" : [1, 2 )");
+    auto stream = json_stream(is);
+
+    ASSERT_THROW(
+        stream.for_each_member([&](auto) { stream.skip_value(); }),
+        syntax_error);
+}
+
+TEST(json_stream, trailing_whitespace_is_consumed)
+{
+    auto is = std::istringstream("{ } \n\t ");
+    auto stream = json_stream(is);
+
+    stream.for_each_member([&](auto) { stream.skip_value(); });
+
+    ASSERT_NO_THROW(stream.consume_end());
+}
+
+TEST(json_stream, trailing_input_is_reported)
+{
+    auto is = std::istringstream("{ } x");
+    auto stream = json_stream(is);
+
+    stream.for_each_member([&](auto) { stream.skip_value(); });
+
+    ASSERT_THROW(stream.consume_end(), syntax_error);
+}
+
+TEST(json_stream, trailing_nul_is_reported)
+{
+    auto is = std::istringstream(std::string("{ }\0", 4));
+    auto stream = json_stream(is);
+
+    stream.for_each_member([&](auto) { stream.skip_value(); });
+
+    ASSERT_THROW(stream.consume_end(), syntax_error);
+}
+
+} // namespace
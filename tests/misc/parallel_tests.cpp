@@ -0,0 +1,78 @@
+#include "misc/parallel.hpp"
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using namespace misc;
+using namespace testing;
+
+namespace
+{
+
+TEST(parallel_for, visits_each_index_once)
+{
+    auto visits = std::vector< int >(1000, 0);
+
+    parallel_for(0, 1000, [&visits](auto i) { ++visits[i]; }, 7);
+
+    ASSERT_EQ(visits, std::vector< int >(1000, 1));
+}
+
+TEST(parallel_for, empty_ranges_are_not_visited)
+{
+    auto visited = false;
+
+    parallel_for(5, 5, [&visited](auto) { visited = true; }, 4);
+
+    ASSERT_FALSE(visited);
+}
+
+TEST(parallel_for_each_chunk, chunks_are_contiguous_and_cover_the_range)
+{
+    auto sum = std::atomic< int >(0);
+    auto chunks = std::atomic< int >(0);
+
+    parallel_for_each_chunk(
+        0,
+        100,
+        [&](auto first, auto last)
+        {
+            ASSERT_LT(first, last);
+            for (auto i = first; i != last; ++i)
+                sum += i;
+            ++chunks;
+        },
+        8);
+
+    EXPECT_EQ(sum, 4950);
+    EXPECT_EQ(chunks, 8);
+}
+
+TEST(parallel_for, at_most_one_chunk_per_index)
+{
+    auto chunks = std::atomic< int >(0);
+
+    parallel_for_each_chunk(0, 3, [&](auto, auto) { ++chunks; }, 16);
+
+    ASSERT_EQ(chunks, 3);
+}
+
+TEST(parallel_for, exceptions_are_rethrown_on_the_calling_thread)
+{
+    ASSERT_THROW(
+        parallel_for(
+            0,
+            100,
+            [](auto i)
+            {
+                if (i == 77)
+                    throw std::runtime_error("foo");
+            },
+            4),
+        std::runtime_error);
+}
+
+} // namespace
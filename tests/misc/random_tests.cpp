@@ -0,0 +1,58 @@
+#include "misc/random.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace misc;
+using namespace testing;
+
+namespace
+{
+
+TEST(stream_seed, is_stable)
+{
+    static_assert(stream_seed(42, "layout") == stream_seed(42, "layout"));
+
+    ASSERT_EQ(stream_seed(42, "layout"), stream_seed(42, "layout"));
+}
+
+TEST(stream_seed, differs_across_streams)
+{
+    ASSERT_NE(stream_seed(42, "layout"), stream_seed(42, "clustering"));
+}
+
+TEST(stream_seed, differs_across_seeds)
+{
+    ASSERT_NE(stream_seed(42, "layout"), stream_seed(43, "layout"));
+}
+
+TEST(make_rng, generates_reproducible_sequences)
+{
+    auto rng1 = make_rng(42, "layout");
+    auto rng2 = make_rng(42, "layout");
+
+    for (auto i = 0; i < 100; ++i)
+        ASSERT_EQ(rng1(), rng2());
+}
+
+TEST(urandom_from, generates_within_the_range)
+{
+    auto rng = make_rng(42, "test");
+
+    for (auto i = 0; i < 100; ++i)
+    {
+        const auto x = urandom_from(rng, -20.0, 20.0);
+        EXPECT_GE(x, -20.0);
+        EXPECT_LE(x, 20.0);
+    }
+}
+
+TEST(urandom_from, is_reproducible_from_a_seeded_generator)
+{
+    auto rng1 = make_rng(42, "test");
+    auto rng2 = make_rng(42, "test");
+
+    for (auto i = 0; i < 100; ++i)
+        ASSERT_EQ(urandom_from(rng1, 0, 1000), urandom_from(rng2, 0, 1000));
+}
+
+} // namespace
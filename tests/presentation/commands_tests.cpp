@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 #include <memory>
 #include <string>
+#include <thread>
 
 using namespace testing;
 using namespace presentation;
@@ -121,6 +122,16 @@ protected:
                             .scale = 1000 });
     }
 
+    // Layouts are computed asynchronously.
+    auto wait_for_commit() -> void
+    {
+        while (backend->is_pending())
+        {
+            backend->poll();
+            std::this_thread::yield();
+        }
+    }
+
     graph g;
     weights_backend w_backend { { { "weak", 2 } } };
     std::unique_ptr< command_history > cmds;
@@ -131,6 +142,8 @@ TEST_F(layout_commands_tests, update_layout_updates_the_backend_accordingly)
 {
     update_layout(*cmds, *backend, layout::gursoy_atun_id);
 
+    wait_for_commit();
+
     EXPECT_EQ(layout::get_layout_id(*backend), layout::gursoy_atun_id);
 }
 
@@ -141,6 +154,8 @@ TEST_F(layout_commands_tests, update_layout_can_be_undone)
     EXPECT_TRUE(cmds->can_undo());
     cmds->undo();
 
+    wait_for_commit();
+
     EXPECT_EQ(layout::get_layout_id(*backend), layout::gursoy_atun_id);
 }
 
@@ -152,6 +167,8 @@ TEST_F(layout_commands_tests, update_layout_can_be_undone_and_redone)
     EXPECT_TRUE(cmds->can_redo());
     cmds->redo();
 
+    wait_for_commit();
+
     EXPECT_EQ(layout::get_layout_id(*backend), layout::gursoy_atun_id);
 }
 
@@ -159,6 +176,8 @@ TEST_F(layout_commands_tests, update_topology_updates_the_backend_accordingly)
 {
     update_layout_topology(*cmds, *backend, layout::cube_id);
 
+    wait_for_commit();
+
     EXPECT_EQ(layout::get_topology_id(*backend), layout::cube_id);
 }
 
@@ -169,6 +188,8 @@ TEST_F(layout_commands_tests, update_topology_can_be_undone)
     EXPECT_TRUE(cmds->can_undo());
     cmds->undo();
 
+    wait_for_commit();
+
     EXPECT_EQ(layout::get_topology_id(*backend), layout::sphere_id);
 }
 
@@ -180,6 +201,8 @@ TEST_F(layout_commands_tests, update_topology_can_be_undone_and_redone)
     EXPECT_TRUE(cmds->can_redo());
     cmds->redo();
 
+    wait_for_commit();
+
     EXPECT_EQ(layout::get_topology_id(*backend), layout::cube_id);
 }
 
@@ -187,6 +210,8 @@ TEST_F(layout_commands_tests, update_scale_updates_the_backend_accordingly)
 {
     update_layout_scale(*cmds, *backend, 500);
 
+    wait_for_commit();
+
     EXPECT_EQ(layout::get_scale(*backend), 500);
 }
 
@@ -197,6 +222,8 @@ TEST_F(layout_commands_tests, update_scale_can_be_undone)
     EXPECT_TRUE(cmds->can_undo());
     cmds->undo();
 
+    wait_for_commit();
+
     EXPECT_EQ(layout::get_scale(*backend), 1000);
 }
 
@@ -208,6 +235,8 @@ TEST_F(layout_commands_tests, update_scale_can_be_undone_and_redone)
     EXPECT_TRUE(cmds->can_redo());
     cmds->redo();
 
+    wait_for_commit();
+
     EXPECT_EQ(layout::get_scale(*backend), 20);
 }
 
@@ -219,6 +248,8 @@ TEST_F(layout_commands_tests, restore_layout_updates_the_backend_accordingly)
 
     restore_layout(*cmds, *backend);
 
+    wait_for_commit();
+
     EXPECT_EQ(layout::get_layout_id(*backend), layout::gursoy_atun_id);
     EXPECT_EQ(layout::get_topology_id(*backend), layout::sphere_id);
     EXPECT_EQ(layout::get_scale(*backend), 1000);
@@ -234,6 +265,8 @@ TEST_F(layout_commands_tests, restore_layout_can_be_undone)
     EXPECT_TRUE(cmds->can_undo());
     cmds->undo();
 
+    wait_for_commit();
+
     EXPECT_EQ(layout::get_layout_id(*backend), layout::gursoy_atun_id);
     EXPECT_EQ(layout::get_topology_id(*backend), layout::cube_id);
     EXPECT_EQ(layout::get_scale(*backend), 500);
@@ -250,6 +283,8 @@ TEST_F(layout_commands_tests, restore_layout_can_be_undone_and_redone)
     EXPECT_TRUE(cmds->can_redo());
     cmds->redo();
 
+    wait_for_commit();
+
     EXPECT_EQ(layout::get_layout_id(*backend), layout::gursoy_atun_id);
     EXPECT_EQ(layout::get_topology_id(*backend), layout::sphere_id);
     EXPECT_EQ(layout::get_scale(*backend), 1000);
@@ -1327,6 +1362,8 @@ TEST_F(
     update_clustering_llp_steps_updates_the_backend_accordingly)
 {
     update_clustering_llp_steps(*cmds, *backend, 20);
+    update_clustering_leiden_resolution(*cmds, *backend, 20);
+    update_clustering_leiden_iterations(*cmds, *backend, 20);
 
     EXPECT_EQ(clustering::get_llp_steps(*backend), 20);
 }
@@ -1354,6 +1391,176 @@ TEST_F(
     EXPECT_EQ(clustering::get_llp_steps(*backend), 1);
 }
 
+TEST_F(
+    clustering_commands_tests,
+    update_clustering_leiden_resolution_updates_the_backend_accordingly)
+{
+    update_clustering_leiden_resolution(*cmds, *backend, 20);
+
+    EXPECT_EQ(clustering::get_leiden_resolution(*backend), 20);
+}
+
+TEST_F(
+    clustering_commands_tests,
+    update_clustering_leiden_resolution_can_be_undone)
+{
+    update_clustering_leiden_resolution(*cmds, *backend, 200);
+
+    EXPECT_TRUE(cmds->can_undo());
+    cmds->undo();
+
+    EXPECT_EQ(clustering::get_leiden_resolution(*backend), 1);
+}
+
+TEST_F(
+    clustering_commands_tests,
+    update_clustering_leiden_resolution_can_be_undone_and_redone)
+{
+    update_clustering_leiden_resolution(*cmds, *backend, 3);
+    cmds->undo();
+
+    EXPECT_TRUE(cmds->can_redo());
+    cmds->redo();
+
+    EXPECT_EQ(clustering::get_leiden_resolution(*backend), 3);
+}
+
+TEST_F(
+    clustering_commands_tests,
+    update_clustering_leiden_iterations_updates_the_backend_accordingly)
+{
+    update_clustering_leiden_iterations(*cmds, *backend, 20);
+
+    EXPECT_EQ(clustering::get_leiden_iterations(*backend), 20);
+}
+
+TEST_F(
+    clustering_commands_tests,
+    update_clustering_leiden_iterations_can_be_undone)
+{
+    update_clustering_leiden_iterations(*cmds, *backend, 200);
+
+    EXPECT_TRUE(cmds->can_undo());
+    cmds->undo();
+
+    EXPECT_EQ(clustering::get_leiden_iterations(*backend), 2);
+}
+
+TEST_F(
+    clustering_commands_tests,
+    update_clustering_leiden_iterations_can_be_undone_and_redone)
+{
+    update_clustering_leiden_iterations(*cmds, *backend, 3);
+    cmds->undo();
+
+    EXPECT_TRUE(cmds->can_redo());
+    cmds->redo();
+
+    EXPECT_EQ(clustering::get_leiden_iterations(*backend), 3);
+}
+
+TEST_F(
+    clustering_commands_tests,
+    update_clustering_mce_min_clique_size_updates_the_backend_accordingly)
+{
+    update_clustering_mce_min_clique_size(*cmds, *backend, 20);
+
+    EXPECT_EQ(clustering::get_mce_min_clique_size(*backend), 20);
+}
+
+TEST_F(
+    clustering_commands_tests,
+    update_clustering_mce_min_clique_size_can_be_undone)
+{
+    update_clustering_mce_min_clique_size(*cmds, *backend, 200);
+
+    EXPECT_TRUE(cmds->can_undo());
+    cmds->undo();
+
+    EXPECT_EQ(clustering::get_mce_min_clique_size(*backend), 2);
+}
+
+TEST_F(
+    clustering_commands_tests,
+    update_clustering_mce_min_clique_size_can_be_undone_and_redone)
+{
+    update_clustering_mce_min_clique_size(*cmds, *backend, 3);
+    cmds->undo();
+
+    EXPECT_TRUE(cmds->can_redo());
+    cmds->redo();
+
+    EXPECT_EQ(clustering::get_mce_min_clique_size(*backend), 3);
+}
+
+TEST_F(
+    clustering_commands_tests,
+    update_clustering_mce_max_cliques_updates_the_backend_accordingly)
+{
+    update_clustering_mce_max_cliques(*cmds, *backend, 20);
+
+    EXPECT_EQ(clustering::get_mce_max_cliques(*backend), 20);
+}
+
+TEST_F(
+    clustering_commands_tests,
+    update_clustering_mce_max_cliques_can_be_undone)
+{
+    update_clustering_mce_max_cliques(*cmds, *backend, 200);
+
+    EXPECT_TRUE(cmds->can_undo());
+    cmds->undo();
+
+    EXPECT_EQ(clustering::get_mce_max_cliques(*backend), 100000);
+}
+
+TEST_F(
+    clustering_commands_tests,
+    update_clustering_mce_max_cliques_can_be_undone_and_redone)
+{
+    update_clustering_mce_max_cliques(*cmds, *backend, 3);
+    cmds->undo();
+
+    EXPECT_TRUE(cmds->can_redo());
+    cmds->redo();
+
+    EXPECT_EQ(clustering::get_mce_max_cliques(*backend), 3);
+}
+
+TEST_F(
+    clustering_commands_tests,
+    update_clustering_mce_time_limit_updates_the_backend_accordingly)
+{
+    update_clustering_mce_time_limit(*cmds, *backend, 20);
+
+    EXPECT_EQ(clustering::get_mce_time_limit(*backend), 20);
+}
+
+TEST_F(
+    clustering_commands_tests,
+    update_clustering_mce_time_limit_can_be_undone)
+{
+    update_clustering_mce_time_limit(*cmds, *backend, 200);
+
+    EXPECT_TRUE(cmds->can_undo());
+    cmds->undo();
+
+    EXPECT_EQ(clustering::get_mce_time_limit(*backend), 10);
+}
+
+TEST_F(
+    clustering_commands_tests,
+    update_clustering_mce_time_limit_can_be_undone_and_redone)
+{
+    update_clustering_mce_time_limit(*cmds, *backend, 3);
+    cmds->undo();
+
+    EXPECT_TRUE(cmds->can_redo());
+    cmds->redo();
+
+    EXPECT_EQ(clustering::get_mce_time_limit(*backend), 3);
+}
+
 TEST_F(
     clustering_commands_tests,
     restore_clustering_updates_the_backend_accordingly)
@@ -1366,6 +1573,11 @@ TEST_F(
     update_clustering_min_modularity(*cmds, *backend, 20);
     update_clustering_llp_gamma(*cmds, *backend, 20);
     update_clustering_llp_steps(*cmds, *backend, 20);
+    update_clustering_leiden_resolution(*cmds, *backend, 20);
+    update_clustering_leiden_iterations(*cmds, *backend, 20);
+    update_clustering_mce_min_clique_size(*cmds, *backend, 20);
+    update_clustering_mce_max_cliques(*cmds, *backend, 20);
+    update_clustering_mce_time_limit(*cmds, *backend, 20);
 
     restore_clustering(*cmds, *backend);
 
@@ -1379,6 +1591,11 @@ TEST_F(
     EXPECT_EQ(clustering::get_min_modularity(*backend), 0.5);
     EXPECT_EQ(clustering::get_llp_gamma(*backend), 0);
     EXPECT_EQ(clustering::get_llp_steps(*backend), 1);
+    EXPECT_EQ(clustering::get_leiden_resolution(*backend), 1);
+    EXPECT_EQ(clustering::get_leiden_iterations(*backend), 2);
+    EXPECT_EQ(clustering::get_mce_min_clique_size(*backend), 2);
+    EXPECT_EQ(clustering::get_mce_max_cliques(*backend), 100000);
+    EXPECT_EQ(clustering::get_mce_time_limit(*backend), 10);
 }
 
 TEST_F(clustering_commands_tests, restore_clustering_can_be_undone)
@@ -1391,6 +1608,11 @@ TEST_F(clustering_commands_tests, restore_clustering_can_be_undone)
     update_clustering_min_modularity(*cmds, *backend, 20);
     update_clustering_llp_gamma(*cmds, *backend, 20);
     update_clustering_llp_steps(*cmds, *backend, 20);
+    update_clustering_leiden_resolution(*cmds, *backend, 20);
+    update_clustering_leiden_iterations(*cmds, *backend, 20);
+    update_clustering_mce_min_clique_size(*cmds, *backend, 20);
+    update_clustering_mce_max_cliques(*cmds, *backend, 20);
+    update_clustering_mce_time_limit(*cmds, *backend, 20);
     restore_clustering(*cmds, *backend);
 
     EXPECT_TRUE(cmds->can_undo());
@@ -1408,6 +1630,11 @@ TEST_F(clustering_commands_tests, restore_clustering_can_be_undone)
     EXPECT_EQ(clustering::get_min_modularity(*backend), 20);
     EXPECT_EQ(clustering::get_llp_gamma(*backend), 20);
     EXPECT_EQ(clustering::get_llp_steps(*backend), 20);
+    EXPECT_EQ(clustering::get_leiden_resolution(*backend), 20);
+    EXPECT_EQ(clustering::get_leiden_iterations(*backend), 20);
+    EXPECT_EQ(clustering::get_mce_min_clique_size(*backend), 20);
+    EXPECT_EQ(clustering::get_mce_max_cliques(*backend), 20);
+    EXPECT_EQ(clustering::get_mce_time_limit(*backend), 20);
 }
 
 TEST_F(clustering_commands_tests, restore_clustering_can_be_undone_and_redone)
@@ -1420,6 +1647,11 @@ TEST_F(clustering_commands_tests, restore_clustering_can_be_undone_and_redone)
     update_clustering_min_modularity(*cmds, *backend, 20);
     update_clustering_llp_gamma(*cmds, *backend, 20);
     update_clustering_llp_steps(*cmds, *backend, 20);
+    update_clustering_leiden_resolution(*cmds, *backend, 20);
+    update_clustering_leiden_iterations(*cmds, *backend, 20);
+    update_clustering_mce_min_clique_size(*cmds, *backend, 20);
+    update_clustering_mce_max_cliques(*cmds, *backend, 20);
+    update_clustering_mce_time_limit(*cmds, *backend, 20);
     restore_clustering(*cmds, *backend);
     cmds->undo();
 
@@ -1436,6 +1668,11 @@ TEST_F(clustering_commands_tests, restore_clustering_can_be_undone_and_redone)
     EXPECT_EQ(clustering::get_min_modularity(*backend), 0.5);
     EXPECT_EQ(clustering::get_llp_gamma(*backend), 0);
     EXPECT_EQ(clustering::get_llp_steps(*backend), 1);
+    EXPECT_EQ(clustering::get_leiden_resolution(*backend), 1);
+    EXPECT_EQ(clustering::get_leiden_iterations(*backend), 2);
+    EXPECT_EQ(clustering::get_mce_min_clique_size(*backend), 2);
+    EXPECT_EQ(clustering::get_mce_max_cliques(*backend), 100000);
+    EXPECT_EQ(clustering::get_mce_time_limit(*backend), 10);
 }
 
 /***********************************************************
@@ -4,6 +4,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <memory>
+#include <string_view>
 
 using namespace scaling;
 using namespace testing;
@@ -58,4 +59,38 @@ TEST_F(
     ASSERT_EQ(boost::get(map, v), make_scale(2, 1, 1));
 }
 
+struct resolving_counter
+{
+    int* num_resolved;
+
+    static auto count(std::string_view tag)
+    {
+        return tag == "fields" ? 10 : 100;
+    }
+
+    auto resolve(std::string_view tag) const
+    {
+        ++*num_resolved;
+        return count(tag);
+    }
+
+    auto operator()(graph::vertex_descriptor, int num) const { return num; }
+
+    auto operator()(graph::vertex_descriptor, std::string_view tag) const
+    {
+        return count(tag);
+    }
+};
+
+TEST_F(a_scale_map, resolves_the_factor_tags_once)
+{
+    auto num_resolved = 0;
+    const auto map
+        = make_scale_map< graph >(*b, resolving_counter { &num_resolved });
+
+    ASSERT_EQ(boost::get(map, v), make_scale(20, 10, 10));
+    ASSERT_EQ(boost::get(map, v), make_scale(20, 10, 10));
+    ASSERT_EQ(num_resolved, 2);
+}
+
 } // namespace
\ No newline at end of file
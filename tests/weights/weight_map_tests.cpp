@@ -68,4 +68,19 @@ TEST_F(a_dynamic_weight_map, reflects_changes_of_the_backend)
     ASSERT_EQ(boost::get(weight_map, edge), 20);
 }
 
+TEST_F(a_dynamic_weight_map, resolves_interned_dependencies_by_index)
+{
+    using interned_dependency_map = boost::constant_property_map<
+        graph::edge_descriptor,
+        misc::interned_dependency >;
+
+    const auto weight_map = make_weight_map< graph >(
+        *backend,
+        interned_dependency_map(misc::interned_dependency("Inheritance")));
+
+    update_weight(*backend, "Inheritance", 20);
+
+    ASSERT_EQ(boost::get(weight_map, edge), 20);
+}
+
 } // namespace
\ No newline at end of file
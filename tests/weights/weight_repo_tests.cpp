@@ -49,4 +49,14 @@ TEST_F(
     ASSERT_EQ(repo->get_weight("b"), 22);
 }
 
+TEST_F(given_a_weight_repo, weights_can_be_queried_by_interned_dependency)
+{
+    const auto b = misc::interned_dependency("b").handle();
+
+    repo->set_weight("b", 22);
+
+    ASSERT_EQ(repo->get_weight(b), 22);
+    ASSERT_EQ(repo->get_weight(b), repo->get_weight("b"));
+}
+
 } // namespace
\ No newline at end of file